@@ -30,12 +30,18 @@ Reads markdown or document JSON from FILE and outputs JSON or markdown to stdout
 Options:
   -d, --debug                 Enable debug output
   -i, --input-format=FORMAT   Input: markdown (default) or json
-  -o, --output-format=FORMAT  Output: json (default) or markdown
+  -o, --output-format=FORMAT  Output: json (default), markdown, html or replay
+
+  html parses the markdown straight into HtmlRender; replay parses it into
+  a document first and replays that into HtmlRender (render_document), so
+  the two can be compared.
 
 Examples:
   {ARG} doc.md                 # markdown → JSON
   {ARG} doc.md markdown        # markdown → markdown (round-trip; 2nd arg = output format)
   {ARG} doc.json markdown      # JSON → markdown
+  {ARG} doc.md html            # markdown → HTML (fresh parse)
+  {ARG} doc.md replay          # markdown → document → HTML (replay)
 """; }
 
 	public OcMarkdownDocTest()
@@ -104,6 +110,14 @@ Examples:
 		FileUtils.get_data(path, out contents);
 		string input = (string)contents;
 
+		if (output_format == "html") {
+			if (input_is_json) {
+				throw new GLib.IOError.INVALID_ARGUMENT("html output needs markdown input");
+			}
+			command_line.print(new Markdown.HtmlRender().toHtml(input));
+			return;
+		}
+
 		Markdown.Document.Document doc;
 		if (input_is_json)
 			doc = doc_from_json(input);
@@ -119,6 +133,8 @@ Examples:
 
 		if (output_format == "markdown") {
 			command_line.print(doc.to_markdown());
+		} else if (output_format == "replay") {
+			command_line.print(new Markdown.HtmlRender().render_document(doc));
 		} else {
 			var root = Json.gobject_serialize(doc);
 			var gen = new Json.Generator();
@@ -16,6 +16,18 @@
  * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+/**
+ * Renderer that ignores every callback; used by --bench so the timing
+ * measures the parser rather than stdout.
+ */
+class BenchRenderer : Markdown.RenderBase
+{
+	public BenchRenderer()
+	{
+		base();
+	}
+}
+
 /**
  * Example: oc-markdown-test {markdown file}
  *
@@ -24,6 +36,15 @@
  */
 class TestMarkdown : TestAppBase
 {
+	private static int opt_bench = 0;
+	private static int opt_chunk = 0;
+
+	private const OptionEntry[] local_options = {
+		{ "bench", 0, 0, OptionArg.INT, ref opt_bench, "Parse the file N times with a silent renderer and report MB/s", "N" },
+		{ "chunk", 0, 0, OptionArg.INT, ref opt_chunk, "With --bench: feed the file in chunks of BYTES (0 = whole file)", "BYTES" },
+		{ null }
+	};
+
 	protected override string help { get; set; default = """
 Usage: {ARG} [OPTIONS] <markdown_file>
 
@@ -34,10 +55,13 @@ Arguments:
 
 Options:
   -d, --debug                 Enable debug output
+  --bench N                   Parse the file N times (no trace) and report throughput
+  --chunk BYTES               With --bench: feed the file in BYTES-sized chunks, as streaming does
 
 Examples:
   {ARG} README.md
   {ARG} --debug tests/markdown/links.md
+  {ARG} --bench 200 --chunk 64 tests/markdown/blocks.md
 """; }
 
 	public TestMarkdown()
@@ -58,6 +82,10 @@ Examples:
 		base_opts[1] = base_options[1];  // debug-critical
 		base_opts[2] = { null };
 		opt_context.add_main_entries(base_opts, null);
+
+		var app_group = new OptionGroup("oc-markdown-test", "Markdown Parser Test Options", "Show oc-markdown-test options");
+		app_group.add_entries(local_options);
+		opt_context.add_group(app_group);
 		return opt_context;
 	}
 
@@ -93,6 +121,11 @@ Examples:
 			throw new GLib.IOError.FAILED("Failed to read file: %s", e.message);
 		}
 
+		if (opt_bench > 0) {
+			this.run_bench(command_line, remaining_args[1], markdown_content);
+			return;
+		}
+
 		var renderer = new Markdown.DummyRenderer();
 
 		// Print path as given so test output is stable (not absolute)
@@ -107,6 +140,51 @@ Examples:
 
 		command_line.print("=== END TRACE ===\n");
 	}
+
+	/**
+	 * Parses content opt_bench times and prints bytes, time and MB/s.
+	 * With --chunk the content is split on UTF-8 boundaries and fed through
+	 * add() piece by piece, which exercises the leftover_chunk path like a
+	 * streamed LLM reply.
+	 */
+	private void run_bench(ApplicationCommandLine command_line, string label, string markdown_content)
+	{
+		var chunks = new Gee.ArrayList<string>();
+		if (opt_chunk <= 0) {
+			chunks.add(markdown_content);
+		} else {
+			var pos = 0;
+			while (pos < markdown_content.length) {
+				var end = int.min(pos + opt_chunk, markdown_content.length);
+				// Don't split a multi-byte character
+				while (end < markdown_content.length && (((uint8) markdown_content[end]) & 0xC0) == 0x80) {
+					end++;
+				}
+				chunks.add(markdown_content.substring(pos, end - pos));
+				pos = end;
+			}
+		}
+
+		var renderer = new BenchRenderer();
+		var timer = new GLib.Timer();
+		for (var i = 0; i < opt_bench; i++) {
+			renderer.start();
+			foreach (var chunk in chunks) {
+				renderer.add(chunk);
+			}
+			renderer.flush();
+		}
+		timer.stop();
+
+		var seconds = timer.elapsed();
+		var total_bytes = (double) markdown_content.length * opt_bench;
+		command_line.print("=== BENCH: %s ===\n", label);
+		command_line.print("size:       %d bytes x %d runs (%d chunks/run)\n",
+			markdown_content.length, opt_bench, chunks.size);
+		command_line.print("time:       %.3f s (%.3f ms/run)\n", seconds, seconds * 1000.0 / opt_bench);
+		command_line.print("throughput: %.2f MB/s\n",
+			seconds > 0 ? total_bytes / (1024.0 * 1024.0) / seconds : 0.0);
+	}
 }
 
 int main(string[] args)
@@ -25,6 +25,7 @@ class TestBubble : TestAppBase
 	private static string? opt_allow_write = null;
 	/** Optional: fs | no-fs | net | no-net — assert on Bubble.exec output (seccomp appendices). */
 	private static string? opt_expect = null;
+	private static bool opt_worker = false;
 
 	/**
 	 * Build write_array for Bubble (keep in sync with Request.execute allow_write parse).
@@ -103,6 +104,7 @@ Arguments:
 Options:
   --allow-write=SPEC         Same as run_command allow_write (default project). Examples: project, no, /tmp, /tmp:/var/tmp
   --expect=MODE              After run, assert on output: fs | no-fs | net | no-net (seccomp appendices)
+  --worker                   Each argument is one command; run them in turn in one persistent sandbox
 
 Examples:
   {ARG} --project=/path/to/project "ls -la"
@@ -112,6 +114,7 @@ Examples:
   {ARG} --project=/path --allow-write=project --expect=no-fs "echo ok"
   {ARG} --project=/path --allow-write=project --expect=fs "touch /etc/.oc-test-bubble-deleteme"
   {ARG} --project=/path --expect=net "curl -s -o /dev/null --connect-timeout 2 https://example.com"
+  {ARG} --project=/path --worker "echo one" "false" "echo two"
 """; }
 
 	public TestBubble()
@@ -130,6 +133,7 @@ Examples:
 		{ "test-db", 0, 0, OptionArg.STRING, ref opt_test_db, "Specify test database path instead of standard database (optional, for testing only)", "PATH" },
 		{ "allow-write", 0, 0, OptionArg.STRING, ref opt_allow_write, "allow_write token list (see --help)", "SPEC" },
 		{ "expect", 0, 0, OptionArg.STRING, ref opt_expect, "Assert output: fs|no-fs|net|no-net", "MODE" },
+		{ "worker", 0, 0, OptionArg.NONE, ref opt_worker, "Run each command argument in turn in one persistent sandbox", null },
 		{ null }
 	};
 
@@ -253,6 +257,11 @@ Examples:
 			throw pe;
 		}
 
+		if (opt_worker) {
+			yield this.run_worker(project, write_array, remaining_args[1:remaining_args.length]);
+			return;
+		}
+
 		// Create Bubble instance
 		var bubble = new OLLMfiles.Sandbox.Bubble (project, opt_allow_network, write_array);
 
@@ -300,6 +309,39 @@ Examples:
 			}
 		}
 	}
+
+	/**
+	 * Run each command in turn in one {@link OLLMbwrap.Worker}, printing
+	 * every result between "--- Command N ---" / "--- End Command N ---".
+	 * A failing command is printed as its result (or ERROR line) and the
+	 * next command still runs.
+	 */
+	private async void run_worker(OLLMfiles.Folder project, string[] write_array, string[] commands) throws Error
+	{
+		var worker = new OLLMbwrap.Worker(
+			new OLLMbwrap.Overlay(new OLLMbwrap.NoOpFileVerification()));
+		var write_roots = new Gee.HashMap<string, string>();
+		write_roots.set(project.path, project.path);
+		worker.bubble.project_path = project.path;
+		worker.bubble.allow_network = opt_allow_network;
+		worker.bubble.write_tokens = write_array;
+		worker.bubble.write_roots = write_roots;
+
+		try {
+			for (var i = 0; i < commands.length; i++) {
+				stdout.printf("\n--- Command %d ---\n", i + 1);
+				try {
+					var output = yield worker.exec(commands[i]);
+					stdout.printf("%s", output);
+				} catch (GLib.Error e) {
+					stdout.printf("ERROR: %s", e.message);
+				}
+				stdout.printf("\n--- End Command %d ---\n", i + 1);
+			}
+		} finally {
+			worker.release();
+		}
+	}
 }
 
 int main(string[] args)
@@ -33,6 +33,10 @@ class TestGtkMd : TestAppBase
 	private static int opt_stream_delay_ms = -1;
 	private static bool opt_thinking = false;
 	private static string? opt_history = null;
+	private static bool opt_bench = false;
+	private static bool opt_no_coalesce = false;
+	/** Milliseconds between streamed chunks (default 30). */
+	private static int opt_chunk_ms = 30;
 
 	private Gtk.Window window;
 	private MarkdownGtk.RenderBox text_view_box;
@@ -48,6 +52,16 @@ class TestGtkMd : TestAppBase
 	private string[] saved_args = {};
 	/** Incremented on Reload to stop in-flight stream timers. */
 	private uint stream_token = 0;
+	/** --bench: frame intervals (ms) from the frame clock while streaming. */
+	private double[] bench_frames = {};
+	private int64 bench_last_frame = 0;
+	private int64 bench_started = 0;
+	private int64 bench_render_us = 0;
+	private int64 bench_render_max_us = 0;
+	private int bench_renders = 0;
+	private size_t bench_bytes = 0;
+	private int bench_chunks = 0;
+	private ApplicationCommandLine? command_line_ref = null;
 	// private Gtk.Button history_next_button;
 
 	protected override string help { get; set; default = """
@@ -62,6 +76,9 @@ Options:
   -s, --stream MS            Emulate streaming: wait MS milliseconds before chunks (0 = immediate)
   -t, --thinking             Nested ```markdown block (RenderSourceView + nested MarkdownGtk.Render), like ChatView thinking
       --history FILE         Session JSON: replay messages from the start (ui / think-stream / content-stream) like ChatWidget
+      --bench                Stream the file (implies --stream 0), report frame times and render cost, then exit
+      --chunk-ms MS          Milliseconds between streamed chunks (default 30; use 1-5 for fast local models)
+      --no-coalesce          Render every chunk immediately instead of once per frame (baseline for --bench)
 
 Examples:
   {ARG} README.md
@@ -74,6 +91,8 @@ Examples:
   {ARG} --thinking tests/markdown/repro-state-stack-overflow.md
   {ARG} --thinking tests/markdown/repro-gtkmd-hang.md
   {ARG} --history ~/.local/share/ollmchat/history/2026/04/01/23-56-59.json
+  {ARG} --bench --chunk-ms 2 tests/markdown/tables.md
+  {ARG} --bench --chunk-ms 2 --no-coalesce tests/markdown/tables.md
 """; }
 
 	public TestGtkMd()
@@ -91,6 +110,9 @@ Examples:
 		{ "stream", 's', 0, OptionArg.INT, ref opt_stream_delay_ms, "Milliseconds to wait before chunks (0 = immediate)", "MS" },
 		{ "thinking", 't', 0, OptionArg.NONE, ref opt_thinking, "Use ChatView-style markdown code block + nested MarkdownGtk.Render", null },
 		{ "history", 0, 0, OptionArg.STRING, ref opt_history, "Session JSON: replay messages from the start", "FILE" },
+		{ "bench", 0, 0, OptionArg.NONE, ref opt_bench, "Stream the file, report frame times, then exit", null },
+		{ "chunk-ms", 0, 0, OptionArg.INT, ref opt_chunk_ms, "Milliseconds between streamed chunks (default 30)", "MS" },
+		{ "no-coalesce", 0, 0, OptionArg.NONE, ref opt_no_coalesce, "Render every chunk immediately (no per-frame batching)", null },
 		{ null }
 	};
 
@@ -114,6 +136,13 @@ Examples:
 	{
 		opt_file = opt_file == null ? "" : opt_file;
 		opt_history = opt_history == null ? "" : opt_history;
+		if (opt_bench && opt_history != "") {
+			return "ERROR: --bench streams a markdown file; it cannot be combined with --history.\n";
+		}
+		if (opt_bench && opt_stream_delay_ms < 0) {
+			opt_stream_delay_ms = 0;
+		}
+		opt_chunk_ms = int.max(1, opt_chunk_ms);
 		if (opt_history != "") {
 			return null;
 		}
@@ -130,6 +159,7 @@ Examples:
 			throw new GLib.IOError.FAILED("Failed to initialize GTK");
 		}
 
+		this.command_line_ref = command_line;
 		this.build_window();
 
 		GLib.Timeout.add(500, () => {
@@ -330,8 +360,14 @@ Examples:
 		this.scrolled.set_child(this.text_view_box);
 
 		this.md_renderer = new MarkdownGtk.Render(this.text_view_box) {
-			scroll_to_end = this.history_messages.get_length() == 0 && stream
+			scroll_to_end = this.history_messages.get_length() == 0 && stream,
+			coalesce = !opt_no_coalesce
 		};
+		this.md_renderer.frame_rendered.connect((bytes, elapsed_us) => {
+			this.bench_renders++;
+			this.bench_render_us += elapsed_us;
+			this.bench_render_max_us = int64.max(this.bench_render_max_us, elapsed_us);
+		});
 		this.md_renderer.is_streaming = stream;
 		this.md_renderer.link_clicked.connect((href, link_title) => {
 			if (href.has_prefix("http://") || href.has_prefix("https://")) {
@@ -530,9 +566,69 @@ Examples:
 			});
 			return;
 		}
+		if (opt_bench) {
+			this.bench_start();
+		}
 		this.stream_content_chunks(markdown_content, tok);
 	}
 
+	/**
+	 * --bench: record the interval between painted frames while the stream
+	 * runs. With --no-coalesce, time spent in add() is measured per chunk.
+	 */
+	private void bench_start()
+	{
+		this.bench_started = GLib.get_monotonic_time();
+		var clock = this.window.get_frame_clock();
+		if (clock == null) {
+			return;
+		}
+		clock.after_paint.connect(() => {
+			var now = clock.get_frame_time();
+			if (this.bench_last_frame != 0) {
+				this.bench_frames += (now - this.bench_last_frame) / 1000.0;
+			}
+			this.bench_last_frame = now;
+		});
+	}
+
+	/**
+	 * --bench: print frame-time statistics and close the window.
+	 */
+	private void bench_report()
+	{
+		var total_ms = (GLib.get_monotonic_time() - this.bench_started) / 1000.0;
+		var frames = new Gee.ArrayList<double?>();
+		var sum = 0.0;
+		foreach (var f in this.bench_frames) {
+			frames.add(f);
+			sum += f;
+		}
+		frames.sort((a, b) => {
+			return a < b ? -1 : (a > b ? 1 : 0);
+		});
+		var n = frames.size;
+		var cl = this.command_line_ref;
+		cl.print("=== oc-test-gtkmd bench (%s) ===\n", opt_no_coalesce ? "per-chunk" : "per-frame");
+		cl.print("chunks: %d (%zu bytes, every %d ms)\n", this.bench_chunks, this.bench_bytes, opt_chunk_ms);
+		cl.print("wall time: %.1f ms\n", total_ms);
+		cl.print("frames: %d\n", n);
+		if (n > 0) {
+			cl.print("frame ms: avg %.2f  p50 %.2f  p95 %.2f  max %.2f\n",
+				sum / n,
+				(double) frames.get(n / 2),
+				(double) frames.get((int) (n * 0.95)),
+				(double) frames.get(n - 1));
+		}
+		if (this.bench_renders > 0) {
+			cl.print("renders: %d  avg %.3f ms  max %.3f ms\n",
+				this.bench_renders,
+				this.bench_render_us / 1000.0 / this.bench_renders,
+				this.bench_render_max_us / 1000.0);
+		}
+		this.window.close();
+	}
+
 	/**
 	 * Feed body markdown in random-sized chunks (2–8 Unicode characters)
 	 * every ~30ms. Uses character indices and ''index_of_nth_char'' for
@@ -541,7 +637,7 @@ Examples:
 	private void stream_content_chunks(string markdown_content, uint tok)
 	{
 		int[] pos = { 0 };
-		const uint interval_ms = 30;
+		var interval_ms = (uint) opt_chunk_ms;
 		GLib.Timeout.add(interval_ms, () => {
 			if (tok != this.stream_token) {
 				return false;
@@ -553,6 +649,9 @@ Examples:
 				GLib.Timeout.add(200, () => {
 					this.md_renderer.box.queue_resize();
 					this.scrolled.queue_resize();
+					if (opt_bench) {
+						this.bench_report();
+					}
 					return false;
 				});
 				return false;
@@ -561,7 +660,19 @@ Examples:
 			var end_ci = int.min(pos[0] + chunk_chars, cc);
 			var start_byte = markdown_content.index_of_nth_char(pos[0]);
 			var end_byte = end_ci >= cc ? markdown_content.length : markdown_content.index_of_nth_char(end_ci);
-			this.md_renderer.add(markdown_content.substring(start_byte, end_byte - start_byte));
+			var chunk = markdown_content.substring(start_byte, end_byte - start_byte);
+			if (opt_bench && opt_no_coalesce) {
+				var started = GLib.get_monotonic_time();
+				this.md_renderer.add(chunk);
+				var elapsed = GLib.get_monotonic_time() - started;
+				this.bench_renders++;
+				this.bench_render_us += elapsed;
+				this.bench_render_max_us = int64.max(this.bench_render_max_us, elapsed);
+			} else {
+				this.md_renderer.add(chunk);
+			}
+			this.bench_chunks++;
+			this.bench_bytes += chunk.length;
 			pos[0] = end_ci;
 			GLib.Idle.add(() => {
 				if (tok != this.stream_token) {
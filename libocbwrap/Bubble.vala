@@ -95,6 +95,12 @@ namespace OLLMbwrap
 			get; set; default = new Gee.HashMap<string, string> ();
 		}
 
+		/**
+		 * Add --die-with-parent so the sandbox goes away with this process
+		 * (long-lived {@link Worker} sandboxes).
+		 */
+		public bool die_with_parent { get; set; default = false; }
+
 		public FileVerification verification { get; construct; }
 
 		/**
@@ -111,14 +117,26 @@ namespace OLLMbwrap
 		public string bwrap_exe { get; private set; default = ""; }
 
 		/**
-		 * Accumulator for stdout output (for success case).
+		 * Captured stdout (for success case); set from {@link stdout_capture} when the run ends.
 		 */
 		public string ret_str { get; private set; default = ""; }
 		
 		/**
-		 * Accumulator for stderr output (for failure case).
+		 * Captured stderr (for failure case); set from {@link stderr_capture} when the run ends.
 		 */
 		public string fail_str { get; private set; default = ""; }
+
+		/**
+		 * Bounded stdout capture for {@link exec}. Connect to
+		 * {@link OutputCapture.progress} before exec for live output;
+		 * limits may be changed before exec.
+		 */
+		public OutputCapture stdout_capture { get; private set; default = new OutputCapture(); }
+
+		/**
+		 * Bounded stderr capture for {@link exec} (see {@link stdout_capture}).
+		 */
+		public OutputCapture stderr_capture { get; private set; default = new OutputCapture(); }
 		
 		/**
 		 * @param verification Non-null apply hook wired into {@link Overlay} / {@link Scan}
@@ -131,6 +149,21 @@ namespace OLLMbwrap
 			this.bwrap_exe = bp != null ? bp : "";
 			this.overlay = new Overlay (this.verification);
 		}
+
+		/**
+		 * Run in an existing overlay, e.g. a warm one kept across commands
+		 * (see {@link Overlay.keep_warm}). Apply hooks come from the overlay.
+		 *
+		 * @param overlay Overlay to mount; {@link exec} does not release it when warm
+		 */
+		public Bubble.with_overlay (Overlay overlay)
+		{
+			Object (verification: overlay.verification);
+
+			string? bp = GLib.Environment.find_program_in_path("bwrap");
+			this.bwrap_exe = bp != null ? bp : "";
+			this.overlay = overlay;
+		}
 		
 		/**
 		 * Execute command string in bubblewrap sandbox and return output as string.
@@ -269,6 +302,9 @@ namespace OLLMbwrap
 			args += this.bwrap_exe;
 			
 			args += "--unshare-user";
+			if (this.die_with_parent) {
+				args += "--die-with-parent";
+			}
 
 			var home = GLib.Environment.get_home_dir();
 
@@ -397,225 +433,100 @@ namespace OLLMbwrap
 
 		/**
 		 * Read stdout and stderr from subprocess and return combined output.
-	 * 
-	 * Uses IOChannel.add_watch() pattern from Spawn.vala to read from both
-	 * streams concurrently as data arrives.
-	 * 
-	 * @param subprocess The Subprocess instance to read from
-	 * @param run_seccomp NOTIFY aggregator for this run (same main loop as this async method)
-	 * @return Combined stdout + stderr output as string, with exit code appended if non-zero
-	 * @throws Error if reading fails, waiting for process fails, or I/O errors occur
-	 */
-	private async string read_subprocess_output (
-		GLib.Subprocess subprocess,
-		RunSeccomp run_seccomp) throws Error
-	{
-		// Get stdout and stderr streams from subprocess
-		var stdout_stream = subprocess.get_stdout_pipe();
-		var stderr_stream = subprocess.get_stderr_pipe();
-		
-		// Reset accumulators for this execution
-		this.ret_str = "";
-		this.fail_str = "";
-		
-		// Convert InputStreams to IOChannels for concurrent monitoring
-		// Note: We need to get file descriptors from the streams
-		// For UnixInputStream, we can use get_fd()
-		GLib.IOChannel? stdout_ch = null;
-		GLib.IOChannel? stderr_ch = null;
-		
-		if (stdout_stream is GLib.UnixInputStream) {
-			var unix_stdout = stdout_stream as GLib.UnixInputStream;
-			stdout_ch = new GLib.IOChannel.unix_new(unix_stdout.get_fd());
-		}
-		
-		if (stderr_stream is GLib.UnixInputStream) {
-			var unix_stderr = stderr_stream as GLib.UnixInputStream;
-			stderr_ch = new GLib.IOChannel.unix_new(unix_stderr.get_fd());
-		}
-		
-		if (stdout_ch == null || stderr_ch == null) {
-			throw new GLib.IOError.NOT_SUPPORTED(
-				"Command execution is not supported on this system. The machine running this does not support command line execution because it lacks Unix stream support. Commands cannot be executed in this environment.");
-		}
-		
-		// Make channels non-blocking
-		stdout_ch.set_flags(GLib.IOFlags.NONBLOCK);
-		stderr_ch.set_flags(GLib.IOFlags.NONBLOCK);
-		
-		// Track if streams are still open
-		bool stdout_open = true;
-		bool stderr_open = true;
-		
-		// Add watches to monitor both channels concurrently
-		uint stdout_watch = stdout_ch.add_watch(
-			GLib.IOCondition.IN | GLib.IOCondition.HUP | GLib.IOCondition.ERR,
-			(channel, condition) => {
-				if ((condition & GLib.IOCondition.IN) != 0) {
-					this.read_from_channel(channel, true);
-				}
-				if ((condition & (GLib.IOCondition.HUP | GLib.IOCondition.ERR)) != 0) {
-					stdout_open = false;
-					return false; // Remove watch
-				}
-				return stdout_open; // Keep watching if still open
-			}
-		);
-		
-		uint stderr_watch = stderr_ch.add_watch(
-			GLib.IOCondition.IN | GLib.IOCondition.HUP | GLib.IOCondition.ERR,
-			(channel, condition) => {
-				if ((condition & GLib.IOCondition.IN) != 0) {
-					this.read_from_channel(channel, false);
-				}
-				if ((condition & (GLib.IOCondition.HUP | GLib.IOCondition.ERR)) != 0) {
-					stderr_open = false;
-					return false; // Remove watch
-				}
-				return stderr_open; // Keep watching if still open
-			}
-		);
-		
-		// Wait for process to complete
-		int exit_status = 0;
-		try {
-			yield subprocess.wait_async(null);
-			// Always get exit status, regardless of success/failure
-			exit_status = subprocess.get_exit_status();
-		} catch (GLib.Error e) {
-			// If wait_async failed, try to get exit status if process has terminated
-			if (!subprocess.get_successful()) {
-				exit_status = subprocess.get_exit_status();
-			}
-			// Clean up watches - only remove if they haven't been removed already
-			// (watch callbacks remove themselves when HUP/ERR is detected)
-			if (stdout_open) {
-				GLib.Source.remove(stdout_watch);
-			}
-			if (stderr_open) {
-				GLib.Source.remove(stderr_watch);
+		 *
+		 * Both pipes are drained concurrently into {@link stdout_capture} and
+		 * {@link stderr_capture} while the process runs, so memory is bounded
+		 * by the capture limits rather than by how much the command prints.
+		 *
+		 * @param subprocess The Subprocess instance to read from
+		 * @param run_seccomp NOTIFY aggregator for this run (same main loop as this async method)
+		 * @return Combined stdout + stderr output as string, with exit code appended if non-zero
+		 * @throws Error if reading fails, waiting for process fails, or I/O errors occur
+		 */
+		private async string read_subprocess_output (
+			GLib.Subprocess subprocess,
+			RunSeccomp run_seccomp) throws Error
+		{
+			this.stdout_capture.reset();
+			this.stderr_capture.reset();
+
+			int exit_status = 0;
+			try {
+				yield OutputCapture.collect(subprocess, this.stdout_capture, this.stderr_capture);
+				// Always get exit status, regardless of success/failure
+				exit_status = OutputCapture.exit_code(subprocess);
+			} catch (GLib.Error e) {
+				throw new GLib.IOError.FAILED("Failed to wait for process: " + e.message);
 			}
-			throw new GLib.IOError.FAILED("Failed to wait for process: " + e.message);
-		}
-		
-		// Read any remaining data
-		if (stdout_open) {
-			this.read_from_channel(stdout_ch, true);
-		}
-		if (stderr_open) {
-			this.read_from_channel(stderr_ch, false);
-		}
-		
-		// Clean up watches - only remove if they haven't been removed already
-		// (watch callbacks remove themselves when HUP/ERR is detected)
-		if (stdout_open) {
-			GLib.Source.remove(stdout_watch);
-		}
-		if (stderr_open) {
-			GLib.Source.remove(stderr_watch);
+			return this.format_result(exit_status, run_seccomp);
 		}
 
-		run_seccomp.drain_notify_readable();
-		run_seccomp.finish_evidence_formatting();
+		/**
+		 * Build the tool result from the captures, exit status and sandbox
+		 * evidence of a finished command. Sets {@link ret_str} and {@link fail_str}.
+		 *
+		 * @param exit_status exit status of the command
+		 * @param run_seccomp NOTIFY aggregator for the command (drained here)
+		 * @return stdout (plus evidence) on success; stderr + stdout + exit code on failure
+		 */
+		internal string format_result(int exit_status, RunSeccomp run_seccomp)
+		{
+			this.ret_str = this.stdout_capture.to_text();
+			this.fail_str = this.stderr_capture.to_text();
+
+			run_seccomp.drain_notify_readable();
+			run_seccomp.finish_evidence_formatting();
 
-		// Build failure string (stderr + stdout + exit code) for failure case
-		// fail_str already contains stderr, now add stdout
-		var final_fail_str = this.fail_str;
-		if (this.ret_str != "") {
+			// Build failure string (stderr + stdout + exit code) for failure case
+			// fail_str already contains stderr, now add stdout
+			var final_fail_str = this.fail_str;
+			if (this.ret_str != "") {
+				if (final_fail_str != "") {
+					final_fail_str += "\n";
+				}
+				final_fail_str += this.ret_str;
+			}
+
+			// Add exit code to fail_str
 			if (final_fail_str != "") {
 				final_fail_str += "\n";
 			}
-			final_fail_str += this.ret_str;
-		}
-		
-		// Add exit code to fail_str
-		if (final_fail_str != "") {
-			final_fail_str += "\n";
-		}
-		final_fail_str += "Exit code: " + exit_status.to_string();
-		string[] appendix = {};
-		foreach (string part in new string[] {
-			run_seccomp.network,
-			run_seccomp.skipped,
-			run_seccomp.fs
-		}) {
-			string t = part.chomp();
-			if (t == "") {
-				continue;
+			final_fail_str += "Exit code: " + exit_status.to_string();
+			string[] appendix = {};
+			foreach (string part in new string[] {
+				run_seccomp.network,
+				run_seccomp.skipped,
+				run_seccomp.fs
+			}) {
+				string t = part.chomp();
+				if (t == "") {
+					continue;
+				}
+				appendix += t;
 			}
-			appendix += t;
-		}
-		if (appendix.length > 0) {
-			final_fail_str += "\n" + string.joinv("\n", appendix);
-		}
-		final_fail_str += "\n";
+			if (appendix.length > 0) {
+				final_fail_str += "\n" + string.joinv("\n", appendix);
+			}
+			final_fail_str += "\n";
 
-		// Return appropriate string based on exit status
-		if (exit_status == 0) {
-			if (run_seccomp.fs != "") {
-				if (this.ret_str != "") {
-					return this.ret_str + "\n" + run_seccomp.fs;
+			// Return appropriate string based on exit status
+			if (exit_status == 0) {
+				if (run_seccomp.fs != "") {
+					if (this.ret_str != "") {
+						return this.ret_str + "\n" + run_seccomp.fs;
+					}
+					return run_seccomp.fs;
 				}
-				return run_seccomp.fs;
-			}
-			if (run_seccomp.skipped != "") {
-				if (this.ret_str != "") {
-					return this.ret_str + "\n" + run_seccomp.skipped;
+				if (run_seccomp.skipped != "") {
+					if (this.ret_str != "") {
+						return this.ret_str + "\n" + run_seccomp.skipped;
+					}
+					return run_seccomp.skipped;
 				}
-				return run_seccomp.skipped;
-			}
-			return this.ret_str;
-		}
-		// Failure: return stderr + stdout + exit code
-		return final_fail_str;
-		
-	}
-	
-	/**
-	 * Read from an IOChannel and accumulate output.
-	 * 
-	 * Based on Spawn.vala read() method pattern.
-	 * Accumulates output into object properties as data arrives.
-	 * 
-	 * @param channel The IOChannel to read from
-	 * @param is_stdout True if reading from stdout, false if stderr
-	 */
-	private void read_from_channel(GLib.IOChannel channel, bool is_stdout)
-	{
-		while (true) {
-			string? buffer = null;
-			size_t len = 0;
-			size_t term_pos = 0;
-			GLib.IOStatus status;
-			
-			try {
-				status = channel.read_line(out buffer, out len, out term_pos);
-			} catch (GLib.Error e) {
-				return; // Error reading, stop
-			}
-			
-			if (buffer == null) {
-				return; // No more data
-			}
-			
-			// If status is not NORMAL, return early
-			if (status != GLib.IOStatus.NORMAL) {
-				return; // AGAIN, EOF, or ERROR - stop reading
+				return this.ret_str;
 			}
-			
-			// Status is NORMAL - accumulate output
-			if (is_stdout) {
-				this.ret_str += buffer;
-				continue; // Read more
-			}
-			
-			if (this.fail_str != "") {
-				this.fail_str += "\n";
-			}
-			this.fail_str += buffer;
-			continue; // Read more
+			// Failure: return stderr + stdout + exit code
+			return final_fail_str;
 		}
 	}
-	}
 }
-
@@ -0,0 +1,341 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+namespace OLLMbwrap
+{
+	/**
+	 * Bounded capture of one command output stream (stdout or stderr).
+	 *
+	 * Keeps the first {@link head_lines} lines and a ring of the last
+	 * {@link tail_lines}; everything in between is only counted. Lines are
+	 * clipped to {@link max_line_bytes} while reading, so memory stays
+	 * under (head_lines + tail_lines + 1) * max_line_bytes however much the
+	 * command prints.
+	 *
+	 * {@link progress} reports the latest line at most once per
+	 * {@link progress_interval_ms}, for live display while the command runs.
+	 *
+	 * {{{
+	 * var out_cap = new OutputCapture();
+	 * var err_cap = new OutputCapture();
+	 * out_cap.progress.connect((line) => { ... });
+	 * yield OutputCapture.collect(subprocess, out_cap, err_cap);
+	 * var text = out_cap.to_text();
+	 * }}}
+	 */
+	public class OutputCapture : GLib.Object
+	{
+		/** After the process exits, how long to keep reading pipes a background child still holds open. */
+		private const uint DRAIN_MS = 200;
+
+		/** Lines kept from the start of the output. */
+		public int head_lines { get; set; default = 50; }
+
+		/** Lines kept from the end of the output. */
+		public int tail_lines { get; set; default = 50; }
+
+		/** Longer lines are cut to this many bytes (at a UTF-8 boundary) and marked with "…". */
+		public int max_line_bytes { get; set; default = 2000; }
+
+		/** Minimum gap between {@link progress} emissions. */
+		public int progress_interval_ms { get; set; default = 250; }
+
+		/** Lines seen so far (including omitted ones). */
+		public int64 total_lines { get; private set; default = 0; }
+
+		/** Bytes seen so far (including omitted ones). */
+		public int64 total_bytes { get; private set; default = 0; }
+
+		/** True once the stream hit EOF (or reading stopped). */
+		public bool finished { get; private set; default = false; }
+
+		/**
+		 * Rate-limited live update: the most recent complete line.
+		 * Read {@link total_lines} for the count.
+		 */
+		public signal void progress(string line);
+
+		private Gee.ArrayList<string> head = new Gee.ArrayList<string>();
+		private string[] tail = {};
+		private int tail_next = 0;
+		private int tail_count = 0;
+		private GLib.StringBuilder partial = new GLib.StringBuilder();
+		private bool partial_clipped = false;
+		/** Some line was cut at {@link max_line_bytes}. */
+		private bool clipped = false;
+		private string last_line = "";
+		private bool last_sent = true;
+		private int64 last_progress = 0;
+		private GLib.SourceFunc? finish_waiter = null;
+
+		public OutputCapture()
+		{
+		}
+
+		/**
+		 * Clear captured state so the instance can be reused for another run.
+		 */
+		public void reset()
+		{
+			this.head.clear();
+			this.tail = {};
+			this.tail_next = 0;
+			this.tail_count = 0;
+			this.partial.truncate(0);
+			this.partial_clipped = false;
+			this.clipped = false;
+			this.last_line = "";
+			this.last_sent = true;
+			this.last_progress = 0;
+			this.total_lines = 0;
+			this.total_bytes = 0;
+			this.finished = false;
+		}
+
+		/**
+		 * Feed raw bytes; complete lines are stored, a trailing partial line
+		 * is held (clipped) until its newline or {@link finish}.
+		 */
+		public void add(uint8[] data)
+		{
+			this.total_bytes += data.length;
+			var start = 0;
+			for (var i = 0; i < data.length; i++) {
+				if (data[i] != '\n') {
+					continue;
+				}
+				this.append_partial(data[start:i]);
+				this.end_line();
+				start = i + 1;
+			}
+			if (start < data.length) {
+				this.append_partial(data[start:data.length]);
+			}
+		}
+
+		/**
+		 * Flush any unterminated last line and send a final {@link progress}
+		 * if the last line was not reported yet.
+		 */
+		public void finish()
+		{
+			if (this.partial.len > 0 || this.partial_clipped) {
+				this.end_line();
+			}
+			if (!this.last_sent) {
+				this.last_sent = true;
+				this.progress(this.last_line);
+			}
+			this.finished = true;
+			if (this.finish_waiter != null) {
+				GLib.Idle.add((owned) this.finish_waiter);
+			}
+		}
+
+		/**
+		 * Read stream to EOF (or until cancel fires), then {@link finish}.
+		 * Read errors end the capture with whatever arrived.
+		 */
+		public async void read(GLib.InputStream? stream, GLib.Cancellable? cancel = null)
+		{
+			if (stream == null) {
+				this.finish();
+				return;
+			}
+			var buf = new uint8[8192];
+			try {
+				while (true) {
+					var n = yield stream.read_async(buf, GLib.Priority.DEFAULT, cancel);
+					if (n <= 0) {
+						break;
+					}
+					this.add(buf[0:n]);
+				}
+			} catch (GLib.Error e) {
+				if (!(e is GLib.IOError.CANCELLED)) {
+					GLib.debug("OutputCapture: read stopped: %s", e.message);
+				}
+			}
+			this.finish();
+		}
+
+		/**
+		 * Read stdout and stderr of subprocess concurrently while waiting for
+		 * it to exit. Once it has exited, pipes still held open by a
+		 * background child are given {@link DRAIN_MS} and then abandoned.
+		 *
+		 * Exit status is left for the caller (subprocess has been waited;
+		 * see {@link exit_code}).
+		 *
+		 * @throws Error if waiting for the process fails
+		 */
+		public static async void collect(
+			GLib.Subprocess subprocess,
+			OutputCapture out_cap,
+			OutputCapture err_cap) throws Error
+		{
+			var cancel = new GLib.Cancellable();
+			out_cap.read.begin(subprocess.get_stdout_pipe(), cancel);
+			err_cap.read.begin(subprocess.get_stderr_pipe(), cancel);
+			try {
+				yield subprocess.wait_async(null);
+			} catch (GLib.Error e) {
+				cancel.cancel();
+				throw e;
+			}
+			if (out_cap.finished && err_cap.finished) {
+				return;
+			}
+			var timer = GLib.Timeout.add(DRAIN_MS, () => {
+				cancel.cancel();
+				return false;
+			});
+			yield out_cap.wait_finished();
+			yield err_cap.wait_finished();
+			if (!cancel.is_cancelled()) {
+				GLib.Source.remove(timer);
+			}
+		}
+
+		/**
+		 * Exit status of a waited subprocess in shell terms: its exit code,
+		 * or 128 + the signal number when a signal killed it
+		 * (get_exit_status() is only valid after a normal exit).
+		 */
+		public static int exit_code(GLib.Subprocess subprocess)
+		{
+			if (subprocess.get_if_exited()) {
+				return subprocess.get_exit_status();
+			}
+			if (subprocess.get_if_signaled()) {
+				return 128 + subprocess.get_term_sig();
+			}
+			return -1;
+		}
+
+		private async void wait_finished()
+		{
+			if (this.finished) {
+				return;
+			}
+			this.finish_waiter = this.wait_finished.callback;
+			yield;
+		}
+
+		/**
+		 * Captured text: head lines, a marker with the omitted line count when
+		 * the output overflowed, then tail lines. No trailing newline.
+		 */
+		public string to_text()
+		{
+			var ret = new GLib.StringBuilder();
+			foreach (var line in this.head) {
+				if (ret.len > 0) {
+					ret.append_c('\n');
+				}
+				ret.append(line);
+			}
+			var omitted = this.total_lines - this.head.size - this.tail_count;
+			if (omitted > 0) {
+				ret.append("\n\n// ... (output truncated: %lld of %lld lines omitted) ...\n".printf(
+					omitted, this.total_lines));
+			}
+			// ring is in insertion order until it first fills
+			var first = this.tail.length < this.tail_lines ? 0 : this.tail_next;
+			for (var i = 0; i < this.tail_count; i++) {
+				if (ret.len > 0) {
+					ret.append_c('\n');
+				}
+				ret.append(this.tail[(first + i) % this.tail.length]);
+			}
+			return ret.str;
+		}
+
+		/** True when lines were omitted or clipped. */
+		public bool truncated {
+			get {
+				return this.clipped || this.total_lines > this.head.size + this.tail_count;
+			}
+		}
+
+		private void append_partial(uint8[] bytes)
+		{
+			if (bytes.length == 0) {
+				return;
+			}
+			var room = this.max_line_bytes - (int) this.partial.len;
+			if (room <= 0) {
+				this.partial_clipped = true;
+				return;
+			}
+			if (bytes.length > room) {
+				this.partial.append_len((string) bytes, room);
+				this.partial_clipped = true;
+				return;
+			}
+			this.partial.append_len((string) bytes, bytes.length);
+		}
+
+		private void end_line()
+		{
+			var line = this.partial.str;
+			if (line.has_suffix("\r")) {
+				line = line.substring(0, line.length - 1);
+			}
+			if (this.partial_clipped) {
+				this.clipped = true;
+				line = line.make_valid() + "…";
+			} else if (!line.validate()) {
+				line = line.make_valid();
+			}
+			this.partial.truncate(0);
+			this.partial_clipped = false;
+			this.total_lines++;
+			this.store(line);
+
+			this.last_line = line;
+			this.last_sent = false;
+			var now = GLib.get_monotonic_time();
+			if (now - this.last_progress < (int64) this.progress_interval_ms * 1000) {
+				return;
+			}
+			this.last_progress = now;
+			this.last_sent = true;
+			this.progress(line);
+		}
+
+		private void store(string line)
+		{
+			if (this.head.size < this.head_lines) {
+				this.head.add(line);
+				return;
+			}
+			if (this.tail_lines <= 0) {
+				return;
+			}
+			if (this.tail.length < this.tail_lines) {
+				this.tail += line;
+				this.tail_count++;
+				this.tail_next = this.tail.length % this.tail_lines;
+				return;
+			}
+			this.tail[this.tail_next] = line;
+			this.tail_next = (this.tail_next + 1) % this.tail_lines;
+		}
+	}
+}
@@ -20,6 +20,20 @@ namespace OLLMbwrap
 {
 	/**
 	 * Overlay filesystem creation, directory layout, and cleanup for sandbox runs.
+	 *
+	 * == Warm overlay ==
+	 *
+	 * With {@link keep_warm}, one Overlay is reused for consecutive runs:
+	 * {@link cleanup} keeps the upper layer and the next {@link Scan.run}
+	 * skips entries that were already applied and have not changed, so a
+	 * second command after ''npm install'' does not re-apply node_modules.
+	 * Before each reuse {@link create} drops upper-layer entries whose live
+	 * file changed outside the sandbox, so the sandbox never sees an
+	 * older copy. Call {@link release} when the session or project ends.
+	 *
+	 * Each overlay directory holds an ''owner'' file with the creating
+	 * process id; {@link remove_stale} deletes directories whose owner is
+	 * gone (a crash, or an exit that could not finish the cleanup).
 	 */
 	public class Overlay : GLib.Object
 	{
@@ -59,6 +73,16 @@ namespace OLLMbwrap
 		 */
 		public Scan scan { get; private set; }
 
+		/**
+		 * Keep the upper layer between runs (see class docs). Set before the
+		 * first {@link create}.
+		 */
+		public bool keep_warm { get; set; default = false; }
+
+		/** Upper-layer entries applied so far (warm overlay only). */
+		private Gee.HashMap<string, AppliedEntry> applied =
+			new Gee.HashMap<string, AppliedEntry> ();
+
 		public Overlay (FileVerification verification)
 		{
 			Object (verification: verification);
@@ -89,10 +113,19 @@ namespace OLLMbwrap
 			if (this.project_path == "" || this.write_roots.size == 0) {
 				return;
 			}
+			if (this.scan != null) {
+				// warm reuse: layout exists, only drop stale entries
+				this.invalidate_stale();
+				return;
+			}
 
 			try {
 				GLib.File.new_for_path(this.overlay_dir)
 					.make_directory_with_parents(null);
+				GLib.FileUtils.set_contents(
+					GLib.Path.build_filename(this.overlay_dir, "owner"),
+					((int) Posix.getpid()).to_string()
+				);
 
 				GLib.File.new_for_path(
 					GLib.Path.build_filename(this.overlay_dir, "upper")
@@ -134,6 +167,9 @@ namespace OLLMbwrap
 				);
 				this.scan.overlay_map = this.overlay_map;
 				this.scan.project_path = this.project_path;
+				if (this.keep_warm) {
+					this.scan.applied = this.applied;
+				}
 			} catch (GLib.Error e) {
 				throw new GLib.IOError.FAILED(
 					"Cannot create overlay directory structure: " + e.message
@@ -144,9 +180,27 @@ namespace OLLMbwrap
 		/**
 		 * Remove overlay directory tree after {@link Scan.run} completes.
 		 *
-		 * Failures are logged; this method does not throw.
+		 * No-op for a warm overlay (see {@link release}). The tree is renamed
+		 * aside and deleted on a worker thread, so large upper layers do not
+		 * delay the command result. Failures are logged; this method does
+		 * not throw.
 		 */
 		public void cleanup()
+		{
+			if (this.keep_warm) {
+				return;
+			}
+			this.release();
+		}
+
+		/**
+		 * Remove the overlay tree even when {@link keep_warm} is set; the
+		 * next {@link create} starts from an empty upper layer.
+		 *
+		 * @param wait delete before returning instead of on a worker thread
+		 *   (application shutdown, where the thread would not finish)
+		 */
+		public void release(bool wait = false)
 		{
 			if (this.project_path == "" || this.overlay_map.size == 0) {
 				return;
@@ -154,36 +208,157 @@ namespace OLLMbwrap
 			if (this.scan == null) {
 				return;
 			}
+			this.applied.clear();
+			this.overlay_map.clear();
+			var scan = this.scan;
+			this.scan = null;
 
-			try {
-				this.scan.recursive_delete(
-					GLib.Path.build_filename(this.overlay_dir, "upper")
-				);
-			} catch (GLib.Error e) {
+			var trash = this.overlay_dir + ".trash-" + GLib.get_monotonic_time().to_string();
+			if (GLib.FileUtils.rename(this.overlay_dir, trash) != 0) {
 				GLib.warning(
-					"Failed to delete upper directory: %s",
-					e.message
+					"Failed to move overlay directory aside: %s",
+					GLib.strerror(GLib.errno)
 				);
+				trash = this.overlay_dir;
+			}
+			if (wait) {
+				try {
+					scan.recursive_delete(trash);
+				} catch (GLib.Error e) {
+					GLib.warning(
+						"Failed to delete overlay directory %s: %s",
+						trash,
+						e.message
+					);
+				}
+				return;
 			}
+			new Thread<bool>("overlay-cleanup", () => {
+				try {
+					scan.recursive_delete(trash);
+				} catch (GLib.Error e) {
+					GLib.warning(
+						"Failed to delete overlay directory %s: %s",
+						trash,
+						e.message
+					);
+				}
+				return true;
+			});
+		}
 
+		/**
+		 * Delete ''overlay-*'' directories under the user cache left behind
+		 * by processes that are no longer running, on a worker thread.
+		 * Directories without an ''owner'' file predate it and are removed
+		 * too. Call once at startup.
+		 */
+		public static void remove_stale()
+		{
+			var cache_dir = GLib.Path.build_filename(
+				GLib.Environment.get_user_cache_dir(),
+				"ollmchat"
+			);
+			new Thread<bool>("overlay-stale", () => {
+				var scan = new Scan(new NoOpFileVerification());
+				try {
+					var enumerator = GLib.File.new_for_path(cache_dir).enumerate_children(
+						GLib.FileAttribute.STANDARD_NAME + ","
+							+ GLib.FileAttribute.STANDARD_TYPE,
+						GLib.FileQueryInfoFlags.NOFOLLOW_SYMLINKS,
+						null
+					);
+					GLib.FileInfo? info;
+					while ((info = enumerator.next_file(null)) != null) {
+						if (!info.get_name().has_prefix("overlay-")
+								|| info.get_file_type() != GLib.FileType.DIRECTORY) {
+							continue;
+						}
+						var path = GLib.Path.build_filename(cache_dir, info.get_name());
+						if (Overlay.owner_running(path)) {
+							continue;
+						}
+						try {
+							scan.recursive_delete(path);
+						} catch (GLib.Error e) {
+							GLib.warning(
+								"Failed to delete stale overlay %s: %s",
+								path,
+								e.message
+							);
+						}
+					}
+				} catch (GLib.Error e) {
+					// no cache directory yet
+				}
+				return true;
+			});
+		}
+
+		/** Whether the process recorded in dir's ''owner'' file is running. */
+		private static bool owner_running(string dir)
+		{
+			string contents;
 			try {
-				this.scan.recursive_delete(
-					GLib.Path.build_filename(this.overlay_dir, "work")
+				GLib.FileUtils.get_contents(
+					GLib.Path.build_filename(dir, "owner"),
+					out contents
 				);
 			} catch (GLib.Error e) {
-				GLib.warning(
-					"Failed to delete work directory: %s",
-					e.message
-				);
+				return false;
+			}
+			int64 pid;
+			if (!int64.try_parse(contents.strip(), out pid) || pid <= 0) {
+				return false;
 			}
+			return GLib.FileUtils.test("/proc/" + pid.to_string(), GLib.FileTest.EXISTS);
+		}
 
-			try {
-				GLib.FileUtils.remove(this.overlay_dir);
-			} catch (GLib.Error e) {
-				GLib.warning(
-					"Failed to remove overlay directory: %s",
-					e.message
-				);
+		/**
+		 * Whether a live path that was applied from the upper layer changed
+		 * since. A mounted overlay must not be edited underneath, so a
+		 * {@link Worker} restarts its sandbox when this is true.
+		 */
+		public bool has_stale()
+		{
+			return this.scan != null && this.stale_entries().size > 0;
+		}
+
+		private Gee.ArrayList<string> stale_entries()
+		{
+			var stale = new Gee.ArrayList<string>();
+			foreach (var e in this.applied.entries) {
+				if (AppliedEntry.live(this.scan, e.value.real_path, e.value.is_dir)
+						!= e.value.live_stamp) {
+					stale.add(e.key);
+				}
+			}
+			return stale;
+		}
+
+		/**
+		 * Warm reuse: remove upper-layer entries whose live path changed
+		 * since it was applied (edited, replaced or deleted outside the
+		 * sandbox), so the lower layer shows through again.
+		 */
+		private void invalidate_stale()
+		{
+			var stale = this.stale_entries();
+			// deepest first so directories are empty when removed
+			stale.sort((a, b) => b.length - a.length);
+			foreach (var upper_path in stale) {
+				this.applied.unset(upper_path);
+				try {
+					var f = GLib.File.new_for_path(upper_path);
+					if (f.query_file_type(GLib.FileQueryInfoFlags.NOFOLLOW_SYMLINKS, null)
+							== GLib.FileType.DIRECTORY) {
+						this.scan.recursive_delete(upper_path);
+						continue;
+					}
+					f.delete(null);
+				} catch (GLib.Error e) {
+					GLib.debug("Cannot drop stale overlay entry %s: %s", upper_path, e.message);
+				}
 			}
 		}
 	}
@@ -399,6 +399,19 @@ To enable networking on a later run, pass \"network\": true in run_command (user
 			}
 		}
 
+		/**
+		 * Forget network/fs evidence gathered so far; used between commands
+		 * of a long-lived {@link Worker} sandbox. Handshake state is kept.
+		 */
+		public void reset_evidence ()
+		{
+			this.count_socket = 0;
+			this.count_connect = 0;
+			this.file_writes.clear();
+			this.network = "";
+			this.fs = "";
+		}
+
 		/**
 		 * Remove fd source and close fds (safe from exec finally if spawn failed early).
 		 */
@@ -25,9 +25,32 @@ namespace OLLMbwrap
 	 * Detects additions, modifications, and deletions (whiteouts). The walk loop
 	 * and created/modified/removed decisions stay here; implementations apply
 	 * each change.
+	 *
+	 * Each directory is read with one enumeration (type, rdev and times
+	 * together, so whiteouts need no extra stat). Its entries are applied
+	 * concurrently, up to {@link max_parallel} at a time, and the walk only
+	 * descends once the directory's own entries are done so parents always
+	 * exist before children. Entries under a directory the command created
+	 * cannot be indexed yet, so their {@link FileVerification.has_file}
+	 * lookups are skipped.
+	 *
+	 * When {@link applied} is set (warm overlay, see {@link Overlay.keep_warm}),
+	 * entries whose upper-layer stamp matches the last run are skipped and
+	 * the stamps of newly applied entries are recorded.
 	 */
 	public class Scan : Object
 	{
+		/** Enumerator attributes for one walk step. */
+		private const string ATTRS = GLib.FileAttribute.STANDARD_NAME + ","
+			+ GLib.FileAttribute.STANDARD_TYPE + ","
+			+ GLib.FileAttribute.STANDARD_IS_SYMLINK + ","
+			+ GLib.FileAttribute.STANDARD_SIZE + ","
+			+ GLib.FileAttribute.UNIX_RDEV + ","
+			+ GLib.FileAttribute.TIME_MODIFIED + ","
+			+ GLib.FileAttribute.TIME_MODIFIED_USEC + ","
+			+ GLib.FileAttribute.TIME_CHANGED + ","
+			+ GLib.FileAttribute.TIME_CHANGED_USEC;
+
 		/**
 		 * Overlay upper directory base path.
 		 *
@@ -49,6 +72,25 @@ namespace OLLMbwrap
 
 		public FileVerification verification { get; construct; }
 
+		/** Most {@link FileVerification} calls in flight at once. */
+		public int max_parallel { get; set; default = 8; }
+
+		/**
+		 * Warm-overlay bookkeeping: upper-layer path to {@link AppliedEntry}
+		 * for entries already applied by an earlier run; null when the
+		 * overlay is thrown away after each run.
+		 */
+		public Gee.HashMap<string, AppliedEntry>? applied { get; set; default = null; }
+
+		private int in_flight = 0;
+		private Gee.ArrayQueue<Waiter> slot_waiters = new Gee.ArrayQueue<Waiter> ();
+		private Waiter? drain_waiter = null;
+
+		private class Waiter
+		{
+			public GLib.SourceFunc resume;
+		}
+
 		/**
 		 * @param verification Apply hook for overlay changes
 		 */
@@ -69,29 +111,30 @@ namespace OLLMbwrap
 			foreach (var entry in this.overlay_map.entries) {
 				yield this.scan_dir(
 					GLib.Path.build_filename(this.base_path, entry.key),
-					entry.value
+					entry.value,
+					false
 				);
 			}
 
 			yield this.verification.finish();
 		}
 
-		private async void scan_dir(string overlay_path, string real_path)
+		/**
+		 * @param parent_new real_path did not exist in the index before this run,
+		 *     so nothing under it can be indexed either
+		 */
+		private async void scan_dir(string overlay_path, string real_path, bool parent_new)
 		{
 			var overlay_dir = GLib.File.new_for_path(overlay_path);
-			if (!GLib.FileUtils.test(overlay_dir.get_path(), GLib.FileTest.EXISTS)) {
-				return;
-			}
-
 			GLib.FileEnumerator enumerator;
 			try {
 				enumerator = overlay_dir.enumerate_children(
-					GLib.FileAttribute.STANDARD_NAME + ","
-						+ GLib.FileAttribute.STANDARD_TYPE + ","
-						+ GLib.FileAttribute.STANDARD_IS_SYMLINK,
-					GLib.FileQueryInfoFlags.NONE,
+					ATTRS,
+					GLib.FileQueryInfoFlags.NOFOLLOW_SYMLINKS,
 					null
 				);
+			} catch (GLib.IOError.NOT_FOUND e) {
+				return;
 			} catch (GLib.Error e) {
 				GLib.warning(
 					"Cannot enumerate overlay directory %s: %s",
@@ -102,73 +145,137 @@ namespace OLLMbwrap
 			}
 
 			var folders_list = new Gee.ArrayList<string>();
+			var folders_new = new Gee.HashSet<string>();
 			GLib.FileInfo? file_info;
-			while ((file_info = enumerator.next_file(null)) != null) {
-				var item_overlay_path = GLib.Path.build_filename(
-					overlay_path,
-					file_info.get_name()
-				);
-				var actual_real_path = this.to_real_path(item_overlay_path);
-				var indexed = yield this.verification.has_file(
-					actual_real_path
-				);
-
-				if (file_info.get_file_type() == GLib.FileType.DIRECTORY) {
-					folders_list.add(item_overlay_path);
-					yield this.handle_folder(
-						item_overlay_path,
-						actual_real_path,
-						indexed
+			try {
+				while ((file_info = enumerator.next_file(null)) != null) {
+					var item_overlay_path = GLib.Path.build_filename(
+						overlay_path,
+						file_info.get_name()
 					);
-					continue;
-				}
-
-				if (file_info.get_is_symlink()) {
-					yield this.handle_filealias(
+					var item_real_path = GLib.Path.build_filename(
+						real_path,
+						file_info.get_name()
+					);
+					var is_dir = file_info.get_file_type() == GLib.FileType.DIRECTORY;
+					if (is_dir) {
+						folders_list.add(item_overlay_path);
+					}
+					var stamp = this.stamp(file_info);
+					if (this.applied != null) {
+						var prev = this.applied.get(item_overlay_path);
+						if (prev != null && prev.upper_stamp == stamp) {
+							continue;
+						}
+					}
+					yield this.acquire_slot();
+					this.apply_entry.begin(
+						file_info,
 						item_overlay_path,
-						actual_real_path,
-						indexed
+						item_real_path,
+						parent_new,
+						stamp,
+						folders_new,
+						(obj, res) => {
+							this.apply_entry.end(res);
+							this.release_slot();
+						}
 					);
-					continue;
 				}
-
-				yield this.handle_file(
-					item_overlay_path,
-					actual_real_path,
-					indexed
+			} catch (GLib.Error e) {
+				GLib.warning(
+					"Cannot read overlay directory %s: %s",
+					overlay_path,
+					e.message
 				);
 			}
+			// children need their parent folders applied first
+			yield this.drain();
 
 			foreach (var folder_overlay_path in folders_list) {
 				yield this.scan_dir(
 					folder_overlay_path,
-					this.to_real_path(folder_overlay_path)
+					GLib.Path.build_filename(
+						real_path,
+						GLib.Path.get_basename(folder_overlay_path)
+					),
+					folders_new.contains(folder_overlay_path)
 				);
 			}
 		}
 
-		private async void handle_file(
+		/**
+		 * Decide and apply one upper-layer entry. Adds directories that did
+		 * not exist in the index to folders_new.
+		 */
+		private async void apply_entry(
+			GLib.FileInfo file_info,
+			string overlay_path,
+			string real_path,
+			bool parent_new,
+			string stamp,
+			Gee.HashSet<string> folders_new)
+		{
+			var indexed = GLib.FileType.UNKNOWN;
+			if (!parent_new) {
+				indexed = yield this.verification.has_file(real_path);
+			}
+
+			switch (file_info.get_file_type()) {
+				case GLib.FileType.DIRECTORY:
+					if (indexed != GLib.FileType.DIRECTORY) {
+						folders_new.add(overlay_path);
+					}
+					yield this.handle_folder(overlay_path, real_path, indexed);
+					break;
+
+				case GLib.FileType.SPECIAL:
+					if (file_info.get_attribute_uint32(GLib.FileAttribute.UNIX_RDEV) == 0) {
+						yield this.handle_whiteout(overlay_path, real_path, indexed);
+						break;
+					}
+					yield this.handle_file(overlay_path, real_path, indexed);
+					break;
+
+				default:
+					if (file_info.get_is_symlink()) {
+						yield this.handle_filealias(overlay_path, real_path, indexed);
+						break;
+					}
+					yield this.handle_file(overlay_path, real_path, indexed);
+					break;
+			}
+			if (this.applied != null) {
+				this.applied.set(overlay_path, new AppliedEntry(this, real_path, stamp,
+					file_info.get_file_type() == GLib.FileType.DIRECTORY));
+			}
+		}
+
+		private async void handle_whiteout(
 			string overlay_path,
 			string real_path,
 			GLib.FileType indexed)
 		{
-			if (this.is_whiteout(overlay_path)) {
-				if (indexed != GLib.FileType.UNKNOWN) {
-					yield this.verification.removed(
-						indexed,
-						real_path,
-						overlay_path
-					);
-					return;
-				}
-				GLib.warning(
-					"Whiteout detected but path not indexed: overlay=%s real=%s",
-					overlay_path,
-					real_path
+			if (indexed != GLib.FileType.UNKNOWN) {
+				yield this.verification.removed(
+					indexed,
+					real_path,
+					overlay_path
 				);
 				return;
 			}
+			GLib.warning(
+				"Whiteout detected but path not indexed: overlay=%s real=%s",
+				overlay_path,
+				real_path
+			);
+		}
 
+		private async void handle_file(
+			string overlay_path,
+			string real_path,
+			GLib.FileType indexed)
+		{
 			if (
 				indexed != GLib.FileType.UNKNOWN
 				&& indexed != GLib.FileType.REGULAR
@@ -258,62 +365,59 @@ namespace OLLMbwrap
 			);
 		}
 
-		private bool is_whiteout(string overlay_path)
+		/**
+		 * Identity of an upper-layer entry: type, size, mtime and ctime.
+		 * ctime catches chmod and rename-over that keep mtime.
+		 */
+		internal string stamp(GLib.FileInfo info)
 		{
-			try {
-				var file = GLib.File.new_for_path(overlay_path);
-				if (!GLib.FileUtils.test(file.get_path(), GLib.FileTest.EXISTS)) {
-					return false;
-				}
-
-				var info = file.query_info(
-					GLib.FileAttribute.UNIX_RDEV + ","
-						+ GLib.FileAttribute.STANDARD_TYPE,
-					GLib.FileQueryInfoFlags.NONE,
-					null
-				);
-
-				if (info.get_file_type() != GLib.FileType.SPECIAL) {
-					return false;
-				}
-
-				return info.get_attribute_uint32(
-					GLib.FileAttribute.UNIX_RDEV
-				) == 0;
-			} catch (GLib.Error e) {
-				return false;
-			}
+			return "%d:%lld:%llu.%u:%llu.%u".printf(
+				(int) info.get_file_type(),
+				info.get_size(),
+				info.get_attribute_uint64(GLib.FileAttribute.TIME_MODIFIED),
+				info.get_attribute_uint32(GLib.FileAttribute.TIME_MODIFIED_USEC),
+				info.get_attribute_uint64(GLib.FileAttribute.TIME_CHANGED),
+				info.get_attribute_uint32(GLib.FileAttribute.TIME_CHANGED_USEC)
+			);
 		}
 
-		private string to_real_path(string overlay_path)
+		private async void acquire_slot()
 		{
-			if (!overlay_path.has_prefix(this.base_path)) {
-				return overlay_path;
-			}
-
-			var relative_path = overlay_path.substring(this.base_path.length);
-
-			if (relative_path.has_prefix("/")) {
-				relative_path = relative_path.substring(1);
+			if (this.in_flight < int.max(1, this.max_parallel)) {
+				this.in_flight++;
+				return;
 			}
+			var w = new Waiter();
+			w.resume = this.acquire_slot.callback;
+			this.slot_waiters.offer(w);
+			yield;
+		}
 
-			if (relative_path == "") {
-				return overlay_path;
+		/** Hand the slot to the next queued entry, or free it. */
+		private void release_slot()
+		{
+			var w = this.slot_waiters.poll();
+			if (w != null) {
+				GLib.Idle.add((owned) w.resume);
+				return;
 			}
-
-			var components = relative_path.split("/", 2);
-
-			if (!this.overlay_map.has_key(components[0])) {
-				return overlay_path;
+			this.in_flight--;
+			if (this.in_flight == 0 && this.drain_waiter != null) {
+				var d = this.drain_waiter;
+				this.drain_waiter = null;
+				GLib.Idle.add((owned) d.resume);
 			}
+		}
 
-			if (components.length > 1) {
-				return GLib.Path.build_filename(
-					this.overlay_map.get(components[0]),
-					components[1]
-				);
+		/** Wait until every started entry has been applied. */
+		private async void drain()
+		{
+			if (this.in_flight == 0) {
+				return;
 			}
-			return this.overlay_map.get(components[0]);
+			this.drain_waiter = new Waiter();
+			this.drain_waiter.resume = this.drain.callback;
+			yield;
 		}
 
 		/**
@@ -341,10 +445,11 @@ namespace OLLMbwrap
 				);
 			}
 
+			// never follow links: a symlink to a live directory must not be descended
 			var enumerator = dir.enumerate_children(
 				GLib.FileAttribute.STANDARD_NAME + ","
 					+ GLib.FileAttribute.STANDARD_TYPE,
-				GLib.FileQueryInfoFlags.NONE,
+				GLib.FileQueryInfoFlags.NOFOLLOW_SYMLINKS,
 				null
 			);
 
@@ -364,4 +469,51 @@ namespace OLLMbwrap
 			dir.delete(null);
 		}
 	}
+
+	/**
+	 * One upper-layer entry applied by a warm {@link Scan}: its stamp in the
+	 * upper layer and the live path's stamp right after apply, so
+	 * {@link Overlay.create} can tell when the live file changed outside
+	 * the sandbox.
+	 *
+	 * Directories only record that the live directory exists: applying
+	 * their children changes the directory's own mtime / ctime, and the
+	 * children carry their own entries.
+	 */
+	public class AppliedEntry
+	{
+		public string real_path;
+		public string upper_stamp;
+		public string live_stamp;
+		public bool is_dir;
+
+		public AppliedEntry(Scan scan, string real_path, string upper_stamp, bool is_dir)
+		{
+			this.real_path = real_path;
+			this.upper_stamp = upper_stamp;
+			this.is_dir = is_dir;
+			this.live_stamp = AppliedEntry.live(scan, real_path, is_dir);
+		}
+
+		/**
+		 * Stamp of the live path, or "" when it does not exist; for a
+		 * directory just "dir" while it is one.
+		 */
+		public static string live(Scan scan, string real_path, bool is_dir)
+		{
+			try {
+				var info = GLib.File.new_for_path(real_path).query_info(
+					"standard::*,time::*",
+					GLib.FileQueryInfoFlags.NOFOLLOW_SYMLINKS,
+					null
+				);
+				if (is_dir) {
+					return info.get_file_type() == GLib.FileType.DIRECTORY ? "dir" : "";
+				}
+				return scan.stamp(info);
+			} catch (GLib.Error e) {
+				return "";
+			}
+		}
+	}
 }
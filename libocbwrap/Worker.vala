@@ -0,0 +1,470 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+namespace OLLMbwrap
+{
+	/**
+	 * Long-lived sandbox that runs consecutive commands of one session.
+	 *
+	 * {@link Bubble.exec} spawns bwrap, installs seccomp and mounts the
+	 * overlay for every command. A Worker does that once and runs a small
+	 * /bin/sh command server inside ({@link SERVER}); each command is sent
+	 * over its stdin and runs in the existing namespace and (warm) overlay.
+	 * Output comes back on the server's stdout and stderr, each ended by a
+	 * random per-command boundary line, into the {@link bubble} captures.
+	 *
+	 * Commands run one at a time. A caller that shares the worker takes the
+	 * turn ({@link acquire_turn}), sets the profile on {@link bubble}
+	 * (project_path, allow_network, write_tokens, write_roots) and connects
+	 * to the captures, then runs {@link exec_held} and hands the turn back
+	 * ({@link release_turn}). When the profile differs from the running
+	 * sandbox, or a live file that was applied from the overlay changed
+	 * outside it ({@link Overlay.has_stale}), the sandbox is recycled first.
+	 *
+	 * {{{
+	 * var worker = new Worker(new Overlay(verification));
+	 * yield worker.acquire_turn();
+	 * try {
+	 *     worker.bubble.project_path = project.path;
+	 *     worker.bubble.write_roots = roots;
+	 *     var out = yield worker.exec_held("git status", "");
+	 * } finally {
+	 *     worker.release_turn();
+	 * }
+	 * ...
+	 * worker.release(); // session ended
+	 * }}}
+	 */
+	public class Worker : GLib.Object
+	{
+		/**
+		 * Command server (run by /bin/sh -c). Per command it reads a boundary
+		 * line, the working directory, then command lines up to the boundary.
+		 */
+		private const string SERVER = """
+while IFS= read -r b; do
+	IFS= read -r d
+	c=
+	while IFS= read -r l; do
+		[ "$l" = "$b" ] && break
+		c="$c$l
+"
+	done
+	(cd -- "$d" && exec /bin/sh -c "$c") </dev/null
+	s=$?
+	printf '\n%s %d\n' "$b" "$s"
+	printf '\n%s\n' "$b" >&2
+done
+""";
+
+		/**
+		 * Sandbox profile, overlay and output captures for every command.
+		 */
+		public Bubble bubble { get; private set; }
+
+		/**
+		 * Seconds a command may run before the sandbox is stopped and
+		 * {@link exec_held} throws IOError.TIMED_OUT; 0 means no limit.
+		 */
+		public uint timeout_seconds { get; set; default = 0; }
+
+		/** True while a caller holds the turn (a command is running or being set up). */
+		public bool is_busy {
+			get {
+				return this.busy;
+			}
+		}
+
+		/** True while the sandbox process is up. */
+		public bool is_running {
+			get {
+				return this.process != null && !this.exited;
+			}
+		}
+
+		private GLib.Subprocess? process = null;
+		private bool exited = false;
+		private RunSeccomp? run_seccomp = null;
+		private GLib.OutputStream? input = null;
+		private Frames? out_frames = null;
+		private Frames? err_frames = null;
+		/** {@link policy_key} the running sandbox was started with. */
+		private string policy = "";
+
+		private bool busy = false;
+		private Gee.ArrayQueue<Waiter> turn_waiters = new Gee.ArrayQueue<Waiter> ();
+
+		private class Waiter
+		{
+			public GLib.SourceFunc resume;
+		}
+
+		/**
+		 * One output pipe of the server, read frame by frame.
+		 */
+		private class Frames : GLib.Object
+		{
+			public GLib.InputStream stream;
+			/** Text after the boundary on the stdout frame (exit status). */
+			public string trailer = "";
+			public GLib.Error? error = null;
+			public bool done = true;
+
+			private GLib.ByteArray buf = new GLib.ByteArray();
+			private GLib.SourceFunc? waiter = null;
+
+			public Frames(GLib.InputStream stream)
+			{
+				this.stream = stream;
+			}
+
+			/**
+			 * Feed cap until marker; with a marker ending in a space, the rest
+			 * of that line is kept in {@link trailer}. Bytes after the frame
+			 * stay buffered for the next one.
+			 */
+			public async void read_to(string marker, OutputCapture cap)
+			{
+				this.done = false;
+				this.error = null;
+				this.trailer = "";
+				var want_trailer = marker.has_suffix(" ");
+				var chunk = new uint8[8192];
+				try {
+					while (true) {
+						var at = this.find(marker, 0);
+						if (at < 0) {
+							// keep enough to match a marker split across reads
+							var keep = marker.length - 1;
+							if (this.buf.len > keep) {
+								var n = (int) this.buf.len - keep;
+								cap.add(this.buf.data[0:n]);
+								this.buf.remove_range(0, n);
+							}
+						} else {
+							var end = at + marker.length;
+							var nl = want_trailer ? this.find("\n", end) : end - 1;
+							if (nl >= 0) {
+								cap.add(this.buf.data[0:at]);
+								if (want_trailer) {
+									var t = new GLib.StringBuilder();
+									t.append_len((string) this.buf.data[end:nl], nl - end);
+									this.trailer = t.str;
+								}
+								this.buf.remove_range(0, nl + 1);
+								break;
+							}
+						}
+						var got = yield this.stream.read_async(chunk, GLib.Priority.DEFAULT, null);
+						if (got <= 0) {
+							throw new GLib.IOError.CLOSED("sandbox worker exited");
+						}
+						this.buf.append(chunk[0:got]);
+					}
+				} catch (GLib.Error e) {
+					this.error = e;
+				}
+				this.done = true;
+				if (this.waiter != null) {
+					GLib.Idle.add((owned) this.waiter);
+				}
+			}
+
+			public async void wait_done()
+			{
+				if (this.done) {
+					return;
+				}
+				this.waiter = this.wait_done.callback;
+				yield;
+			}
+
+			private int find(string needle, int from)
+			{
+				unowned uint8[] data = this.buf.data;
+				unowned uint8[] n = needle.data;
+				for (var i = from; i + n.length <= data.length; i++) {
+					if (data[i] != n[0]) {
+						continue;
+					}
+					var j = 1;
+					while (j < n.length && data[i + j] == n[j]) {
+						j++;
+					}
+					if (j == n.length) {
+						return i;
+					}
+				}
+				return -1;
+			}
+		}
+
+		/**
+		 * @param overlay Overlay for the session; it is switched to
+		 *     {@link Overlay.keep_warm} and stays mounted between commands
+		 */
+		public Worker (Overlay overlay)
+		{
+			overlay.keep_warm = true;
+			this.bubble = new Bubble.with_overlay(overlay);
+			this.bubble.die_with_parent = true;
+		}
+
+		/**
+		 * Take the turn, run command and hand the turn back.
+		 *
+		 * Only for callers that do not share the worker; the profile on
+		 * {@link bubble} must already be set.
+		 *
+		 * @see exec_held
+		 */
+		public async string exec(string command, string working_dir = "") throws Error
+		{
+			yield this.acquire_turn();
+			try {
+				return yield this.exec_held(command, working_dir);
+			} finally {
+				this.release_turn();
+			}
+		}
+
+		/**
+		 * Run command in the sandbox, starting or recycling it as needed.
+		 * The caller must hold the turn ({@link acquire_turn}).
+		 *
+		 * Same result format as {@link Bubble.exec}; overlay changes are
+		 * applied after each command while the sandbox keeps running.
+		 *
+		 * @param command Shell command (run via /bin/sh -c)
+		 * @param working_dir Absolute working directory; empty uses the first project root (or home)
+		 * @throws Error if the sandbox cannot be started, exits mid-command
+		 *     or the command runs past {@link timeout_seconds}
+		 */
+		public async string exec_held(string command, string working_dir = "") throws Error
+		{
+			if (!this.busy) {
+				throw new GLib.IOError.FAILED("Sandbox worker turn is not held");
+			}
+			var timed_out = false;
+			uint timer = 0;
+			if (this.timeout_seconds > 0) {
+				timer = GLib.Timeout.add_seconds(this.timeout_seconds, () => {
+					timer = 0;
+					timed_out = true;
+					this.stop();
+					return false;
+				});
+			}
+			try {
+				return yield this.run(command, working_dir);
+			} catch (GLib.Error e) {
+				if (timed_out) {
+					throw new GLib.IOError.TIMED_OUT(
+						"Command timed out after %u seconds".printf(this.timeout_seconds));
+				}
+				throw e;
+			} finally {
+				if (timer != 0) {
+					GLib.Source.remove(timer);
+				}
+			}
+		}
+
+		/**
+		 * Stop the sandbox process; the overlay is kept, so the next
+		 * {@link exec} starts a new sandbox on the same upper layer.
+		 */
+		public void stop()
+		{
+			if (this.process == null) {
+				return;
+			}
+			this.process.force_exit();
+			this.run_seccomp.detach_sources();
+			this.process = null;
+			this.run_seccomp = null;
+			this.input = null;
+			this.out_frames = null;
+			this.err_frames = null;
+			this.policy = "";
+		}
+
+		/**
+		 * Stop the sandbox and delete the overlay (session or project ended).
+		 *
+		 * @param wait delete the overlay before returning (see {@link Overlay.release})
+		 */
+		public void release(bool wait = false)
+		{
+			this.stop();
+			this.bubble.overlay.release(wait);
+		}
+
+		private async string run(string command, string working_dir) throws Error
+		{
+			if (working_dir.contains("\n")) {
+				throw new GLib.IOError.INVALID_ARGUMENT("Invalid working directory");
+			}
+			if (this.process != null && (this.exited
+					|| this.policy_key() != this.policy
+					|| this.bubble.overlay.has_stale())) {
+				this.stop();
+			}
+			if (this.process == null) {
+				this.start();
+			}
+			var cwd = this.chdir_for(working_dir);
+
+			this.bubble.stdout_capture.reset();
+			this.bubble.stderr_capture.reset();
+			this.run_seccomp.reset_evidence();
+
+			var boundary = "--ollmchat-" + GLib.Uuid.string_random();
+			var msg = boundary + "\n" + cwd + "\n" + command + "\n" + boundary + "\n";
+			var out_frames = this.out_frames;
+			var err_frames = this.err_frames;
+			try {
+				size_t written;
+				yield this.input.write_all_async(msg.data, GLib.Priority.DEFAULT, null, out written);
+			} catch (GLib.Error e) {
+				this.stop();
+				throw new GLib.IOError.FAILED("Sandbox worker is not accepting commands: " + e.message);
+			}
+			out_frames.read_to.begin("\n" + boundary + " ", this.bubble.stdout_capture);
+			err_frames.read_to.begin("\n" + boundary + "\n", this.bubble.stderr_capture);
+			yield out_frames.wait_done();
+			yield err_frames.wait_done();
+			this.bubble.stdout_capture.finish();
+			this.bubble.stderr_capture.finish();
+
+			var failed = out_frames.error ?? err_frames.error;
+			if (failed != null) {
+				this.stop();
+				throw new GLib.IOError.FAILED("Sandbox worker failed: " + failed.message);
+			}
+			if (this.bubble.overlay.scan != null) {
+				yield this.bubble.overlay.scan.run();
+			}
+			return this.bubble.format_result(int.parse(out_frames.trailer), this.run_seccomp);
+		}
+
+		private void start() throws Error
+		{
+			var overlay = this.bubble.overlay;
+			overlay.project_path = this.bubble.project_path;
+			overlay.write_roots = this.bubble.write_roots;
+			overlay.create();
+
+			var run_seccomp = new RunSeccomp(this.bubble);
+			var launcher = new GLib.SubprocessLauncher(
+				GLib.SubprocessFlags.STDIN_PIPE |
+				GLib.SubprocessFlags.STDOUT_PIPE |
+				GLib.SubprocessFlags.STDERR_PIPE);
+			run_seccomp.wire_launcher(launcher);
+
+			string[] args;
+			GLib.Subprocess process;
+			try {
+				args = this.bubble.build_bubble_args("");
+				args += "/bin/sh";
+				args += "-c";
+				args += SERVER;
+				GLib.debug("starting sandbox worker: %s", string.joinv(" ", args));
+				process = launcher.spawnv(args);
+			} catch (GLib.Error e) {
+				run_seccomp.detach_sources();
+				throw new GLib.IOError.FAILED("Failed to start sandbox worker: " + e.message);
+			}
+			run_seccomp.finish_handshake();
+			run_seccomp.attach_notify_loop();
+
+			this.process = process;
+			this.exited = false;
+			this.run_seccomp = run_seccomp;
+			this.input = process.get_stdin_pipe();
+			this.out_frames = new Frames(process.get_stdout_pipe());
+			this.err_frames = new Frames(process.get_stderr_pipe());
+			this.policy = this.policy_key();
+
+			// writing to a dead server would raise SIGPIPE; notice exits early
+			process.wait_async.begin(null, (obj, res) => {
+				try {
+					process.wait_async.end(res);
+				} catch (GLib.Error e) {
+					GLib.debug("sandbox worker wait: %s", e.message);
+				}
+				if (this.process == process) {
+					this.exited = true;
+				}
+			});
+		}
+
+		/** Sandbox settings that need a new bwrap process when they change. */
+		private string policy_key()
+		{
+			var roots = new Gee.ArrayList<string>();
+			roots.add_all(this.bubble.write_roots.keys);
+			roots.sort();
+			return string.join("\n",
+				this.bubble.project_path,
+				this.bubble.allow_network.to_string(),
+				string.joinv(":", this.bubble.write_tokens),
+				string.joinv(":", roots.to_array())
+			);
+		}
+
+		/** Same default as the --chdir chosen by {@link Bubble.build_bubble_args}. */
+		private string chdir_for(string working_dir)
+		{
+			if (working_dir != "") {
+				return working_dir;
+			}
+			foreach (var root in this.bubble.overlay.overlay_map.values) {
+				return root;
+			}
+			return GLib.Environment.get_home_dir();
+		}
+
+		/**
+		 * Wait until no other caller is using the worker, then hold it.
+		 * Always pair with {@link release_turn}.
+		 */
+		public async void acquire_turn()
+		{
+			if (!this.busy) {
+				this.busy = true;
+				return;
+			}
+			var w = new Waiter();
+			w.resume = this.acquire_turn.callback;
+			this.turn_waiters.offer(w);
+			yield;
+		}
+
+		/** Hand the sandbox to the next queued caller, or mark it idle. */
+		public void release_turn()
+		{
+			var w = this.turn_waiters.poll();
+			if (w == null) {
+				this.busy = false;
+				return;
+			}
+			GLib.Idle.add((owned) w.resume);
+		}
+	}
+}
@@ -37,11 +37,14 @@ namespace OLLMbwrap
 		public Gee.HashMap<string, string> write_roots {
 			get; set; default = new Gee.HashMap<string, string> ();
 		}
+		public bool die_with_parent { get; set; default = false; }
 		public FileVerification verification { get; construct; }
 		public Overlay overlay { get; private set; }
 		public string bwrap_exe { get; private set; default = ""; }
 		public string ret_str { get; private set; default = ""; }
 		public string fail_str { get; private set; default = ""; }
+		public OutputCapture stdout_capture { get; private set; default = new OutputCapture(); }
+		public OutputCapture stderr_capture { get; private set; default = new OutputCapture(); }
 
 		public Bubble (FileVerification verification)
 		{
@@ -49,6 +52,12 @@ namespace OLLMbwrap
 			this.overlay = new Overlay (verification);
 		}
 
+		public Bubble.with_overlay (Overlay overlay)
+		{
+			Object (verification: overlay.verification);
+			this.overlay = overlay;
+		}
+
 		public async string exec (string command, string working_dir = "") throws Error
 		{
 			throw new GLib.IOError.NOT_SUPPORTED (
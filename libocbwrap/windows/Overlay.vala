@@ -33,6 +33,8 @@ namespace OLLMbwrap
 			get; private set; default = new Gee.HashMap<string, string> ();
 		}
 
+		public bool keep_warm { get; set; default = false; }
+
 		public Overlay (FileVerification verification)
 		{
 			Object (verification: verification);
@@ -45,5 +47,13 @@ namespace OLLMbwrap
 		public void cleanup()
 		{
 		}
+
+		public void release(bool wait = false)
+		{
+		}
+
+		public static void remove_stale()
+		{
+		}
 	}
 }
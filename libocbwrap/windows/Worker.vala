@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+namespace OLLMbwrap
+{
+	/**
+	 * Windows stub for {@link Worker} — there is no sandbox to keep running.
+	 */
+	public class Worker : GLib.Object
+	{
+		public Bubble bubble { get; private set; }
+		public bool is_running { get { return false; } }
+		public bool is_busy { get { return false; } }
+		public uint timeout_seconds { get; set; default = 0; }
+
+		public Worker (Overlay overlay)
+		{
+			overlay.keep_warm = true;
+			this.bubble = new Bubble.with_overlay (overlay);
+		}
+
+		public async string exec (string command, string working_dir = "") throws Error
+		{
+			throw new GLib.IOError.NOT_SUPPORTED (
+				"Bubble sandboxing is not available on Windows"
+			);
+		}
+
+		public async string exec_held (string command, string working_dir = "") throws Error
+		{
+			throw new GLib.IOError.NOT_SUPPORTED (
+				"Bubble sandboxing is not available on Windows"
+			);
+		}
+
+		public async void acquire_turn()
+		{
+		}
+
+		public void release_turn()
+		{
+		}
+
+		public void stop()
+		{
+		}
+
+		public void release(bool wait = false)
+		{
+		}
+	}
+}
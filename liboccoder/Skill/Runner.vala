@@ -74,6 +74,13 @@ namespace OLLMcoder.Skill
 		 */
 		public OLLMcoder.Task.ProgressList progress { get; private set; }
 
+		/**
+		 * Cap on task refinements and executions talking to the model at
+		 * once (see {@link OLLMcoder.Task.List}). Serial while {@link in_replay}.
+		 */
+		public OLLMcoder.Task.Budget llm_budget { get; private set;
+			default = new OLLMcoder.Task.Budget(); }
+
 		/**
 		 * True when running from a replay session. When set, Details and Tool use
 		 * the runner's chat_call (ReplayChat) instead of their own.
@@ -139,6 +146,8 @@ namespace OLLMcoder.Skill
 			this.completed = new OLLMcoder.Task.List(this);
 			this.pending = new OLLMcoder.Task.List(this);
 			this.progress = new OLLMcoder.Task.ProgressList(this);
+			this.bind_property("in-replay", this.llm_budget, "serial",
+				GLib.BindingFlags.SYNC_CREATE);
 		}
 
 		/**
@@ -395,6 +404,13 @@ namespace OLLMcoder.Skill
 					this.add_message(new OLLMchat.Message("ui", "Task list complete (no more steps)."));
 					break;
 				}
+				// Refine the (new) first step before run_step; after run_task_list_iteration the list was replaced and the new first step was not refined yet.
+				// Refinement can set requires_user_approval, so approval is asked once it has finished.
+				this.add_message(new OLLMchat.Message("ui-waiting",
+					"waiting for " + (this.session.model_usage.model != "" ?
+					this.session.model_usage.display_name_with_size() : "Unknown model") + " to reply"));
+				yield this.pending.refine(cancellable);
+				yield this.pending.wait_refined();
 				if (this.pending.has_tasks_requiring_approval() && !this.writer_approval) {
 					var approved = yield this.request_writer_approval();
 					if (!approved) {
@@ -406,11 +422,6 @@ namespace OLLMcoder.Skill
 					}
 					this.writer_approval = true;
 				}
-				// Refine the (new) first step before run_step; after run_task_list_iteration the list was replaced and the new first step was not refined yet.
-				this.add_message(new OLLMchat.Message("ui-waiting",
-					"waiting for " + (this.session.model_usage.model != "" ?
-					this.session.model_usage.display_name_with_size() : "Unknown model") + " to reply"));
-				yield this.pending.refine(cancellable);
 				step_done = yield this.pending.run_step();
 				if (step_done) {
 					yield this.run_task_list_iteration(cancellable);
@@ -688,6 +699,7 @@ namespace OLLMcoder.Skill
 					continue;
 				}
 				this.pending.goals_summary_md = existing_proposed.goals_summary_md;
+				this.pending.adopt_speculative(existing_proposed);
 				this.pending.write("task_list_latest.md", response);
 				this.pending.write("task_list_completed.md",
 					this.completed.to_markdown(OLLMcoder.Task.PhaseEnum.LIST));
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+namespace OLLMcoder.Task
+{
+
+/**
+ * Cap on task phases that talk to the model at the same time.
+ *
+ * One per {@link OLLMcoder.Skill.Runner} ({@link OLLMcoder.Skill.Runner.llm_budget}).
+ * {@link List} holds a slot for each task's refinement and for its
+ * execution; speculative refinement of the next step only starts when
+ * {@link try_acquire} finds a slot free, so it never delays the current step.
+ * While {@link serial} is set (replay) one phase runs at a time, so
+ * recorded responses are consumed in their original order.
+ */
+public class Budget : Object
+{
+	/** Caller queued for a slot. */
+	private class Waiter
+	{
+		public GLib.SourceFunc? resume = null;
+	}
+
+	/** Phases in flight at once. */
+	public int max_in_flight { get; set; default = 2; }
+
+	/** One phase at a time regardless of {@link max_in_flight}. */
+	public bool serial { get; set; default = false; }
+
+	private int in_flight = 0;
+	private Gee.ArrayQueue<Waiter> waiters = new Gee.ArrayQueue<Waiter>();
+
+	private int limit()
+	{
+		return this.serial ? 1 : int.max(1, this.max_in_flight);
+	}
+
+	/**
+	 * Yield until a slot is free and take it. Callers are served in order.
+	 */
+	public async void acquire()
+	{
+		if (this.in_flight < this.limit()) {
+			this.in_flight++;
+			return;
+		}
+		var w = new Waiter();
+		w.resume = this.acquire.callback;
+		this.waiters.offer(w);
+		yield;
+	}
+
+	/**
+	 * Take a slot only if one is free and nobody is queued.
+	 *
+	 * @return true when a slot was taken (caller must {@link release} it)
+	 */
+	public bool try_acquire()
+	{
+		if (this.in_flight >= this.limit() || !this.waiters.is_empty) {
+			return false;
+		}
+		this.in_flight++;
+		return true;
+	}
+
+	/** Hand the slot to the next queued caller, or free it. */
+	public void release()
+	{
+		var w = this.waiters.poll();
+		if (w == null) {
+			this.in_flight--;
+			return;
+		}
+		GLib.Idle.add((owned) w.resume);
+	}
+}
+
+}
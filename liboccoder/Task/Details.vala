@@ -356,9 +356,8 @@ public class Details : OLLMchat.Agent.Base, ProgressItem
 		return section + " (unnamed)";
 	}
 
-	private bool refined_done = false;
-	private GLib.Error? refine_error = null;
-	private GLib.SourceFunc? resume_refined = null;
+	/** Completion of this task's refinement; see {@link wait_refined}. */
+	public Refined refined { get; private set; default = new Refined(); }
 
 	/**
 	 * True when refinement failed after exhausting communication retries
@@ -366,20 +365,108 @@ public class Details : OLLMchat.Agent.Base, ProgressItem
 	 */
 	public bool last_failure_was_communication { get; private set; default = false; }
 
-	public async void wait_refined() throws GLib.Error
+	/**
+	 * Set by {@link List} to this task's ''LIST'' markdown when it is refined
+	 * ahead of its step. {@link to_markdown} keeps showing the planner that
+	 * text, and {@link List.adopt_speculative} keeps the refinement when the
+	 * next task list repeats the task unchanged.
+	 */
+	public string speculative_md { get; set; default = ""; }
+
+	/**
+	 * Cancels an ahead-of-time refinement; cancelled by the run's
+	 * cancellable and by {@link List.adopt_speculative} when the task is
+	 * not kept.
+	 */
+	public GLib.Cancellable? speculative_cancellable { get; set; default = null; }
+
+	/**
+	 * Handler on the run's cancellable that cancels
+	 * {@link speculative_cancellable}; {@link List} disconnects it when the
+	 * speculation is adopted or dropped (0 = none).
+	 */
+	public ulong speculative_cancel_id { get; set; default = 0; }
+
+	/** True once {@link List} has started (or queued) this task's refinement. */
+	public bool refine_started { get; private set; default = false; }
+
+	/** Refinement finished without error. */
+	public bool is_refined()
 	{
-		if (this.refined_done) {
-			if (this.refine_error != null) {
-				throw this.refine_error;
+		return this.refined.done && this.refined.error == null;
+	}
+
+	/**
+	 * Slugs of tasks this task reads through ''task:'' links in References
+	 * and Shared references. Refinement resolves their output, so they have
+	 * to be finished (in {@link OLLMcoder.Skill.Runner.completed}) first.
+	 */
+	public Gee.ArrayList<string> dependencies()
+	{
+		var ret = new Gee.ArrayList<string>();
+		var links = new Gee.ArrayList<Markdown.Document.Format>();
+		links.add_all(this.references);
+		links.add_all(this.shared_references);
+		foreach (var link in links) {
+			if (link.scheme != "task") {
+				continue;
+			}
+			var slug = link.path.strip();
+			slug = slug.has_suffix(".md") ? slug.substring(0, slug.length - 3) : slug;
+			if (slug != "" && !ret.contains(slug)) {
+				ret.add(slug);
 			}
-			return;
 		}
-		this.resume_refined = wait_refined.callback;
-		yield;
-		this.resume_refined = null;
-		if (this.refine_error != null) {
-			throw this.refine_error;
+		return ret;
+	}
+
+	/** Every task in {@link dependencies} has finished. */
+	public bool dependencies_done()
+	{
+		foreach (var slug in this.dependencies()) {
+			var dep = this.runner.completed.slugs.get(slug);
+			if (dep == null || !dep.exec_done) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * {@link refine} holding a slot of budget, for the {@link List} scheduler.
+	 * Never throws: a failure or cancellation is kept and rethrown from
+	 * {@link wait_refined}, which is always woken.
+	 *
+	 * @param budget shared model budget
+	 * @param cancellable passed to {@link refine}
+	 * @param have_slot caller already took the slot (speculative refinement)
+	 */
+	public async void refine_scheduled(Budget budget, GLib.Cancellable? cancellable = null,
+		bool have_slot = false)
+	{
+		this.refine_started = true;
+		if (!have_slot) {
+			yield budget.acquire();
 		}
+		GLib.Error? error = null;
+		try {
+			yield this.refine(cancellable);
+			if (!this.refined.done) {
+				error = new GLib.IOError.CANCELLED("Task refinement cancelled");
+			}
+		} catch (GLib.Error e) {
+			error = e;
+		} finally {
+			budget.release();
+		}
+		if (error != null) {
+			this.refined.finish(error);
+		}
+	}
+
+	public async void wait_refined() throws GLib.Error
+	{
+		yield this.refined.wait();
 	}
 
 	/**
@@ -440,7 +527,7 @@ public class Details : OLLMchat.Agent.Base, ProgressItem
 		tpl.fill(8,
 			"issues", tpl.header_raw("Issues with the current call", this.result_parser.issues),
 			"task_data", tpl.header_raw("Task", this.to_markdown(PhaseEnum.REFINEMENT)),
-			"environment", this.runner.env(),
+			"environment", tpl.header_raw("Environment", this.runner.env()),
 			"project_description", project_description,
 			"task_reference_contents", this.reference_contents(PhaseEnum.REFINEMENT),
 			"skill_details", this.skill.refine,
@@ -459,8 +546,7 @@ public class Details : OLLMchat.Agent.Base, ProgressItem
 	 */
 	public async void refine(GLib.Cancellable? cancellable = null) throws GLib.Error
 	{
-		this.refined_done = false;
-		this.refine_error = null;
+		this.refined.reset();
 		this.status = PhaseEnum.REFINEMENT;
 		this.runner.progress.active_item_changed(this);
 		this.add_message(new OLLMchat.Message("ui",
@@ -517,10 +603,9 @@ public class Details : OLLMchat.Agent.Base, ProgressItem
 					if (attempt != 2) {
 						continue;
 					}
-					this.refine_error = new GLib.IOError.INVALID_ARGUMENT("Task refinement: " + e.message);
 					this.status = PhaseEnum.ERROR;
 					this.runner.progress.active_item_changed(null);
-					throw this.refine_error;
+					throw new GLib.IOError.INVALID_ARGUMENT("Task refinement: " + e.message);
 				}
 			}
 			if (cancellable != null && cancellable.is_cancelled()) {
@@ -539,11 +624,8 @@ public class Details : OLLMchat.Agent.Base, ProgressItem
 			}
 			if (this.result_parser.issues == "") {
 				this.runner.replay_step("refinement_success: " + task_name, response_text);
-				this.refined_done = true;
 				this.status = PhaseEnum.REFINED;
-				if (this.resume_refined != null) {
-					this.resume_refined();
-				}
+				this.refined.finish();
 				return;
 			}
 			if (i < 4) {
@@ -602,6 +684,9 @@ public class Details : OLLMchat.Agent.Base, ProgressItem
 	 */
 	public string to_markdown(PhaseEnum phase)
 	{
+		if (phase == PhaseEnum.LIST && this.speculative_md != "") {
+			return this.speculative_md;
+		}
 		string[] order = {
 			"name",
 			"what is needed",
@@ -20,9 +20,17 @@ namespace OLLMcoder.Task
  *
  * Holds {@link steps} (each {@link Step} has {@link Details} children).
  * Created by {@link ResultParser.parse_task_list}; the Runner then calls
- * {@link run_step_until_approval} or {@link run_step} to run tasks step-by-step.
- * Each step is refined (all its tasks) immediately before that step runs, so refinement
- * and execution are interleaved per step in order.
+ * {@link refine} and {@link run_step_until_approval} or {@link run_step} to run
+ * tasks step-by-step.
+ *
+ * Scheduling: dependencies are the ''task:'' links in each task's
+ * references ({@link Details.dependencies}); the planner only allows links
+ * to earlier steps, so tasks within a step are independent. All tasks of
+ * the first step refine at once, and each one executes as soon as its own
+ * refinement is done, all under the runner's {@link Budget}. While a step
+ * executes, any free slot refines next-step tasks whose dependencies are
+ * already complete; {@link adopt_speculative} keeps that work when the task
+ * list iteration leaves those tasks unchanged.
  *
  * @see Step
  * @see Details
@@ -55,6 +63,12 @@ public class List : Object
 	 */
 	private GLib.SourceFunc? resume_when_exec_done = null;
 
+	/** First failure from a run_child started by start_child in the current step. */
+	private GLib.Error? exec_error = null;
+
+	/** Cancellable of the run, from {@link refine}; passed to every refinement. */
+	private GLib.Cancellable? cancellable = null;
+
 	public List(OLLMcoder.Skill.Runner runner)
 	{
 		this.runner = runner;
@@ -155,12 +169,14 @@ public class List : Object
 	}
 
 	/**
-	 * Run refinement for the first step's tasks only (one after another).
-	 * Refinement and execution are interleaved per step: refine first step →
-	 * execute first step → (iteration) → refine next step → execute next step.
+	 * Start refinement of every first-step task that is not refined or
+	 * refining yet, and return. Refinements run concurrently under the
+	 * runner's {@link Budget}; {@link run_step} waits for each task's own
+	 * refinement before executing it, and refinement errors surface there.
 	 */
 	public async void refine(GLib.Cancellable? cancellable = null) throws GLib.Error
 	{
+		this.cancellable = cancellable;
 		if (this.steps.size == 0) {
 			return;
 		}
@@ -169,8 +185,114 @@ public class List : Object
 			if (cancellable != null && cancellable.is_cancelled()) {
 				return;
 			}
-			yield t.refine(cancellable);
+			if (t.refine_started || t.exec_done) {
+				continue;
+			}
+			this.start_refine(t, cancellable);
+		}
+	}
+
+	private void start_refine(Details t, GLib.Cancellable? cancellable, bool have_slot = false)
+	{
+		t.refine_scheduled.begin(this.runner.llm_budget, cancellable, have_slot, (o, res) => {
+			t.refine_scheduled.end(res);
+		});
+	}
+
+	/**
+	 * Refine second-step tasks ahead of time while the first step runs,
+	 * but only with slots that are free right now, and only for tasks whose
+	 * {@link Details.dependencies} are already complete (they cannot depend
+	 * on the step that is running). Not used in replay.
+	 */
+	private void speculate_next_step()
+	{
+		if (this.steps.size < 2 || this.runner.in_replay) {
+			return;
+		}
+		foreach (var t in this.steps.get(1).children) {
+			if (t.refine_started || !t.dependencies_done() || !t.skill_manager.validate(t)) {
+				continue;
+			}
+			if (this.cancellable != null && this.cancellable.is_cancelled()) {
+				return;
+			}
+			if (!this.runner.llm_budget.try_acquire()) {
+				return;
+			}
+			t.speculative_md = t.to_markdown(PhaseEnum.LIST);
+			var spec = new GLib.Cancellable();
+			if (this.cancellable != null) {
+				t.speculative_cancel_id = this.cancellable.connect(() => {
+					spec.cancel();
+				});
+			}
+			t.speculative_cancellable = spec;
+			this.start_refine(t, spec, true);
+		}
+	}
+
+	/**
+	 * After a task list iteration: for each first-step task of this (new)
+	 * list that the planner repeated unchanged from a task refined ahead of
+	 * time in previous, use the refined task instead of refining again.
+	 * Ahead-of-time refinements that are not kept are cancelled, so they
+	 * give back their {@link Budget} slot and stop their LLM call.
+	 *
+	 * @param previous the list this one replaced
+	 */
+	public void adopt_speculative(List previous)
+	{
+		if (this.steps.size == 0) {
+			return;
+		}
+		var refined = new Gee.HashMap<string, Details>();
+		var dropped = new Gee.ArrayList<Details>();
+		foreach (var old_step in previous.steps) {
+			foreach (var t in old_step.children) {
+				if (t.speculative_md == "") {
+					continue;
+				}
+				previous.end_speculation(t);
+				if (t.is_refined()) {
+					refined.set(t.speculative_md, t);
+					continue;
+				}
+				dropped.add(t);
+			}
+		}
+		foreach (var t in dropped) {
+			t.speculative_cancellable.cancel();
+		}
+		if (refined.size == 0) {
+			return;
+		}
+		var step = this.steps.get(0);
+		for (var i = 0; i < step.children.size; i++) {
+			var t = step.children.get(i);
+			var old = refined.get(t.to_markdown(PhaseEnum.LIST));
+			if (old == null) {
+				continue;
+			}
+			old.step = step;
+			old.step_index = t.step_index;
+			old.speculative_md = "";
+			old.speculative_cancellable = null;
+			step.children.set(i, old);
+			this.slugs.set(t.slug(), old);
+		}
+	}
+
+	/**
+	 * Disconnect the run cancellable from t's ahead-of-time refinement
+	 * (connected in {@link speculate_next_step}).
+	 */
+	private void end_speculation(Details t)
+	{
+		if (t.speculative_cancel_id != 0 && this.cancellable != null) {
+			this.cancellable.disconnect(t.speculative_cancel_id);
 		}
+		t.speculative_cancel_id = 0;
 	}
 
 	/**
@@ -199,7 +321,31 @@ public class List : Object
 	}
 
 	/**
-	 * Run the first step only. Stops if that step has a task requiring user approval.
+	 * Start refinement of the first step's unfinished tasks that have not
+	 * started yet and wait until every one of them has finished refining.
+	 * Refinement can set {@link Details.requires_user_approval}, so the
+	 * approval checks ({@link run_step_until_approval},
+	 * {@link has_tasks_requiring_approval}) come after this.
+	 *
+	 * @throws GLib.Error first refinement failure, once all have stopped
+	 */
+	public async void wait_refined() throws GLib.Error
+	{
+		if (this.steps.size == 0) {
+			return;
+		}
+		var step = this.steps.get(0);
+		foreach (var t in step.children) {
+			if (!t.exec_done && !t.refine_started) {
+				this.start_refine(t, this.cancellable);
+			}
+		}
+		yield step.wait_refined();
+	}
+
+	/**
+	 * Run the first step only. Stops if that step has a task requiring user
+	 * approval, checked once the step's refinements have finished.
 	 * When the step completes (all children exec_done), move it to runner.completed
 	 * and remove from this list. Caller (Runner) should call run_task_list_iteration() when true.
 	 *
@@ -210,23 +356,12 @@ public class List : Object
 		if (this.steps.size == 0) {
 			return false;
 		}
+		yield this.wait_refined();
 		var step = this.steps.get(0);
 		if (step.has_task_requiring_approval()) {
 			return false;
 		}
-		if (step.children.size == 1) {
-			var single = step.children.get(0);
-			if (!single.exec_done) {
-				yield this.run_child(single);
-			}
-		} else {
-			// Run tasks in the step sequentially (one after another)
-			foreach (var t in step.children) {
-				if (!t.exec_done) {
-					yield this.run_child(t);
-				}
-			}
-		}
+		yield this.run_children(step);
 		if (!step.is_exec_done()) {
 			this.runner.add_message(new OLLMchat.Message("ui", OLLMchat.Message.fenced(
 				"text.oc-frame-danger.collapsed Step did not complete",
@@ -237,11 +372,41 @@ public class List : Object
 		return true;
 	}
 
+	/**
+	 * Run every unfinished task of step concurrently (each waits for its own
+	 * refinement, then for a {@link Budget} slot) and wait for all of them;
+	 * meanwhile offer free slots to {@link speculate_next_step}. Rethrows the
+	 * first task failure once every task has stopped.
+	 */
+	private async void run_children(Step step) throws GLib.Error
+	{
+		this.exec_error = null;
+		this.num_exec_running = 0;
+		foreach (var t in step.children) {
+			if (t.exec_done) {
+				continue;
+			}
+			if (!t.refine_started) {
+				this.start_refine(t, this.cancellable);
+			}
+			this.num_exec_running++;
+		}
+		foreach (var t in step.children) {
+			this.start_child(t);
+		}
+		this.speculate_next_step();
+		yield this.wait_exec_done();
+		if (this.exec_error != null) {
+			throw this.exec_error;
+		}
+	}
+
 	/**
 	 * Starts run_child for one task in the background; on completion
 	 * decrements num_exec_running and resumes ''wait_exec_done'' if set.
 	 * Skips tasks that are already done (''t.exec_done''). Caller must set
 	 * num_exec_running to the number of children being started first.
+	 * A failure is kept in exec_error (first one wins).
 	 */
 	private void start_child(Details t)
 	{
@@ -249,7 +414,13 @@ public class List : Object
 			return;
 		}
 		this.run_child.begin(t, (o, res) => {
-			this.run_child.end(res);
+			try {
+				this.run_child.end(res);
+			} catch (GLib.Error e) {
+				if (this.exec_error == null) {
+					this.exec_error = e;
+				}
+			}
 			this.num_exec_running--;
 			if (this.resume_when_exec_done == null) {
 				return;
@@ -266,13 +437,23 @@ public class List : Object
 	private async void run_child(Details t) throws GLib.Error
 	{
 		yield t.wait_refined();
-		t.build_run_queue();
-		/* GLib.debug("TASK LIST RUN EXEC slug=%s idx=%d", t.slug(), t.msg_idx); */
-		this.runner.progress.rebuild();
-		yield t.run_exec();
-		t.write();
+		var budget = this.runner.llm_budget;
+		yield budget.acquire();
+		try {
+			t.build_run_queue();
+			/* GLib.debug("TASK LIST RUN EXEC slug=%s idx=%d", t.slug(), t.msg_idx); */
+			this.runner.progress.rebuild();
+			yield t.run_exec();
+			t.write();
+		} finally {
+			budget.release();
+		}
 	}
 
+	/**
+	 * Whether any pending task needs user approval. The first step's flags
+	 * are only final after {@link wait_refined}.
+	 */
 	public bool has_tasks_requiring_approval()
 	{
 		foreach (var step in this.steps) {
@@ -296,19 +477,7 @@ public class List : Object
 			return false;
 		}
 		var step = this.steps.get(0);
-		if (step.children.size == 1) {
-			var single = step.children.get(0);
-			if (!single.exec_done) {
-				yield this.run_child(single);
-			}
-		} else {
-			// Run tasks in the step sequentially (one after another)
-			foreach (var t in step.children) {
-				if (!t.exec_done) {
-					yield this.run_child(t);
-				}
-			}
-		}
+		yield this.run_children(step);
 		if (!step.is_exec_done()) {
 			this.runner.add_message(new OLLMchat.Message("ui", OLLMchat.Message.fenced(
 				"text.oc-frame-danger.collapsed Step did not complete",
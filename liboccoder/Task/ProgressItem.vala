@@ -96,7 +96,7 @@ public interface ProgressItem : GLib.Object
 
 	/**
 	 * After {@link Tool} execution, the {@link OLLMchat.Tool.RequestBase}
-	 * copied from {@link OLLMchat.Tool.BaseTool.last_request} for this row;
+	 * created for this row ({@link OLLMchat.Agent.Base.tool_registered});
 	 * null if not a tool row or not yet run.
 	 */
 	public abstract OLLMchat.Tool.RequestBase? tool_request { get; set; }
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+namespace OLLMcoder.Task
+{
+
+/**
+ * Completion of one task's refinement, for everything that waits on it.
+ *
+ * Refinement runs in the background ({@link List.refine}), and both the
+ * approval gate ({@link List.run_step_until_approval}) and the task's own
+ * execution wait for it, so any number of callers can be queued in
+ * {@link wait}. Refinement output can set
+ * {@link Details.requires_user_approval}; approval is only decided once
+ * {@link wait_all} has returned for the step.
+ */
+public class Refined : Object
+{
+	/** Caller waiting for {@link finish}. */
+	private class Waiter
+	{
+		public GLib.SourceFunc? resume = null;
+	}
+
+	/** Refinement has finished (with or without {@link error}). */
+	public bool done { get; private set; default = false; }
+
+	/** Why refinement failed; null on success or while running. */
+	public GLib.Error? error { get; private set; default = null; }
+
+	private Gee.ArrayList<Waiter> waiters = new Gee.ArrayList<Waiter>();
+
+	/** Refinement started again; callers of {@link wait} keep waiting. */
+	public void reset()
+	{
+		this.done = false;
+		this.error = null;
+	}
+
+	/**
+	 * Mark refinement finished and resume every waiter.
+	 *
+	 * @param error failure, or null on success
+	 */
+	public void finish(GLib.Error? error = null)
+	{
+		this.done = true;
+		this.error = error;
+		var waiters = this.waiters;
+		this.waiters = new Gee.ArrayList<Waiter>();
+		foreach (var w in waiters) {
+			GLib.Idle.add((owned) w.resume);
+		}
+	}
+
+	/**
+	 * Yield until {@link finish}.
+	 *
+	 * @throws GLib.Error the refinement failure
+	 */
+	public async void wait() throws GLib.Error
+	{
+		if (!this.done) {
+			var w = new Waiter();
+			w.resume = this.wait.callback;
+			this.waiters.add(w);
+			yield;
+		}
+		if (this.error != null) {
+			throw this.error;
+		}
+	}
+
+	/**
+	 * Wait for every refinement in list, then rethrow the first failure.
+	 * A failure does not stop the wait, so nothing is still refining when
+	 * this returns.
+	 */
+	public static async void wait_all(Gee.List<Refined> list) throws GLib.Error
+	{
+		GLib.Error? first = null;
+		foreach (var r in list) {
+			try {
+				yield r.wait();
+			} catch (GLib.Error e) {
+				if (first == null) {
+					first = e;
+				}
+			}
+		}
+		if (first != null) {
+			throw first;
+		}
+	}
+}
+
+}
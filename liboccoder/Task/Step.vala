@@ -27,15 +27,13 @@ namespace OLLMcoder.Task
  *  * Exposes ''children'' (''Gee.ArrayList'' of {@link Details}).
  *  * {@link has_task_requiring_approval} returns ''true'' if any child
  *    requires user approval before execution continues.
- *  * {@link wait_refined} yields until the single child has finished
- *    refining when ''children.size == 1''; when ''size > 1'', refinement
- *    is waited per task inside {@link List.run_child}, so this method
- *    returns immediately.
+ *  * {@link wait_refined} yields until every unfinished child has
+ *    finished refining, so approval flags set by refinement are current.
  *
  * Task flow: {@link List} holds an ordered list of Step. Execution is
- * sequential at the step level; for each Step, List either runs one
- * run_child (single child) or starts run_child for each child and waits
- * for all via wait_exec_done (concurrent). Step is the boundary between
+ * sequential at the step level; for each Step, List starts run_child for
+ * each child and waits for all via wait_exec_done (concurrent, up to the
+ * runner's {@link Budget}). Step is the boundary between
  * one task or concurrent group and the next step in sequence.
  *
  * @see List
@@ -148,19 +146,21 @@ public class Step : Object
 	}
 
 	/**
-	 * When ''children.size == 1'', yields until that task has finished refining.
+	 * Yields until every child that is not executed yet has finished
+	 * refining. Caller must have started those refinements
+	 * ({@link List.refine}).
 	 *
-	 * For ''size > 1'', {@link List.run_child} waits per task; this method
-	 * returns immediately.
-	 *
-	 * @throws GLib.Error propagated from refinement
+	 * @throws GLib.Error first refinement failure, once all have stopped
 	 */
 	public async void wait_refined() throws GLib.Error
 	{
-		if (this.children.size != 1) {
-			return;
+		var list = new Gee.ArrayList<Refined>();
+		foreach (var t in this.children) {
+			if (!t.exec_done) {
+				list.add(t.refined);
+			}
 		}
-		yield this.children.get(0).wait_refined();
+		yield Refined.wait_all(list);
 	}
 }
 
@@ -204,8 +204,12 @@ namespace OLLMcoder.Task
 						this.tool_call.function.name) as OLLMchat.Tool.BaseTool;
 				this.status = PhaseEnum.TOOLS_RUNNING;
 				this.parent.runner.progress.active_item_changed(this);
+				// The tool is shared by concurrent tasks; take the request made for this agent
+				var registered = this.tool_registered.connect((request) => {
+					this.tool_request = request;
+				});
 				this.tool_run_result = yield tool_impl.execute(this.chat(), this.tool_call, true);
-				this.tool_request = tool_impl.last_request;
+				this.disconnect(registered);
 				this.notify_property("tooltip_text");
 				this.status = PhaseEnum.EXECUTION;
 				tool_output = this.tool_call_details();
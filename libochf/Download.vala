@@ -21,8 +21,22 @@ namespace OLLMhf
 	/**
 	 * Download a Model's ''.gguf'' siblings into the local models tree.
 	 *
-	 * Resume state is kept in ''download.json'' beside the files. See the
-	 * OLLMhf namespace page for a full download example.
+	 * When the server takes byte ranges, each file is preallocated as
+	 * ''NAME.partial'' and split into {@link segment_size} segments. Up to
+	 * {@link connections} segments, from any of the selected files, are
+	 * fetched at once and written in place. Each finished segment's SHA-256
+	 * is kept. The whole-file SHA-256 (checked against the LFS ETag) is
+	 * built in order: the next segment in line is hashed as it streams in,
+	 * and segments that finished ahead of it are read back once (checked
+	 * against their segment hash, so a segment lost in a crash is fetched
+	 * again).
+	 *
+	 * Resume state is kept in ''download.json'' beside the files, including
+	 * the {@link Sha256} state of the in-order hash; segments are synced to
+	 * disk before that state is saved. A resumed download only fetches
+	 * segments that were not finished and does not read back the ones
+	 * already in the hash. See the OLLMhf namespace page for a full
+	 * download example.
 	 */
 	public class Download : GLib.Object
 	{
@@ -31,18 +45,107 @@ namespace OLLMhf
 		public string revision { get; set; default = "main"; }
 		public string[] file_filter { get; set; default = {}; }
 
-		private Soup.Session soup;
+		/** Hub base URL for resolve links (a local server in tests). */
+		public string hub_url { get; set; default = "https://huggingface.co"; }
+
+		/** Segment requests in flight at once, across all files. */
+		public int connections { get; set; default = 4; }
+
+		/** Bytes per range request; also what a resume can lose per request. */
+		public int64 segment_size { get; set; default = 64 * 1024 * 1024; }
+
+		private Soup.Session? soup = null;
 		private OLLMrpc.Bin.Json json =
 			new OLLMrpc.Bin.Json(OLLMrpc.Bin.Mode.AUTO);
 		private GLib.Cancellable? stop_cancellable;
+		private string download_path = "";
+		private int64 received;
 		private int64 last_persist_time;
 		private int64 last_persist_bytes;
 
 		public signal void progress(OLLMrpc.Notification notif);
 
+		/**
+		 * One sibling being downloaded: its ''.partial'' file and the
+		 * in-order whole-file hash.
+		 */
+		private class Target : GLib.Object
+		{
+			public ModelFile file;
+			public string partial_path;
+			public string dest_path;
+			public int fd = -1;
+			public GLib.FileInputStream? reader = null;
+			public Sha256 whole = new Sha256();
+			/** Segments folded into {@link whole}. */
+			public int hashed = 0;
+			public bool hashing = false;
+			/** Segment being hashed into a copy of {@link whole} as it downloads; -1 for none. */
+			public int streaming = -1;
+
+			public Target(ModelFile file, string model_dir)
+			{
+				this.file = file;
+				this.partial_path = GLib.Path.build_filename(model_dir, file.rfilename + ".partial");
+				this.dest_path = GLib.Path.build_filename(model_dir, file.rfilename);
+			}
+
+			public int64 start_of(int index)
+			{
+				return this.file.segment_size * index;
+			}
+
+			/** Segment length; -1 for a single stream of unknown size. */
+			public int64 length_of(int index)
+			{
+				if (this.file.segment_size == 0) {
+					return this.file.size > 0 ? this.file.size : -1;
+				}
+				var start = this.start_of(index);
+				return int64.min(this.file.segment_size, this.file.size - start);
+			}
+
+			/** Take whole as the hash of one more segment and record it for resume. */
+			public void fold(Sha256 whole)
+			{
+				this.whole = whole;
+				this.hashed++;
+				this.file.sha256_state = whole.to_state();
+				this.file.sha256_segments = this.hashed;
+			}
+
+			public void close()
+			{
+				if (this.fd >= 0) {
+					Posix.close(this.fd);
+					this.fd = -1;
+				}
+				if (this.reader != null) {
+					try {
+						this.reader.close();
+					} catch (GLib.Error e) {
+						GLib.debug("close %s: %s", this.partial_path, e.message);
+					}
+					this.reader = null;
+				}
+			}
+		}
+
+		/** A segment waiting for a connection. */
+		private class Job : GLib.Object
+		{
+			public Target target;
+			public int index;
+
+			public Job(Target target, int index)
+			{
+				this.target = target;
+				this.index = index;
+			}
+		}
+
 		public Download(Model model) {
 			Object(model: model);
-			this.soup = new Soup.Session();
 		}
 
 		public void stop() {
@@ -54,9 +157,18 @@ namespace OLLMhf
 		public async void start(GLib.Cancellable? cancellable = null) throws GLib.Error
 		{
 			this.stop_cancellable = new GLib.Cancellable();
-			var active_cancel = cancellable != null
-				? cancellable
-				: this.stop_cancellable;
+			ulong cancel_id = 0;
+			if (cancellable != null) {
+				cancel_id = cancellable.connect(() => {
+					this.stop_cancellable.cancel();
+				});
+			}
+			if (this.soup == null) {
+				// one spare connection for HEAD while segments stream
+				this.soup = new Soup.Session.with_options(
+					"max-conns-per-host", this.connections + 1,
+					"max-conns", this.connections + 1);
+			}
 			var model_dir = this.models_dir;
 			if (model_dir == "") {
 				model_dir = GLib.Path.build_filename(
@@ -68,6 +180,7 @@ namespace OLLMhf
 			}
 			GLib.File.new_for_path(model_dir).make_directory_with_parents(null);
 			var download_path = GLib.Path.build_filename(model_dir, "download.json");
+			this.download_path = download_path;
 			if (GLib.FileUtils.test(download_path, GLib.FileTest.EXISTS)) {
 				var contents = "";
 				GLib.FileUtils.get_contents(download_path, out contents, null);
@@ -93,10 +206,26 @@ namespace OLLMhf
 			}
 			this.model.download_revision = this.revision;
 			this.last_persist_time = GLib.get_monotonic_time();
+			this.received = 0;
 			this.last_persist_bytes = 0;
 
-			foreach (var file in this.model.siblings) {
-				yield this.download_sibling(file, model_dir, download_path, active_cancel);
+			var targets = new Gee.ArrayList<Target>();
+			try {
+				foreach (var file in this.model.siblings) {
+					var target = yield this.prepare_sibling(file, model_dir);
+					if (target != null) {
+						targets.add(target);
+					}
+				}
+				this.persist();
+				yield this.run_segments(targets);
+			} finally {
+				foreach (var target in targets) {
+					target.close();
+				}
+				if (cancellable != null) {
+					cancellable.disconnect(cancel_id);
+				}
 			}
 
 			var manifest_path = GLib.Path.build_filename(model_dir, "manifest.json");
@@ -117,109 +246,267 @@ namespace OLLMhf
 		}
 
 		/**
-		 * Stream, verify, and persist one ''.gguf'' sibling when filters
-		 * and resume state allow it. HEAD runs only on a fresh start to
-		 * fetch the LFS ETag; resumed downloads reuse persisted state.
+		 * Plan one ''.gguf'' sibling when filters and resume state allow it
+		 * and open its ''.partial'' file. HEAD runs only when there is no
+		 * segment plan yet (fresh start, or a ''download.json'' from the
+		 * old single-stream format), to fetch size, LFS ETag and range
+		 * support; resumed downloads reuse persisted state.
 		 *
-		 * @param file          sibling to download
-		 * @param model_dir     install directory for this model
-		 * @param download_path path to ''download.json'' progress file
-		 * @param active_cancel download cancellation source
+		 * @param file      sibling to download
+		 * @param model_dir install directory for this model
+		 * @return          the open target, or null when nothing is to be done
 		 */
-		private async void download_sibling(
-			ModelFile file,
-			string model_dir,
-			string download_path,
-			GLib.Cancellable active_cancel
-		) throws GLib.Error
+		private async Target? prepare_sibling(ModelFile file, string model_dir) throws GLib.Error
 		{
 			if (!file.rfilename.has_suffix(".gguf")) {
-				return;
+				return null;
 			}
 			if (this.file_filter.length > 0 && !(file.rfilename in this.file_filter)) {
-				return;
+				return null;
 			}
 			if (file.download_complete) {
+				return null;
+			}
+
+			var target = new Target(file, model_dir);
+			if (file.segment_sha256.length == 0
+				|| !GLib.FileUtils.test(target.partial_path, GLib.FileTest.EXISTS)) {
+				yield this.plan_sibling(file);
+			}
+
+			var flags = Posix.O_WRONLY | Posix.O_CREAT;
+			if (file.segment_size == 0) {
+				// a single stream is rewritten from the start
+				flags |= Posix.O_TRUNC;
+			}
+			target.fd = Posix.open(target.partial_path, flags, 0644);
+			if (target.fd < 0) {
+				throw new GLib.IOError.FAILED("open %s: %s",
+					target.partial_path, GLib.strerror(GLib.errno));
+			}
+			if (file.segment_size > 0 && Posix.ftruncate(target.fd, (Posix.off_t) file.size) != 0) {
+				throw new GLib.IOError.FAILED("preallocate %s: %s",
+					target.partial_path, GLib.strerror(GLib.errno));
+			}
+
+			file.bytes_written = 0;
+			for (var i = 0; i < file.segment_sha256.length; i++) {
+				if (file.segment_sha256[i] != "") {
+					file.bytes_written += target.length_of(i);
+				}
+			}
+			this.restore_hash(target);
+			return target;
+		}
+
+		/**
+		 * Pick up the in-order hash saved by an earlier run, when every
+		 * segment it covers is still marked finished; otherwise start the
+		 * hash from the first segment.
+		 */
+		private void restore_hash(Target target)
+		{
+			var file = target.file;
+			// a single stream is truncated and fetched again from the top
+			if (file.segment_size == 0 || file.sha256_segments <= 0
+				|| file.sha256_segments > file.segment_sha256.length) {
+				file.sha256_state = "";
+				file.sha256_segments = 0;
+				return;
+			}
+			var whole = Sha256.from_state(file.sha256_state);
+			for (var i = 0; whole != null && i < file.sha256_segments; i++) {
+				if (file.segment_sha256[i] == "") {
+					whole = null;
+				}
+			}
+			if (whole == null) {
+				file.sha256_state = "";
+				file.sha256_segments = 0;
 				return;
 			}
+			target.whole = whole;
+			target.hashed = file.sha256_segments;
+		}
 
-			var resolve_url = file.to_url(this.model.id, this.model.download_revision);
-			if (file.bytes_written == 0) {
-				var head_msg = new Soup.Message("HEAD", resolve_url);
-				var head_in = yield this.soup.send_async(
-					head_msg, GLib.Priority.DEFAULT, active_cancel);
-				if (head_in != null) {
-					var discard = new uint8[4096];
-					while (true) {
-						var drained = yield head_in.read_async(
-							discard, GLib.Priority.DEFAULT, active_cancel);
-						if (drained <= 0) {
-							break;
-						}
+		/**
+		 * HEAD the sibling and lay out its segments: {@link segment_size}
+		 * pieces when the server takes byte ranges and the size is known,
+		 * otherwise one segment fetched as a single stream.
+		 */
+		private async void plan_sibling(ModelFile file) throws GLib.Error
+		{
+			var head_msg = new Soup.Message("HEAD", this.resolve_url(file));
+			var head_in = yield this.soup.send_async(
+				head_msg, GLib.Priority.DEFAULT, this.stop_cancellable);
+			if (head_in != null) {
+				var discard = new uint8[4096];
+				while (true) {
+					var drained = yield head_in.read_async(
+						discard, GLib.Priority.DEFAULT, this.stop_cancellable);
+					if (drained <= 0) {
+						break;
 					}
 				}
-				var etag_raw = head_msg.response_headers.get_one("ETag");
-				if (etag_raw != null && etag_raw != "") {
-					var etag = etag_raw.strip();
-					if (etag.has_prefix("\"") && etag.has_suffix("\"")) {
-						etag = etag[1:etag.length - 1];
+			}
+			var etag_raw = head_msg.response_headers.get_one("ETag");
+			if (etag_raw != null && etag_raw != "") {
+				var etag = etag_raw.strip();
+				if (etag.has_prefix("\"") && etag.has_suffix("\"")) {
+					etag = etag[1:etag.length - 1];
+				}
+				file.etag = etag;
+			}
+			if (file.size == 0 && head_msg.status_code == 200) {
+				file.size = int64.max(0, head_msg.response_headers.get_content_length());
+			}
+			var ranges = head_msg.response_headers.get_one("Accept-Ranges") ?? "";
+			file.sha256_partial = "";
+			file.sha256_state = "";
+			file.sha256_segments = 0;
+			if (ranges.strip().down() != "bytes" || file.size <= 0 || this.segment_size <= 0) {
+				file.segment_size = 0;
+				file.segment_sha256 = { "" };
+				return;
+			}
+			file.segment_size = this.segment_size;
+			var count = (int) ((file.size + this.segment_size - 1) / this.segment_size);
+			var hashes = new string[count];
+			for (var i = 0; i < count; i++) {
+				hashes[i] = "";
+			}
+			file.segment_sha256 = hashes;
+		}
+
+		/**
+		 * Fetch every unfinished segment of targets with up to
+		 * {@link connections} requests in flight, and hash each target to
+		 * completion. The first failure stops the rest and is rethrown.
+		 */
+		private async void run_segments(Gee.ArrayList<Target> targets) throws GLib.Error
+		{
+			var queue = new Gee.LinkedList<Job>();
+			foreach (var target in targets) {
+				for (var i = 0; i < target.file.segment_sha256.length; i++) {
+					if (target.file.segment_sha256[i] == "") {
+						queue.add(new Job(target, i));
 					}
-					file.etag = etag;
 				}
 			}
 
-			var partial_path = GLib.Path.build_filename(model_dir, file.rfilename + ".partial");
-			var dest_path = GLib.Path.build_filename(model_dir, file.rfilename);
-			var get_msg = new Soup.Message("GET", resolve_url);
-			if (file.bytes_written > 0) {
-				get_msg.request_headers.replace(
-					"Range", "bytes=%lld-".printf(file.bytes_written));
+			GLib.SourceFunc callback = run_segments.callback;
+			GLib.Error? failure = null;
+			var running = 0;
+			var workers = int.min(int.max(this.connections, 1), queue.size);
+			for (var i = 0; i < workers; i++) {
+				running++;
+				this.run_worker.begin(queue, (obj, res) => {
+					try {
+						this.run_worker.end(res);
+					} catch (GLib.Error e) {
+						if (failure == null) {
+							failure = e;
+						}
+						this.stop_cancellable.cancel();
+					}
+					running--;
+					if (running == 0) {
+						callback();
+					}
+				});
+			}
+			if (running > 0) {
+				yield;
+			}
+			if (failure != null) {
+				throw failure;
+			}
+			// files whose segments were all done before this run
+			foreach (var target in targets) {
+				yield this.advance_hash(target);
+			}
+		}
+
+		/** Take segments off queue until it is empty. */
+		private async void run_worker(Gee.LinkedList<Job> queue) throws GLib.Error
+		{
+			while (!queue.is_empty) {
+				var job = queue.poll_head();
+				yield this.fetch_segment(job.target, job.index);
+				yield this.advance_hash(job.target);
+			}
+		}
+
+		/**
+		 * Stream one segment into place and record its SHA-256. When it is
+		 * the next segment for the whole-file hash it is folded in as it
+		 * arrives, so it is never read back.
+		 */
+		private async void fetch_segment(Target target, int index) throws GLib.Error
+		{
+			var file = target.file;
+			var offset = target.start_of(index);
+			var length = target.length_of(index);
+			var get_msg = new Soup.Message("GET", this.resolve_url(file));
+			if (file.segment_size > 0) {
+				get_msg.request_headers.set_range(offset, offset + length - 1);
 			}
 			var input = yield this.soup.send_async(
-				get_msg, GLib.Priority.DEFAULT, active_cancel);
-			if (get_msg.status_code != 200 && get_msg.status_code != 206) {
+				get_msg, GLib.Priority.DEFAULT, this.stop_cancellable);
+			var expected_status = file.segment_size > 0 ? 206 : 200;
+			if (get_msg.status_code != expected_status) {
 				throw new GLib.IOError.FAILED("HTTP %u for %s",
 					get_msg.status_code, file.rfilename);
 			}
-			if (file.size == 0) {
-				file.size = (int64) get_msg.response_headers.get_content_length();
+			if (file.segment_size == 0) {
+				// a single stream restarts from the top
+				file.bytes_written = 0;
+				if (file.size == 0) {
+					file.size = int64.max(0, get_msg.response_headers.get_content_length());
+				}
 			}
 
-			GLib.FileOutputStream? out_stream = null;
-			if (file.bytes_written > 0) {
-				out_stream = GLib.File.new_for_path(partial_path).append_to(
-					GLib.FileCreateFlags.NONE);
-			} else {
-				out_stream = GLib.File.new_for_path(partial_path).create(
-					GLib.FileCreateFlags.REPLACE_DESTINATION);
+			Sha256? frontier = null;
+			if (index == target.hashed && target.streaming < 0) {
+				target.streaming = index;
+				frontier = target.whole.copy();
 			}
-
-			var checksum = new GLib.Checksum(GLib.ChecksumType.SHA256);
-			if (file.bytes_written > 0
-				&& GLib.FileUtils.test(partial_path, GLib.FileTest.EXISTS)) {
-				var partial_in = yield GLib.File.new_for_path(partial_path).read_async(
-					GLib.Priority.DEFAULT, active_cancel);
-				var hash_buf = new uint8[65536];
-				while (true) {
-					var hash_read = yield partial_in.read_async(
-						hash_buf, GLib.Priority.DEFAULT, active_cancel);
-					if (hash_read <= 0) {
-						break;
-					}
-					checksum.update(hash_buf[0:hash_read], hash_read);
+			try {
+				yield this.read_segment(target, index, input, frontier);
+			} finally {
+				if (frontier != null) {
+					target.streaming = -1;
 				}
 			}
+		}
 
+		/** Write the body of one segment request and record its hash. */
+		private async void read_segment(Target target, int index, GLib.InputStream input,
+			Sha256? frontier) throws GLib.Error
+		{
+			var file = target.file;
+			var offset = target.start_of(index);
+			var length = target.length_of(index);
+			var checksum = new GLib.Checksum(GLib.ChecksumType.SHA256);
 			var buf = new uint8[65536];
+			int64 got = 0;
 			while (true) {
-				var n = yield input.read_async(buf, GLib.Priority.DEFAULT, active_cancel);
+				var n = yield input.read_async(buf, GLib.Priority.DEFAULT, this.stop_cancellable);
 				if (n <= 0) {
 					break;
 				}
-				out_stream.write(buf[0:n]);
+				if (length >= 0 && got + n > length) {
+					throw new GLib.IOError.FAILED("%s: segment %d is longer than %lld bytes",
+						file.rfilename, index, length);
+				}
+				this.write_at(target, buf[0:n], offset + got);
 				checksum.update(buf[0:n], n);
+				if (frontier != null) {
+					frontier.update(buf[0:n]);
+				}
+				got += n;
 				file.bytes_written += n;
-				file.sha256_partial = checksum.get_string();
+				this.received += n;
 				this.progress(new OLLMrpc.Notification() {
 					method = "event.hf.download.progress",
 					object_type = "ModelFile",
@@ -231,17 +518,108 @@ namespace OLLMhf
 				});
 				var now = GLib.get_monotonic_time();
 				if (now - this.last_persist_time >= 5000000
-					|| file.bytes_written - this.last_persist_bytes >= 8 * 1024 * 1024) {
-					var node = this.json.from_gobject(this.model);
-					var json_text = Json.to_string(node, true);
-					GLib.FileUtils.set_contents(download_path, json_text);
-					this.last_persist_time = now;
-					this.last_persist_bytes = file.bytes_written;
+					|| this.received - this.last_persist_bytes >= 8 * 1024 * 1024) {
+					this.persist();
 				}
 			}
-			out_stream.close();
+			if (length >= 0 && got != length) {
+				throw new GLib.IOError.FAILED(
+					"size mismatch for %s segment %d: got %lld expected %lld",
+					file.rfilename, index, got, length);
+			}
+			// the saved hash state must never run ahead of the data on disk
+			if (Posix.fsync(target.fd) != 0) {
+				throw new GLib.IOError.FAILED("sync %s: %s",
+					target.partial_path, GLib.strerror(GLib.errno));
+			}
+			var hashes = file.segment_sha256;
+			hashes[index] = checksum.get_string();
+			file.segment_sha256 = hashes;
+			if (frontier != null) {
+				target.fold(frontier);
+			}
+			this.persist();
+		}
 
-			var digest = checksum.get_string();
+		/**
+		 * Fold finished segments that arrived ahead of the hash into it in
+		 * order, checking each against its segment hash as it is read back, and
+		 * finish the target once every segment is in. Only one call per
+		 * target reads at a time; a concurrent call returns and the running
+		 * one picks up the new segment.
+		 */
+		private async void advance_hash(Target target) throws GLib.Error
+		{
+			if (target.hashing || target.file.download_complete) {
+				return;
+			}
+			target.hashing = true;
+			try {
+				var file = target.file;
+				var buf = new uint8[65536];
+				var refetched = -1;
+				var folded = false;
+				while (target.hashed < file.segment_sha256.length
+					&& file.segment_sha256[target.hashed] != "") {
+					var index = target.hashed;
+					if (target.reader == null) {
+						target.reader = yield GLib.File.new_for_path(target.partial_path).read_async(
+							GLib.Priority.DEFAULT, this.stop_cancellable);
+					}
+					target.reader.seek(target.start_of(index), GLib.SeekType.SET, this.stop_cancellable);
+					var length = file.segment_size > 0 ? target.length_of(index) : int64.MAX;
+					var seg = new GLib.Checksum(GLib.ChecksumType.SHA256);
+					var whole = target.whole.copy();
+					int64 read = 0;
+					while (read < length) {
+						var want = (size_t) int64.min(buf.length, length - read);
+						var n = yield target.reader.read_async(
+							buf[0:want], GLib.Priority.DEFAULT, this.stop_cancellable);
+						if (n <= 0) {
+							break;
+						}
+						seg.update(buf[0:n], n);
+						whole.update(buf[0:n]);
+						read += n;
+					}
+					if (seg.get_string() != file.segment_sha256[index]) {
+						// lost or torn on disk (e.g. a crash before the data was flushed)
+						if (refetched == index) {
+							throw new GLib.IOError.FAILED("%s: segment %d does not read back as written",
+								file.rfilename, index);
+						}
+						refetched = index;
+						if (file.segment_size > 0) {
+							file.bytes_written -= length;
+						}
+						var hashes = file.segment_sha256;
+						hashes[index] = "";
+						file.segment_sha256 = hashes;
+						yield this.fetch_segment(target, index);
+						continue;
+					}
+					target.fold(whole);
+					folded = true;
+				}
+				if (target.hashed == file.segment_sha256.length) {
+					this.finish_target(target);
+				} else if (folded) {
+					this.persist();
+				}
+			} finally {
+				target.hashing = false;
+			}
+		}
+
+		/**
+		 * Check the whole-file hash and size, then move ''.partial'' into
+		 * place.
+		 */
+		private void finish_target(Target target) throws GLib.Error
+		{
+			var file = target.file;
+			target.close();
+			var digest = target.whole.get_string();
 			if (file.etag != "" && digest != file.etag) {
 				throw new GLib.IOError.FAILED("checksum mismatch for %s", file.rfilename);
 			}
@@ -251,11 +629,43 @@ namespace OLLMhf
 					file.rfilename, file.bytes_written, file.size);
 			}
 
-			GLib.File.new_for_path(partial_path).move(
-				GLib.File.new_for_path(dest_path), GLib.FileCopyFlags.OVERWRITE);
+			GLib.File.new_for_path(target.partial_path).move(
+				GLib.File.new_for_path(target.dest_path), GLib.FileCopyFlags.OVERWRITE);
+			file.sha256_partial = digest;
 			file.download_complete = true;
-			var persist_node = this.json.from_gobject(this.model);
-			GLib.FileUtils.set_contents(download_path, Json.to_string(persist_node, true));
+			this.persist();
+		}
+
+		/** pwrite all of data at offset in target's ''.partial'' file. */
+		private void write_at(Target target, uint8[] data, int64 offset) throws GLib.Error
+		{
+			size_t done = 0;
+			while (done < data.length) {
+				var n = Posix.pwrite(target.fd, (uint8*) data + done,
+					data.length - done, (Posix.off_t) (offset + (int64) done));
+				if (n < 0) {
+					if (GLib.errno == Posix.EINTR) {
+						continue;
+					}
+					throw new GLib.IOError.FAILED("write %s: %s",
+						target.partial_path, GLib.strerror(GLib.errno));
+				}
+				done += n;
+			}
+		}
+
+		private string resolve_url(ModelFile file)
+		{
+			return file.to_url(this.model.id, this.model.download_revision, this.hub_url);
+		}
+
+		/** Write resume state to ''download.json''. */
+		private void persist() throws GLib.Error
+		{
+			var node = this.json.from_gobject(this.model);
+			GLib.FileUtils.set_contents(this.download_path, Json.to_string(node, true));
+			this.last_persist_time = GLib.get_monotonic_time();
+			this.last_persist_bytes = this.received;
 		}
 	}
 }
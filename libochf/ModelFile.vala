@@ -38,9 +38,28 @@ namespace OLLMhf
 		/** LFS ETag from HEAD (SHA-256) for final verify. */
 		public string etag { get; set; default = ""; }
 
-		/** Incremental SHA-256 hex while streaming (resume). */
+		/** Whole-file SHA-256 hex, set once every segment has been hashed. */
 		public string sha256_partial { get; set; default = ""; }
 
+		/**
+		 * Bytes per download segment; 0 when the file is fetched as one
+		 * stream (no range support or unknown size).
+		 */
+		public int64 segment_size { get; set; default = 0; }
+
+		/** SHA-256 hex per download segment, ''""'' until that segment is written. */
+		public string[] segment_sha256 { get; set; default = {}; }
+
+		/**
+		 * {@link Sha256.to_state} of the whole-file hash over the first
+		 * {@link sha256_segments} segments, so a resume does not read them
+		 * back.
+		 */
+		public string sha256_state { get; set; default = ""; }
+
+		/** Segments folded into {@link sha256_state}. */
+		public int sha256_segments { get; set; default = 0; }
+
 		/** True when this sibling is fully downloaded and verified. */
 		public bool download_complete { get; set; default = false; }
 
@@ -53,11 +72,13 @@ namespace OLLMhf
 		 *
 		 * @param id       Hub repo id ''author/name''
 		 * @param revision Branch or commit (default ''main'')
+		 * @param hub_url  Hub base URL (no trailing slash)
 		 * @return         Hub CDN URL ''huggingface.co/MODEL_ID/resolve/REVISION/RFILENAME''
 		 *                 (HTTPS scheme prefix).
 		 */
-		public string to_url(string id, string revision = "main") {
-			return "https://huggingface.co/" + id
+		public string to_url(string id, string revision = "main",
+			string hub_url = "https://huggingface.co") {
+			return hub_url + "/" + id
 				+ "/resolve/" + revision + "/" + this.rfilename;
 		}
 	}
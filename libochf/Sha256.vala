@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+namespace OLLMhf
+{
+	/**
+	 * SHA-256 whose running state can be saved and restored.
+	 *
+	 * GLib.Checksum cannot be serialized, so a download that stops half
+	 * way would have to read every finished byte again to rebuild the
+	 * whole-file hash. {@link Download} keeps this state in
+	 * ''download.json'' ({@link ModelFile.sha256_state}) instead.
+	 *
+	 * {{{
+	 * var sha = new OLLMhf.Sha256();
+	 * sha.update(first_part);
+	 * var saved = sha.to_state();
+	 * // ... later, in another process
+	 * var resumed = OLLMhf.Sha256.from_state(saved);
+	 * resumed.update(second_part);
+	 * var hex = resumed.get_string();
+	 * }}}
+	 */
+	public class Sha256 : GLib.Object
+	{
+		private const uint32[] K = {
+			0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+			0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+			0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+			0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+			0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+			0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+			0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+			0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+		};
+
+		private uint32[] h = {
+			0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+			0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+		};
+		/** Bytes of an unfinished 64-byte block. */
+		private uint8[] block = new uint8[64];
+		private int fill = 0;
+		/** Total bytes hashed. */
+		private uint64 length = 0;
+		private uint32[] w = new uint32[64];
+
+		public void update(uint8[] data)
+		{
+			this.length += data.length;
+			var i = 0;
+			if (this.fill > 0) {
+				while (this.fill < 64 && i < data.length) {
+					this.block[this.fill++] = data[i++];
+				}
+				if (this.fill < 64) {
+					return;
+				}
+				this.compress(this.block, 0);
+				this.fill = 0;
+			}
+			for (; i + 64 <= data.length; i += 64) {
+				this.compress(data, i);
+			}
+			while (i < data.length) {
+				this.block[this.fill++] = data[i++];
+			}
+		}
+
+		/** Hex digest of everything hashed so far; the state is not changed. */
+		public string get_string()
+		{
+			var tail = this.copy();
+			var bits = this.length * 8;
+			var pad = new uint8[(this.fill < 56 ? 56 : 120) - this.fill + 8];
+			pad[0] = 0x80;
+			for (var i = 0; i < 8; i++) {
+				pad[pad.length - 1 - i] = (uint8) (bits >> (8 * i));
+			}
+			tail.update(pad);
+			var ret = new GLib.StringBuilder();
+			foreach (var word in tail.h) {
+				ret.append_printf("%08x", word);
+			}
+			return ret.str;
+		}
+
+		public Sha256 copy()
+		{
+			var ret = new Sha256();
+			ret.h = this.h;
+			ret.block = this.block;
+			ret.fill = this.fill;
+			ret.length = this.length;
+			return ret;
+		}
+
+		/**
+		 * Running state as text: the eight hash words, the byte count and
+		 * the unfinished block, for {@link from_state}.
+		 */
+		public string to_state()
+		{
+			var ret = new GLib.StringBuilder();
+			foreach (var word in this.h) {
+				ret.append_printf("%08x", word);
+			}
+			ret.append(":" + this.length.to_string() + ":");
+			for (var i = 0; i < this.fill; i++) {
+				ret.append_printf("%02x", this.block[i]);
+			}
+			return ret.str;
+		}
+
+		/**
+		 * Restore a {@link to_state} string.
+		 *
+		 * @return the hash, or null when state is not a valid state
+		 */
+		public static Sha256? from_state(string state)
+		{
+			var parts = state.split(":");
+			if (parts.length != 3 || parts[0].length != 64 || parts[2].length % 2 != 0) {
+				return null;
+			}
+			uint64 length;
+			if (!uint64.try_parse(parts[1], out length)
+					|| (int) (length % 64) != parts[2].length / 2) {
+				return null;
+			}
+			var ret = new Sha256();
+			ret.length = length;
+			for (var i = 0; i < 8; i++) {
+				uint32 word;
+				if (!hex_value(parts[0].substring(i * 8, 8), out word)) {
+					return null;
+				}
+				ret.h[i] = word;
+			}
+			ret.fill = parts[2].length / 2;
+			for (var i = 0; i < ret.fill; i++) {
+				uint32 byte;
+				if (!hex_value(parts[2].substring(i * 2, 2), out byte)) {
+					return null;
+				}
+				ret.block[i] = (uint8) byte;
+			}
+			return ret;
+		}
+
+		/** Parse up to eight hex digits. */
+		private static bool hex_value(string text, out uint32 value)
+		{
+			value = 0;
+			for (var i = 0; i < text.length; i++) {
+				var digit = text[i].xdigit_value();
+				if (digit < 0) {
+					return false;
+				}
+				value = (value << 4) | (uint32) digit;
+			}
+			return true;
+		}
+
+		private static inline uint32 rotr(uint32 x, int n)
+		{
+			return (x >> n) | (x << (32 - n));
+		}
+
+		/** Fold the 64 bytes of data at offset into the hash words. */
+		private void compress(uint8[] data, int offset)
+		{
+			for (var i = 0; i < 16; i++) {
+				var p = offset + i * 4;
+				this.w[i] = ((uint32) data[p] << 24) | ((uint32) data[p + 1] << 16)
+					| ((uint32) data[p + 2] << 8) | (uint32) data[p + 3];
+			}
+			for (var i = 16; i < 64; i++) {
+				var s0 = rotr(this.w[i - 15], 7) ^ rotr(this.w[i - 15], 18) ^ (this.w[i - 15] >> 3);
+				var s1 = rotr(this.w[i - 2], 17) ^ rotr(this.w[i - 2], 19) ^ (this.w[i - 2] >> 10);
+				this.w[i] = this.w[i - 16] + s0 + this.w[i - 7] + s1;
+			}
+			uint32 a = this.h[0], b = this.h[1], c = this.h[2], d = this.h[3];
+			uint32 e = this.h[4], f = this.h[5], g = this.h[6], hh = this.h[7];
+			for (var i = 0; i < 64; i++) {
+				var t1 = hh + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25))
+					+ ((e & f) ^ (~e & g)) + K[i] + this.w[i];
+				var t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22))
+					+ ((a & b) ^ (a & c) ^ (b & c));
+				hh = g;
+				g = f;
+				f = e;
+				e = d + t1;
+				d = c;
+				c = b;
+				b = a;
+				a = t1 + t2;
+			}
+			this.h[0] += a;
+			this.h[1] += b;
+			this.h[2] += c;
+			this.h[3] += d;
+			this.h[4] += e;
+			this.h[5] += f;
+			this.h[6] += g;
+			this.h[7] += hh;
+		}
+	}
+}
@@ -62,7 +62,8 @@
  *
  * == Download ==
  *
- * Download streams ''.gguf'' siblings to the local models tree.
+ * Download fetches ''.gguf'' siblings to the local models tree, several
+ * byte-range segments at a time, and resumes from ''download.json''.
  *
  * {{{
  * var dl = new OLLMhf.Download(model);
@@ -570,12 +570,12 @@ namespace Markdown
 		 */
 		public bool check_fenced_newline(ref int chunk_pos, string chunk)
 		{
-			var remaining = chunk.substring(chunk_pos, chunk.length - chunk_pos);
-			if (!remaining.contains("\n")) {
-				this.parser.renderer.on_node(FormatType.CODE_TEXT, false, remaining);
+			// Find the line end first; only copy the remainder when there is none.
+			var newline_pos = chunk.index_of_char('\n', chunk_pos);
+			if (newline_pos == -1) {
+				this.parser.renderer.on_node(FormatType.CODE_TEXT, false, chunk.substring(chunk_pos));
 				return true;
 			}
-			var newline_pos = chunk.index_of_char('\n', chunk_pos);
 			var code_text = chunk.substring(chunk_pos, newline_pos - chunk_pos);
 			this.parser.renderer.on_node(FormatType.CODE_TEXT, false, code_text);
 			chunk_pos = newline_pos;
@@ -597,12 +597,11 @@ namespace Markdown
 				return true;
 			}
 			if (fence_result == 0) {
-				var remaining = chunk.substring(chunk_pos, chunk.length - chunk_pos);
-				if (!remaining.contains("\n")) {
-					this.parser.renderer.on_node(FormatType.CODE_TEXT, false, remaining);
+				var newline_pos = chunk.index_of_char('\n', chunk_pos);
+				if (newline_pos == -1) {
+					this.parser.renderer.on_node(FormatType.CODE_TEXT, false, chunk.substring(chunk_pos));
 					return true;
 				}
-				var newline_pos = chunk.index_of_char('\n', chunk_pos);
 				var code_text = chunk.substring(chunk_pos, newline_pos - chunk_pos);
 				this.parser.renderer.on_node(FormatType.CODE_TEXT, false, code_text);
 				chunk_pos = newline_pos;
@@ -111,6 +111,9 @@ namespace Markdown
 				 default = new Gee.HashMap<string, string>(); }
 		// Track if we've converted already
 		private bool converted = false;
+		// Incremental parse (push / finish)
+		private Html.ParserCtxt? push_ctxt = null;
+		private Xml.SAXHandler push_sax;
 
 		/**
 		 * Constructor.
@@ -139,13 +142,7 @@ namespace Markdown
 
 			this.reset();
 
-			// Create SAX 
-			Xml.SAXHandler sax_handler = Xml.SAXHandler();
-			sax_handler.startDocument = sax_start_document;
-			sax_handler.endDocument = sax_end_document;
-			sax_handler.startElement = sax_start_element;
-			sax_handler.endElement = sax_end_element;
-			sax_handler.characters = sax_characters;
+			var sax_handler = this.sax_handler();
 
 			// Parse HTML with libxml2 HTML parser
 			var doc = Html.Doc.sax_parse_doc(this.html, "UTF-8", &sax_handler, (void*)this);
@@ -158,6 +155,60 @@ namespace Markdown
 
 			return this.writer.to_string();
 		}
+
+		/**
+		 * Incremental conversion: feed HTML as it arrives, then call
+		 * {@link finish}. Output so far is in {@link writer}, so a caller can
+		 * stop feeding once it has enough (see {@link Writer.line_count}).
+		 *
+		 * @param chunk next bytes of the document (any split, UTF-8)
+		 */
+		public void push(uint8[] chunk)
+		{
+			if (this.converted) {
+				return;
+			}
+			if (this.push_ctxt == null) {
+				this.reset();
+				this.push_sax = this.sax_handler();
+				this.push_ctxt = new Html.ParserCtxt.create_push(
+					&this.push_sax, (void*)this, null, 0, null, Xml.CharEncoding.UTF8);
+			}
+			this.push_ctxt.parse_chunk((char[])chunk, chunk.length, false);
+		}
+
+		/**
+		 * End an incremental conversion started with {@link push}; open
+		 * elements are closed as if the document ended here.
+		 *
+		 * @return Converted markdown string
+		 */
+		public string finish()
+		{
+			if (this.converted) {
+				return this.writer.to_string();
+			}
+			if (this.push_ctxt != null) {
+				char[] none = {};
+				this.push_ctxt.parse_chunk(none, 0, true);
+				this.push_ctxt = null;
+			}
+			this.writer.clean_up_markdown();
+			this.converted = true;
+			return this.writer.to_string();
+		}
+
+		private Xml.SAXHandler sax_handler()
+		{
+			Xml.SAXHandler sax_handler = Xml.SAXHandler();
+			sax_handler.startDocument = sax_start_document;
+			sax_handler.endDocument = sax_end_document;
+			sax_handler.startElement = sax_start_element;
+			sax_handler.endElement = sax_end_element;
+			sax_handler.characters = sax_characters;
+			return sax_handler;
+		}
+
 		public void start_element(string name, string[]? attrs)
 		{ 
 			this.writer.update_prev_ch();
@@ -42,6 +42,7 @@ namespace Markdown
 		private uint current_blockquote_level = 0; // Track current blockquote nesting level (1-6)
 		private bool prev_text_ended_with_newline = false; // Track if previous on_text call ended with \n
 		private bool prev_line_was_empty = false; // Track if previous line was empty
+		private Document.BlockCache? block_cache = null; // Per-block output for render_document()
 		
 		/**
 		 * Gets the current indentation level based on open tags.
@@ -120,19 +121,56 @@ namespace Markdown
 		 */
 		public string toHtml(string markdown_text)
 		{
-			this.html_output = new StringBuilder();
-			this.open_tags.clear();
-			this.list_stack.clear();
-			this.current_list_indent = 0;
-			this.prev_text_ended_with_newline = false;
-			this.prev_line_was_empty = false;
+			this.reset_output();
 				
 			// Use parser to process markdown
 			this.start();
 			this.add(markdown_text);
 			this.flush();
 			
-			// Close any remaining open tags (including lists)
+			return this.finish_output();
+		}
+
+		/**
+		 * Converts a parsed document to HTML, re-rendering only the top-level
+		 * blocks that changed since the previous call on this renderer.
+		 *
+		 * Feed a {@link Document.Render} (streamed or complete) and call this
+		 * as often as needed; unchanged blocks come from {@link Document.BlockCache}.
+		 *
+		 * @param doc The document to render
+		 * @return HTML string
+		 */
+		public string render_document(Document.Document doc)
+		{
+			if (this.block_cache == null) {
+				this.block_cache = new Document.BlockCache();
+			}
+			return this.block_cache.render(doc, this.render_node);
+		}
+
+		/** HTML for one top-level node, from a clean output state. */
+		private string render_node(Document.Node node)
+		{
+			this.reset_output();
+			node.emit(this);
+			return this.finish_output();
+		}
+
+		private void reset_output()
+		{
+			this.html_output = new StringBuilder();
+			this.open_tags.clear();
+			this.list_stack.clear();
+			this.current_list_indent = 0;
+			this.current_blockquote_level = 0;
+			this.prev_text_ended_with_newline = false;
+			this.prev_line_was_empty = false;
+		}
+
+		/** Close any remaining open tags (including lists) and return the output. */
+		private string finish_output()
+		{
 			while (this.open_tags.size > 0) {
 				this.close_tag(this.open_tags.get(this.open_tags.size - 1));
 			}
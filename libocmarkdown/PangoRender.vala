@@ -45,6 +45,8 @@ namespace Markdown
 		private Gee.ArrayList<string> open_tags;
 		/** Indent at each nesting level (space_skip). Used only to compute how many tabs for this line. */
 		private Gee.ArrayList<int> indent_levels;
+		/** Per-block output for {@link render_document}. */
+		private Document.BlockCache? block_cache = null;
 
 		/**
 		 * Creates a new PangoRender instance.
@@ -78,15 +80,49 @@ namespace Markdown
 		 */
 		public string toPango(string html_text)
 		{
-			this.pango_markup = new StringBuilder();
-			this.open_tags.clear();
-			this.indent_levels.clear();
+			this.reset_output();
 			
 			// Use parser to process HTML tags
 			this.start();
 			this.add(html_text);
 			this.flush();
 			
+			return this.finish_output();
+		}
+
+		/**
+		 * Converts a parsed document to Pango markup, re-rendering only the
+		 * top-level blocks that changed since the previous call on this renderer
+		 * (see {@link Document.BlockCache}).
+		 *
+		 * @param doc The document to render
+		 * @return Pango markup string
+		 */
+		public string render_document(Document.Document doc)
+		{
+			if (this.block_cache == null) {
+				this.block_cache = new Document.BlockCache();
+			}
+			return this.block_cache.render(doc, this.render_node);
+		}
+
+		/** Markup for one top-level node, from a clean output state. */
+		private string render_node(Document.Node node)
+		{
+			this.reset_output();
+			node.emit(this);
+			return this.finish_output();
+		}
+
+		private void reset_output()
+		{
+			this.pango_markup = new StringBuilder();
+			this.open_tags.clear();
+			this.indent_levels.clear();
+		}
+
+		private string finish_output()
+		{
 			// Close any remaining open tags
 			// Map tag names back to the appropriate method calls
 			while (this.open_tags.size > 0) {
@@ -193,6 +193,60 @@ namespace Markdown
 		/** True when at the first character of list item content (after marker); avoid ending list on block_match == 0 there. */
 		public bool at_list_start { get; set; default = false; }
 
+		/**
+		 * Byte lookup for the inline scanner: true for ASCII bytes that can start
+		 * markup or end a text run mid-line (format markers, escape, whitespace).
+		 * Every other ASCII byte is plain text that no map can match, so
+		 * {@link skip_plain} steps over it without calling the maps.
+		 */
+		private static bool[] special_bytes = null;
+
+		private static void init_scan()
+		{
+			if (special_bytes != null) {
+				return;
+			}
+			special_bytes = new bool[256];
+			var marks = "*_`[<#>|~\\ \t\n\r\v\f";
+			for (var i = 0; i < marks.length; i++) {
+				special_bytes[(uint8) marks[i]] = true;
+			}
+		}
+
+		/**
+		 * Returns the byte offset after the run of plain inline text starting at pos.
+		 *
+		 * Plain means the character can never change parser state mid-line: not in
+		 * {@link special_bytes} and, for multi-byte characters, not whitespace (LeftMap
+		 * and the TEXT flush both key off unichar.isspace()). Returns pos unchanged when
+		 * the first character needs the full per-character checks.
+		 *
+		 * @param text The chunk being scanned
+		 * @param pos Byte offset to start at
+		 * @param text_len Byte length of text (callers cache it; strlen per step is O(n²))
+		 */
+		private int skip_plain(string text, int pos, int text_len)
+		{
+			while (pos < text_len) {
+				var b = (uint8) text[pos];
+				if (b < 0x80) {
+					if (special_bytes[b]) {
+						return pos;
+					}
+					pos++;
+					continue;
+				}
+				var next_pos = pos;
+				unichar c;
+				text.get_next_char(ref next_pos, out c);
+				if (c.isspace()) {
+					return pos;
+				}
+				pos = next_pos;
+			}
+			return pos;
+		}
+
 		/**
 		 * Creates a new Parser instance.
 		 * 
@@ -200,6 +254,7 @@ namespace Markdown
 		 */
 		public Parser(RenderBase renderer)
 		{
+			Parser.init_scan();
 			this.renderer = renderer;
 			this.formatmap = new FormatMap(this);
 			this.blockmap = new BlockMap(this);
@@ -280,8 +335,10 @@ namespace Markdown
 			var str = "";
 			// Start of current TEXT run in chunk, not yet merged into str (bytes). Slice: [text_start_pos, chunk_pos).
 			var text_start_pos = 0;
+			// chunk only changes via handle_format_result (HTML); refreshed there.
+			var chunk_len = chunk.length;
 
-			while (chunk_pos < chunk.length) {
+			while (chunk_pos < chunk_len) {
 				saved_chunk_pos = chunk_pos;
 				var c = chunk.get_char(chunk_pos);
 				
@@ -415,6 +472,16 @@ namespace Markdown
 					continue;
 				}
 
+				// Mid-line plain run: extend the pending TEXT slice in one step instead of
+				// peeking every map per character; the next special byte flushes it.
+				if (!this.at_line_start) {
+					var plain_end = this.skip_plain(chunk, chunk_pos, chunk_len);
+					if (plain_end > chunk_pos) {
+						chunk_pos = plain_end;
+						continue;
+					}
+				}
+
 				// At line start - check for block markers
 				if (this.at_line_start) {
 					string block_lang = "";
@@ -582,6 +649,7 @@ namespace Markdown
 					assert(str == "" && text_start_pos == chunk_pos);
 					return;
 				}
+				chunk_len = chunk.length;
 				// If we consumed (chunk_pos advanced), continue; else no match - advance here
 				if (chunk_pos != saved_chunk_pos) {
 					this.at_line_start = false;
@@ -812,8 +880,9 @@ namespace Markdown
 		{
 			var pos = 0;
 			var str = "";
+			var text_len = text.length;
 			this.at_line_start = true;
-			while (pos < text.length) {
+			while (pos < text_len) {
 				// Escape: \ + next char → emit next as literal, advance by 1 + next char byte length
 				if (text.get_char(pos) == '\\' && pos + 1 < text.length) {
 					this.renderer.on_node(FormatType.TEXT, false, str);
@@ -855,6 +924,15 @@ namespace Markdown
 					continue;
 				}
 
+				if (!this.at_line_start) {
+					var plain_end = this.skip_plain(text, pos, text_len);
+					if (plain_end > pos) {
+						str += text.substring(pos, plain_end - pos);
+						pos = plain_end;
+						continue;
+					}
+				}
+
 				// At line start - check start-of-line emphasis (*, _)
 				if (this.at_line_start) {
 					FormatType start_matched = FormatType.NONE;
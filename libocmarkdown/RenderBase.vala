@@ -50,9 +50,10 @@ namespace Markdown
 
 		/**
 		 * Finalizes the current chunk. Call this before starting a new chunk with add_start
-		 * to ensure all pending content is processed.
+		 * to ensure all pending content is processed. Renderers that buffer
+		 * text override this to hand it to the parser first.
 		 */
-		public void flush()
+		public virtual void flush()
 		{
 			this.parser.flush();
 		}
@@ -62,7 +63,7 @@ namespace Markdown
 		 * 
 		 * Resets the parser's internal state. Should be called when beginning a new content block.
 		 */
-		public void start()
+		public virtual void start()
 		{
 			this.parser.start();
 		}
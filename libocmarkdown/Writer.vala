@@ -34,6 +34,8 @@ namespace Markdown
 		public StringBuilder table_line = new StringBuilder();
 		public bool is_in_code_block = false; // Track if we're currently inside a code block
 		private int consecutive_newlines = 0; // Track consecutive newlines for filtering
+		private int lines = 0; // Newlines in md before lines_scanned (see line_count)
+		private size_t lines_scanned = 0;
 
 		public Writer()
 		{
@@ -184,7 +186,14 @@ namespace Markdown
 				chars = (int)this.md.len;
 			}
 
-			var new_str = this.md.str.substring(0, (int)(this.md.len - chars));
+			var new_len = this.md.len - chars;
+			for (; this.lines_scanned > new_len; this.lines_scanned--) {
+				if (this.md.str[(long)this.lines_scanned - 1] == '\n') {
+					this.lines--;
+				}
+			}
+
+			var new_str = this.md.str.substring(0, (int)new_len);
 			this.md = new StringBuilder();
 			this.md.append(new_str);
 
@@ -210,6 +219,26 @@ namespace Markdown
 			this.table_line = new StringBuilder();
 			this.consecutive_newlines = 0;
 			this.is_in_code_block = false;
+			this.lines = 0;
+			this.lines_scanned = 0;
+		}
+
+		/**
+		 * Lines written so far (before {@link clean_up_markdown}, which only
+		 * ever joins lines).
+		 *
+		 * Only text appended since the last call is scanned, so calling this
+		 * after every chunk of a streamed document stays linear.
+		 */
+		public int line_count()
+		{
+			unowned string s = this.md.str;
+			for (; this.lines_scanned < this.md.len; this.lines_scanned++) {
+				if (s[(long)this.lines_scanned] == '\n') {
+					this.lines++;
+				}
+			}
+			return this.lines;
 		}
 
 		/**
@@ -287,6 +316,9 @@ namespace Markdown
 					this.md.append(new_str.substring(0, (int)offset));
 					this.md.append_c('\n');
 					this.md.append(new_str.substring((int)offset + 1));
+					if (offset < this.lines_scanned) {
+						this.lines++;
+					}
 					this.chars_in_curr_line = (int)this.md.len - (int)offset;
 					return true;
 				}
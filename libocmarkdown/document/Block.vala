@@ -137,6 +137,56 @@ namespace Markdown.Document
 			return ret;
 		}
 
+		public override void emit(RenderBase renderer)
+		{
+			switch (this.kind) {
+				case FormatType.HORIZONTAL_RULE:
+					renderer.on_node(FormatType.HORIZONTAL_RULE, false);
+					return;
+				case FormatType.FENCE_QUOTE_3:
+				case FormatType.FENCE_QUOTE_4:
+				case FormatType.FENCE_QUOTE_5:
+				case FormatType.FENCE_TILD_3:
+				case FormatType.FENCE_TILD_4:
+				case FormatType.FENCE_TILD_5:
+					renderer.on_node(this.kind, true, this.lang, this.fence_indent);
+					if (this.code_text != "") {
+						renderer.on_node(FormatType.CODE_TEXT, false, this.code_text);
+					}
+					renderer.on_node(this.kind, false);
+					return;
+				case FormatType.HEADING_1:
+				case FormatType.HEADING_2:
+				case FormatType.HEADING_3:
+				case FormatType.HEADING_4:
+				case FormatType.HEADING_5:
+				case FormatType.HEADING_6:
+					// update_header() changes level without kind; level wins, as in to_markdown()
+					var heading = this.level >= 1 && this.level <= 6
+						? (FormatType) (FormatType.HEADING_1 + this.level - 1) : this.kind;
+					renderer.on_node(heading, true);
+					base.emit(renderer);
+					renderer.on_node(heading, false);
+					return;
+				case FormatType.BLOCKQUOTE:
+					renderer.on_node_int(FormatType.BLOCKQUOTE, true, (int) this.level);
+					base.emit(renderer);
+					renderer.on_node_int(FormatType.BLOCKQUOTE, false, (int) this.level);
+					return;
+				case FormatType.TABLE_HCELL:
+				case FormatType.TABLE_CELL:
+					renderer.on_node_int(this.kind, true, this.align);
+					base.emit(renderer);
+					renderer.on_node_int(this.kind, false, this.align);
+					return;
+				default:
+					renderer.on_node(this.kind, true);
+					base.emit(renderer);
+					renderer.on_node(this.kind, false);
+					return;
+			}
+		}
+
 		public override string to_markdown()
 		{
 			string inner = "";
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+namespace Markdown.Document
+{
+	/**
+	 * Per-block output cache for string renderers (HtmlRender, PangoRender).
+	 *
+	 * Holds the output of each top-level node together with the
+	 * {@link Node.revision} it was rendered at. {@link render} only calls back
+	 * for nodes that are new or were touched since, so re-rendering a
+	 * document that a {@link Render} is still being streamed into costs one
+	 * call per changed block instead of one per block.
+	 */
+	public class BlockCache : Object
+	{
+		/** Render one top-level node from a clean renderer state. */
+		public delegate string RenderNode(Node node);
+
+		private class Entry
+		{
+			public int revision;
+			public string output;
+		}
+
+		private Gee.HashMap<int, Entry> entries = new Gee.HashMap<int, Entry>();
+
+		/** Number of nodes rendered by the last {@link render} call (the rest came from cache). */
+		public int last_rendered { get; private set; default = 0; }
+
+		/**
+		 * Output for the whole document, rendering only changed blocks.
+		 * Entries for nodes no longer in the document are dropped.
+		 *
+		 * @param doc document to render
+		 * @param render_node renders a single top-level node
+		 * @return concatenated output of every top-level node, in order
+		 */
+		public string render(Document doc, RenderNode render_node)
+		{
+			var next = new Gee.HashMap<int, Entry>();
+			var ret = new StringBuilder();
+			this.last_rendered = 0;
+			foreach (var node in doc.children) {
+				var entry = this.entries.get(node.uid);
+				if (entry == null || entry.revision != node.revision) {
+					entry = new Entry() {
+						revision = node.revision,
+						output = render_node(node)
+					};
+					this.last_rendered++;
+				}
+				next.set(node.uid, entry);
+				ret.append(entry.output);
+			}
+			this.entries = next;
+			return ret.str;
+		}
+
+		/** Forget all cached output (e.g. after a theme or option change). */
+		public void clear()
+		{
+			this.entries.clear();
+		}
+	}
+}
@@ -21,6 +21,9 @@ namespace Markdown.Document
 		/** Next uid to assign; increment when creating a new node so each node has a unique uid. */
 		public int uid_count { get; set; default = 1; }
 
+		/** Last stamp handed out by {@link Node.touch}; bumped on every change. Not serialized. */
+		public int revision_count { get; set; default = 0; }
+
 		/** Heading text (stripped) → Block; populated when blocks are adopted (Render) or after deserializing children. Not serialized. */
 		public Gee.HashMap<string, Block> headings {
 			get; private set; default = new Gee.HashMap<string, Block>(); }
@@ -92,6 +95,48 @@ namespace Markdown.Document
 			return node;
 		}
 
+		/**
+		 * Replays every top-level node (see {@link emit_child}).
+		 */
+		public override void emit(RenderBase renderer)
+		{
+			for (var i = 0; i < this.children.size; i++) {
+				this.emit_child(renderer, i);
+			}
+		}
+
+		/**
+		 * Replays one top-level node and the line breaks the parser would
+		 * send after it for to_markdown() output, as TEXT "\n" (lists,
+		 * tables and fences close on their own, as in the parser). Lets a
+		 * renderer record where each block starts and ends.
+		 *
+		 * @param renderer target renderer
+		 * @param i index into {@link children}
+		 */
+		public void emit_child(RenderBase renderer, int i)
+		{
+			var child = this.children.get(i);
+			child.emit(renderer);
+			if (!(child is Block)) {
+				return;
+			}
+			var kind = ((Block) child).kind;
+			if (kind == FormatType.TABLE || kind.is_fence_kind()) {
+				return;
+			}
+			renderer.on_node(FormatType.TEXT, false, "\n");
+			if (i + 1 >= this.children.size) {
+				return;
+			}
+			var next = this.children.get(i + 1);
+			if (kind == FormatType.BLOCKQUOTE && next is Block
+				&& ((Block) next).kind == FormatType.BLOCKQUOTE) {
+				return;
+			}
+			renderer.on_node(FormatType.TEXT, false, "\n");
+		}
+
 		public override string to_markdown()
 		{
 			if (this.children.size == 0) {
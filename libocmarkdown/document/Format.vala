@@ -42,6 +42,47 @@ namespace Markdown.Document
 			this.text = s;
 		}
 
+		public override void emit(RenderBase renderer)
+		{
+			switch (this.kind) {
+				case FormatType.TEXT:
+					renderer.on_node(FormatType.TEXT, false, this.text);
+					return;
+				case FormatType.IMAGE:
+					renderer.on_node(FormatType.IMAGE, false, this.src, this.title);
+					return;
+				case FormatType.BR:
+				case FormatType.TASK_LIST:
+				case FormatType.TASK_LIST_DONE:
+					renderer.on_node(this.kind, true);
+					return;
+				case FormatType.LINK:
+					renderer.on_a(true, this.href, this.title, this.is_reference);
+					base.emit(renderer);
+					renderer.on_a(false, this.href, this.title, this.is_reference);
+					return;
+				case FormatType.HTML:
+					renderer.on_node(FormatType.HTML, true, this.tag, this.tag_attributes);
+					base.emit(renderer);
+					renderer.on_node(FormatType.HTML, false, this.tag, "");
+					return;
+				case FormatType.OTHER:
+					renderer.on_node(FormatType.OTHER, true, this.tag_name);
+					base.emit(renderer);
+					renderer.on_node(FormatType.OTHER, false, this.tag_name);
+					return;
+				default:
+					renderer.on_node(this.kind, true);
+					// Document.create() may put text directly on a format node
+					if (this.children.size == 0 && this.text != "") {
+						renderer.on_node(FormatType.TEXT, false, this.text);
+					}
+					base.emit(renderer);
+					renderer.on_node(this.kind, false);
+					return;
+			}
+		}
+
 		/**
 		 * Absolute path for this link when it is a file reference (scheme "file").
 		 * Returns path if already absolute, otherwise resolves path relative to to_path.
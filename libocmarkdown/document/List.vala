@@ -43,6 +43,42 @@ namespace Markdown.Document
 			return result;
 		}
 
+		/**
+		 * The parser sends one LIST_BLOCK around the whole list and closes each
+		 * item before the next line, nested ones included (Render rebuilds the
+		 * nesting from space_skip). So an item's nested lists are emitted after
+		 * its on_li(false), and only the outermost list opens LIST_BLOCK.
+		 */
+		public override void emit(RenderBase renderer)
+		{
+			var outer = !(this.parent is ListItem);
+			if (outer) {
+				renderer.on_node_int(FormatType.LIST_BLOCK, true, 0);
+			}
+			var number = 1;
+			foreach (var child in this.children) {
+				var item = child as ListItem;
+				if (item == null) {
+					continue;
+				}
+				renderer.on_li(true,
+					this.ordered ? number : 0,
+					this.indentation,
+					item.is_task_item ? (item.task_checked ? 1 : 0) : -1);
+				number++;
+				item.emit(renderer);
+				renderer.on_li(false);
+				foreach (var sub in item.children) {
+					if (sub is List) {
+						sub.emit(renderer);
+					}
+				}
+			}
+			if (outer) {
+				renderer.on_node_int(FormatType.LIST_BLOCK, false, 0);
+			}
+		}
+
 		public override string to_markdown()
 		{
 			string line_prefix = string.nfill((int)this.indentation, ' ');
@@ -81,6 +81,17 @@ namespace Markdown.Document
 			}
 		}
 
+		/** Item content only; nested lists are emitted by the owning {@link List} after on_li(false). */
+		public override void emit(RenderBase renderer)
+		{
+			foreach (var child in this.children) {
+				if (child is List) {
+					continue;
+				}
+				child.emit(renderer);
+			}
+		}
+
 		public override string to_markdown()
 		{
 			var result = this.is_task_item ? (this.task_checked ? "[x] " : "[ ] ") : "";
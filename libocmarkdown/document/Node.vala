@@ -30,6 +30,15 @@ namespace Markdown.Document
 		/** Unique id within the document; assigned when the node is created. Used for traversal and position lookup. */
 		public int uid { get; set; default = -1; }
 
+		/**
+		 * Change stamp for top-level nodes (children of the {@link Document}).
+		 * {@link touch} sets it from {@link Document.revision_count} whenever
+		 * anything below the node is added or extended; caches such as
+		 * {@link BlockCache} compare it to skip blocks that have not changed.
+		 * Not serialized.
+		 */
+		public int revision { get; set; default = 0; }
+
 		/** Call when adding a child: child.parent = this (omit for Format if desired). */
 		public void adopt(Node child)
 		{
@@ -37,6 +46,40 @@ namespace Markdown.Document
 			child.parent = this;
 		}
 
+		/**
+		 * Mark the top-level node containing this one as changed (see {@link revision}).
+		 * No-op for nodes that are not yet attached to a document.
+		 */
+		public void touch()
+		{
+			Node n = this;
+			while (n.parent != null && !(n.parent is Document)) {
+				n = n.parent;
+			}
+			var doc = n.parent as Document;
+			if (doc == null) {
+				return;
+			}
+			doc.revision_count++;
+			n.revision = doc.revision_count;
+		}
+
+		/**
+		 * Replay this node into a renderer as the callbacks the parser would
+		 * have made for it, so a parsed document can be drawn again (another
+		 * output, another theme) without parsing the markdown a second time.
+		 * Base implementation emits the children; subclasses add their own
+		 * start/end callbacks around them.
+		 *
+		 * @param renderer target renderer (its parser is not used)
+		 */
+		public virtual void emit(RenderBase renderer)
+		{
+			foreach (var child in this.children) {
+				child.emit(renderer);
+			}
+		}
+
 		/** Root document; null if this node is not in a document tree. */
 		public Document? document()
 		{
@@ -104,6 +147,9 @@ namespace Markdown.Document
 				case "header_list":
 				case "header-list":
 				case "parent":
+				case "revision":
+				case "revision_count":
+				case "revision-count":
 					return null;
 				case "node_type":
 				case "node-type":
@@ -150,6 +196,9 @@ namespace Markdown.Document
 				case "header_list":
 				case "header-list":
 				case "parent":
+				case "revision":
+				case "revision_count":
+				case "revision-count":
 					return false;
 					
 				case "node_type":
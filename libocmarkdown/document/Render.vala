@@ -60,6 +60,7 @@ namespace Markdown.Document
 			}
 			if (this.current_block_with_inlines != null) {
 				this.current_block_with_inlines.children.add(f);
+				this.current_block_with_inlines.touch();
 			}
 		}
 
@@ -69,6 +70,7 @@ namespace Markdown.Document
 			b.uid = this.document.uid_count++;
 			var parent = this.block_stack.get(this.block_stack.size - 1) as Node;
 			parent.adopt(b);
+			b.touch();
 		}
 
 		/** Append block to current parent and push it onto the block stack; set current_block_with_inlines when block can hold inlines. */
@@ -94,6 +96,7 @@ namespace Markdown.Document
 			list.uid = this.document.uid_count++;
 			var parent = this.block_stack.get(this.block_stack.size - 1) as Node;
 			parent.adopt(list);
+			list.touch();
 			this.block_stack.add(list);
 		}
 
@@ -216,6 +219,7 @@ namespace Markdown.Document
 						row.uid = this.document.uid_count++;
 						var table = this.block_stack.get(this.block_stack.size - 1) as Node;
 						table.adopt(row);
+						row.touch();
 						this.block_stack.add(row);
 						return;
 					} 
@@ -234,6 +238,7 @@ namespace Markdown.Document
 						return;
 					}
 					pb.code_text += s1;
+					pb.touch();
 					return;
 				case FormatType.HORIZONTAL_RULE:
 					this.append_block(new Block(FormatType.HORIZONTAL_RULE));
@@ -252,6 +257,7 @@ namespace Markdown.Document
 						this.current_list_item.is_task_item = true;
 						this.last_task_checked = (type == FormatType.TASK_LIST_DONE);
 						this.current_list_is_task_list = true;
+						this.current_list_item.touch();
 						return;
 					}
 					// In paragraph/heading/blockquote/table or after other inlines: emit as literal.
@@ -334,6 +340,7 @@ namespace Markdown.Document
 			}
 			if (parent != null) {
 				parent.adopt(item);
+				item.touch();
 			}
 			this.block_stack.add(item);
 			if (this.current_block_with_inlines != null) {
@@ -60,7 +60,45 @@ namespace MarkdownGtk
 		public bool scroll_to_end { get; set; default = true; }
 		/** Set by the app after construction, before add() for each assistant feed; read at on_code_block. */
 		public bool is_streaming { get; set; }
+		/**
+		 * When true (and {@link is_streaming}), {@link add} queues text and the
+		 * parser runs once per frame from a tick callback on {@link box}, so a
+		 * fast stream costs one buffer update / relayout per frame instead of
+		 * one per chunk. Any other entry point renders the queue first.
+		 */
+		public bool coalesce { get; set; default = false; }
+		
+		/** Text queued by {@link add} for the next frame (see {@link coalesce}). */
+		private GLib.StringBuilder pending = new GLib.StringBuilder();
+		/** Tick callback id on tick_widget; 0 when nothing is queued. */
+		private uint tick_id = 0;
+		private Gtk.Widget? tick_widget = null;
 		
+		/** Buffer range one top-level node was drawn into by {@link render_document}. */
+		private class DrawnBlock
+		{
+			public int uid;
+			public int revision;
+			/** null when the node made widget rows (code, table, rule); it is then redrawn whole. */
+			public Gtk.TextMark? start = null;
+			public Gtk.TextMark? end = null;
+
+			public void delete_marks()
+			{
+				if (this.start != null && this.start.get_buffer() != null) {
+					this.start.get_buffer().delete_mark(this.start);
+				}
+				if (this.end != null && this.end.get_buffer() != null) {
+					this.end.get_buffer().delete_mark(this.end);
+				}
+				this.start = null;
+				this.end = null;
+			}
+		}
+		/** Blocks of each document drawn since the last {@link clear}, for {@link update_document}. */
+		private Gee.HashMap<Markdown.Document.Document, Gee.ArrayList<DrawnBlock>> drawn =
+			new Gee.HashMap<Markdown.Document.Document, Gee.ArrayList<DrawnBlock>>();
+
 		// Default state to restore when new textviews are created (e.g., after code blocks)
 		public State? default_state { get; set; default = null; }
 		
@@ -94,6 +132,11 @@ namespace MarkdownGtk
 		public signal void code_block_content_updated();
 		/** Emitted when user clicks "Start new chat with this" on a user-sent frame. Connect to start a new chat with the given text. */
 		public signal void start_new_chat_requested(string text);
+		/**
+		 * Emitted after queued text was rendered (see {@link coalesce}).
+		 * bytes is the amount of markdown parsed, elapsed_us the time it took.
+		 */
+		public signal void frame_rendered(size_t bytes, int64 elapsed_us);
 
 		/**
 		 * Creates a renderer that appends content to the given box.
@@ -216,19 +259,8 @@ namespace MarkdownGtk
 		 */
 		private void create_textview()
 		{
-			// Create new TextView (tight margins so no extra padding below text)
-			this.current_textview = new Gtk.TextView() {
-				editable = false,
-				cursor_visible = false,
-				wrap_mode = Gtk.WrapMode.WORD,
-				hexpand = true,
-				vexpand = false,
-				top_margin = 0,
-				bottom_margin = 0,
-				margin_top = 0,
-				margin_bottom = 0
-			};
-			this.current_textview.add_css_class("oc-markdown-text");
+			// Create new TextView (RenderBox can free and rebuild it when parked)
+			this.current_textview = RenderBox.new_text_view();
 
 			// Get the buffer from the TextView
 			this.current_buffer = this.current_textview.buffer;
@@ -285,7 +317,7 @@ namespace MarkdownGtk
 		 * 
 		 * If a TextView already exists, ends the current block first.
 		 */
-		public void start()
+		public override void start()
 		{
 			// End the current block first (safe to call even if already null)
 			this.end_block();
@@ -310,6 +342,7 @@ namespace MarkdownGtk
 		 */
 		public void end_block()
 		{
+			this.render_pending();
 			if (this.top_state != null) {
 				this.top_state.delete_marks_recursive();
 			}
@@ -330,12 +363,22 @@ namespace MarkdownGtk
 		 */
 		public void clear()
 		{
+			// Queued stream text belongs to the content being torn down
+			this.cancel_tick();
+			this.pending.truncate(0);
 			this.on_table_pending(false);
 			// Clear current sourceview handler
 			this.childview = null;
 			
 			// Clear all sourceview handlers
 			this.source_view_handlers.clear();
+
+			foreach (var blocks in this.drawn.values) {
+				foreach (var d in blocks) {
+					d.delete_marks();
+				}
+			}
+			this.drawn.clear();
 			
 			// Clear current block state
 			this.end_block();
@@ -355,10 +398,224 @@ namespace MarkdownGtk
 				GLib.error("Render.add() called before start() - TextView not initialized. Call start() before adding text.");
 			}
 			
+			if (this.coalesce && this.is_streaming && this.box.get_mapped()) {
+				this.pending.append(text);
+				if (this.tick_id == 0) {
+					this.tick_widget = this.box;
+					this.tick_id = this.box.add_tick_callback(this.on_tick);
+				}
+				return;
+			}
+			this.render_pending();
+			
 			// Call parent add() to process the text
 			base.add(text);
 		}
 		
+		/**
+		 * Renders queued text, then finalizes the current chunk (see {@link Markdown.RenderBase.flush}).
+		 */
+		public override void flush()
+		{
+			this.render_pending();
+			base.flush();
+		}
+		
+		/**
+		 * Runs the parser over text queued by {@link add} now, instead of
+		 * waiting for the next frame. No-op when nothing is queued.
+		 */
+		public void render_pending()
+		{
+			this.cancel_tick();
+			if (this.pending.len == 0) {
+				return;
+			}
+			var text = this.pending.str;
+			this.pending.truncate(0);
+			var started = GLib.get_monotonic_time();
+			base.add(text);
+			this.frame_rendered(text.length, GLib.get_monotonic_time() - started);
+		}
+		
+		/**
+		 * Draws an already parsed document into the current block without
+		 * running the parser (see {@link Markdown.Document.Node.emit}).
+		 *
+		 * Use between {@link start} and {@link end_block} like {@link add};
+		 * lets callers that keep the {@link Markdown.Document.Document} for a
+		 * message redraw it (history reload, restyle) without re-parsing.
+		 * Where each top-level block went is remembered until {@link clear}
+		 * (for the latest drawing of a document drawn more than once), so
+		 * {@link update_document} can later redraw only changed blocks.
+		 *
+		 * @param doc parsed content, e.g. from {@link Markdown.Document.Render}
+		 */
+		public void render_document(Markdown.Document.Document doc)
+		{
+			this.render_pending();
+			var old = this.drawn.get(doc);
+			if (old != null) {
+				foreach (var d in old) {
+					d.delete_marks();
+				}
+			}
+			var blocks = new Gee.ArrayList<DrawnBlock>();
+			for (var i = 0; i < doc.children.size; i++) {
+				var node = doc.children.get(i);
+				var d = new DrawnBlock() {
+					uid = node.uid,
+					revision = node.revision
+				};
+				var buf = this.current_buffer;
+				Gtk.TextIter iter;
+				if (buf != null && this.current_table == null) {
+					this.current_state.get_insert_iter(out iter);
+					d.start = buf.create_mark(null, iter, true);
+				}
+				doc.emit_child(this, i);
+				if (d.start != null && this.current_buffer == buf) {
+					this.current_state.get_insert_iter(out iter);
+					d.end = buf.create_mark(null, iter, true);
+				} else {
+					d.delete_marks();
+				}
+				blocks.add(d);
+			}
+			this.drawn.set(doc, blocks);
+		}
+
+		/**
+		 * Redraws the blocks of a document drawn by {@link render_document}
+		 * that changed since (see {@link Markdown.Document.Node.revision}),
+		 * in place in their buffers; unchanged blocks are not touched.
+		 *
+		 * Only text blocks can be redrawn in place: when a changed block
+		 * makes or made widget rows (code, table, rule), blocks were added
+		 * or removed, or a block is still open, nothing is changed and the
+		 * caller has to draw the document again.
+		 *
+		 * @param doc a document passed to render_document since the last {@link clear}
+		 * @return false when the document has to be drawn again whole
+		 */
+		public bool update_document(Markdown.Document.Document doc)
+		{
+			var blocks = this.drawn.get(doc);
+			if (blocks == null || blocks.size != doc.children.size || this.current_buffer != null) {
+				return false;
+			}
+			var dirty = new Gee.ArrayList<int>();
+			for (var i = blocks.size - 1; i >= 0; i--) {
+				var node = doc.children.get(i);
+				var d = blocks.get(i);
+				if (d.uid != node.uid) {
+					return false;
+				}
+				var changed = d.revision != node.revision;
+				// the break after a blockquote depends on the block after it
+				if (!changed && dirty.size > 0 && dirty.get(dirty.size - 1) == i + 1
+					&& node is Markdown.Document.Block
+					&& ((Markdown.Document.Block) node).kind == Markdown.FormatType.BLOCKQUOTE) {
+					changed = true;
+				}
+				if (!changed) {
+					continue;
+				}
+				if (d.start == null || !this.text_only(node)) {
+					return false;
+				}
+				dirty.add(i);
+			}
+			foreach (var i in dirty) {
+				this.redraw_block(doc, i, blocks);
+			}
+			return true;
+		}
+
+		/** True when node draws into the text buffer only (no widget rows). */
+		private bool text_only(Markdown.Document.Node node)
+		{
+			if (node is Markdown.Document.Block) {
+				var kind = ((Markdown.Document.Block) node).kind;
+				if (kind == Markdown.FormatType.TABLE
+					|| kind == Markdown.FormatType.HORIZONTAL_RULE
+					|| kind.is_fence_kind()) {
+					return false;
+				}
+			}
+			foreach (var child in node.children) {
+				if (!this.text_only(child)) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/** Replace the text of block i with a fresh emit of it (see {@link update_document}). */
+		private void redraw_block(Markdown.Document.Document doc, int i, Gee.ArrayList<DrawnBlock> blocks)
+		{
+			var d = blocks.get(i);
+			var buf = d.start.get_buffer();
+			Gtk.TextIter s, e;
+			buf.get_iter_at_mark(out s, d.start);
+			buf.get_iter_at_mark(out e, d.end);
+			buf.delete(ref s, ref e);
+
+			// draw through a TopState placed at the block, with list state of its own
+			var indent_levels = this.indent_levels;
+			var list_stack = this.list_stack;
+			var list_indentation = this.current_list_indentation;
+			this.indent_levels = new Gee.ArrayList<int>();
+			this.list_stack = new Gee.ArrayList<int>();
+			this.current_list_indentation = 0;
+			this.current_buffer = buf;
+			this.top_state = new TopState(this);
+			this.current_state = this.top_state;
+			this.top_state.initialize_at(d.start);
+			if (this.default_state != null) {
+				this.default_state.copy_style_to(this.top_state.add_state());
+			}
+
+			doc.emit_child(this, i);
+
+			Gtk.TextIter iter;
+			this.current_state.get_insert_iter(out iter);
+			buf.move_mark(d.end, iter);
+			// the next block starts where this one now ends
+			if (i + 1 < blocks.size && blocks.get(i + 1).start != null
+				&& blocks.get(i + 1).start.get_buffer() == buf) {
+				buf.move_mark(blocks.get(i + 1).start, iter);
+			}
+			d.revision = doc.children.get(i).revision;
+
+			this.top_state.delete_marks_recursive();
+			this.top_state = null;
+			this.current_state = null;
+			this.current_buffer = null;
+			this.indent_levels = indent_levels;
+			this.list_stack = list_stack;
+			this.current_list_indentation = list_indentation;
+		}
+
+		private bool on_tick(Gtk.Widget widget, Gdk.FrameClock clock)
+		{
+			// Returning false removes the callback; forget the id first so render_pending does not
+			this.tick_id = 0;
+			this.tick_widget = null;
+			this.render_pending();
+			return false;
+		}
+		
+		private void cancel_tick()
+		{
+			if (this.tick_id == 0) {
+				return;
+			}
+			this.tick_widget.remove_tick_callback(this.tick_id);
+			this.tick_id = 0;
+			this.tick_widget = null;
+		}
+		
 		// Callback methods for parser
 		
 		/**
@@ -854,6 +1111,8 @@ namespace MarkdownGtk
 		// Code block callbacks
 		public override void on_code_block(bool is_start, string lang)
 		{
+			// Called directly by ChatView as well as by the parser; keep order with queued text
+			this.render_pending();
 			if (!is_start) {
 				// Code block ended - delegate to childview
 				if (this.childview != null) {
@@ -24,6 +24,9 @@ namespace MarkdownGtk
 	 * Link gestures run here; forward pointer/motion/leave via signals so each
 	 * new box instance works without holding a reference to {@link Render}.
 	 *
+	 * Rows far outside the viewport can be parked (see {@link park}) so long
+	 * transcripts only lay out what is near the visible area.
+	 *
 	 * @see Render
 	 */
 	public class RenderBox : Gtk.Box
@@ -32,9 +35,35 @@ namespace MarkdownGtk
 		public signal void on_link_motion(double x, double y);
 		public signal void on_link_leave();
 
-		/** Append order for scroll / id queries; updated only from {@link appender}. */
+		/**
+		 * Append order for scroll / id queries; updated only from
+		 * {@link appender}, and by {@link park} / {@link unpark} for freed
+		 * text rows (the slot then holds the placeholder).
+		 */
 		public Gee.ArrayList<Gtk.Widget> by_id { get; private set; default = new Gee.ArrayList<Gtk.Widget>(); }
 
+		/**
+		 * Parked rows keyed by id. See {@link park}.
+		 */
+		private Gee.HashMap<int, Parked> parked = new Gee.HashMap<int, Parked>();
+
+		/** Number of rows currently parked. */
+		public int n_parked {
+			get {
+				return this.parked.size;
+			}
+		}
+
+		/** A parked row: its placeholder and what is needed to show it again. */
+		private class Parked : Object
+		{
+			public Gtk.Widget holder;
+			/** Row that is not a plain text row, kept hidden behind holder. */
+			public Gtk.Widget? hidden = null;
+			/** Buffer of a text row whose view was freed. */
+			public Gtk.TextBuffer? buffer = null;
+		}
+
 		/** Start index of the current span; set by {@link mark}. */
 		public int first_id { get; private set; default = 0; }
 
@@ -82,5 +111,121 @@ namespace MarkdownGtk
 		{
 			this.first_id = this.by_id.size;
 		}
+
+		/**
+		 * New text row, as {@link Render} appends them. Also rebuilds a
+		 * freed row on its old buffer (see {@link unpark}).
+		 *
+		 * @param buffer buffer to show, or null for a new one
+		 */
+		public static Gtk.TextView new_text_view(Gtk.TextBuffer? buffer = null)
+		{
+			// tight margins so no extra padding below text
+			var view = buffer == null ? new Gtk.TextView() : new Gtk.TextView.with_buffer(buffer);
+			view.editable = false;
+			view.cursor_visible = false;
+			view.wrap_mode = Gtk.WrapMode.WORD;
+			view.hexpand = true;
+			view.vexpand = false;
+			view.top_margin = 0;
+			view.bottom_margin = 0;
+			view.margin_top = 0;
+			view.margin_bottom = 0;
+			view.add_css_class("oc-markdown-text");
+			return view;
+		}
+
+		/**
+		 * Replace an off-screen row with an empty box of the same height.
+		 *
+		 * Text rows made by {@link new_text_view} are freed; only their
+		 * buffer is kept, and the view is built again by {@link unpark}.
+		 * Other rows (code frames, tables, separators) are hidden, so they
+		 * no longer take part in measure / allocate / snapshot. Either way
+		 * relayout cost does not grow with the number of rows scrolled out
+		 * of view. Rows that are hidden, not yet allocated, or already
+		 * parked are left alone.
+		 *
+		 * The placeholder keeps the height measured now; call
+		 * {@link unpark_all} when the width changes.
+		 *
+		 * @param id row index in {@link by_id}
+		 * @return true if the row was parked
+		 */
+		public bool park(int id)
+		{
+			if (id < 0 || id >= this.by_id.size || this.parked.has_key(id)) {
+				return false;
+			}
+			var child = this.by_id.get(id);
+			var height = child.get_height();
+			if (!child.visible || height <= 0 || child.parent != this) {
+				return false;
+			}
+			var entry = new Parked() {
+				holder = new Gtk.Box(Gtk.Orientation.VERTICAL, 0) {
+					height_request = height,
+					margin_top = child.margin_top,
+					margin_bottom = child.margin_bottom
+				}
+			};
+			this.insert_child_after(entry.holder, child);
+			if (child.get_type() == typeof(Gtk.TextView) && child.has_css_class("oc-markdown-text")) {
+				entry.buffer = ((Gtk.TextView) child).buffer;
+				this.by_id.set(id, entry.holder);
+				this.remove(child);
+			} else {
+				entry.hidden = child;
+				child.visible = false;
+			}
+			this.parked.set(id, entry);
+			return true;
+		}
+
+		/**
+		 * Show a parked row again and drop its placeholder. No-op when not parked.
+		 *
+		 * @param id row index in {@link by_id}
+		 */
+		public void unpark(int id)
+		{
+			Parked entry;
+			if (!this.parked.unset(id, out entry)) {
+				return;
+			}
+			if (entry.buffer != null) {
+				var view = new_text_view(entry.buffer);
+				this.insert_child_after(view, entry.holder);
+				this.by_id.set(id, view);
+			} else {
+				entry.hidden.visible = true;
+			}
+			this.remove(entry.holder);
+		}
+
+		/**
+		 * Show every parked row again, e.g. when the width changed and the
+		 * placeholder heights no longer match.
+		 */
+		public void unpark_all()
+		{
+			foreach (var id in this.parked.keys.to_array()) {
+				this.unpark(id);
+			}
+		}
+
+		/**
+		 * Widget currently occupying the row's slot: the placeholder when
+		 * parked, otherwise the row itself. Use for position queries.
+		 *
+		 * @param id row index in {@link by_id}
+		 */
+		public Gtk.Widget row(int id)
+		{
+			if (this.parked.has_key(id)) {
+				return this.parked.get(id).holder;
+			}
+			return this.by_id.get(id);
+		}
 	}
 }
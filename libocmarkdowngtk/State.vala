@@ -109,6 +109,16 @@ namespace MarkdownGtk
 			}
 		}
 		
+		/**
+		 * Where the next text of this state is inserted.
+		 *
+		 * @param iter set to the position of this state's end mark
+		 */
+		internal void get_insert_iter(out Gtk.TextIter iter)
+		{
+			this.end.get_buffer().get_iter_at_mark(out iter, this.end);
+		}
+
 		/**
 		 * Adds text directly to the text buffer at the current insertion point.
 		 * Inserts plain text and applies the TextTag to the inserted range.
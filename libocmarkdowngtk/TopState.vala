@@ -54,6 +54,18 @@ namespace MarkdownGtk
 			this.render.current_buffer.move_mark(this.end, iter);
 		}
 
+		/**
+		 * Initializes TopState's tag and marks at a position inside the
+		 * current buffer, so text is inserted there instead of at the end
+		 * (see {@link Render.update_document}).
+		 *
+		 * @param at mark in render.current_buffer to insert at
+		 */
+		internal void initialize_at(Gtk.TextMark at)
+		{
+			this.init_tags_and_marks(this.render.current_buffer, at);
+		}
+
 		/** Initialize for a specific buffer (e.g. table cell) without changing render.current_buffer. */
 		internal void initialize_for_buffer(Gtk.TextBuffer buffer)
 		{
@@ -23,13 +23,390 @@ namespace OLLMmcp.Client
 	 * Subclasses implement transport (stdio subprocess or HTTP). connect() establishes
 	 * the channel and optionally runs the MCP initialize handshake; tools() and
 	 * call() send JSON-RPC and return results.
+	 *
+	 * == JSON-RPC session ==
+	 *
+	 * Requests go through {@link rpc}: each gets a fresh id and waits in
+	 * {@link pending} until a message with that id is passed to
+	 * {@link dispatch}, so many calls can be in flight on one connection and
+	 * replies may arrive in any order. Transports only move text:
+	 * {@link transmit} sends one message and feeds whatever comes back
+	 * (stdio read loop, HTTP body, SSE events) to {@link dispatch}.
+	 * {@link max_in_flight} caps concurrent requests per server.
+	 *
+	 * == Lazy connect ==
+	 *
+	 * {@link tools} and {@link call} go through {@link ensure_connected}, so
+	 * a server whose tools were registered from {@link ToolCache} is only
+	 * started when one of them is first used. Concurrent first calls share
+	 * one connect; {@link connected} fires once it succeeds.
 	 */
 	public abstract class Base : Object
 	{
+		/**
+		 * Most requests this client sends at once; further calls queue
+		 * until one finishes. Set from {@link Config.max_concurrent}.
+		 */
+		public int max_in_flight { get; set; default = 4; }
+
+		/**
+		 * Seconds {@link rpc} waits for a reply before failing with
+		 * TIMED_OUT; 0 waits forever. Set from {@link Config.timeout}.
+		 */
+		public uint timeout_seconds { get; set; default = 120; }
+
+		/** Next JSON-RPC request id. */
+		protected int next_id = 1;
+
+		/** Requests waiting for their response, keyed by id. */
+		protected Gee.HashMap<int, Pending> pending = new Gee.HashMap<int, Pending>();
+
+		/** True between a successful {@link connect} and {@link disconnect} (or the server going away). */
+		public bool is_connected { get; protected set; default = false; }
+
+		/** Emitted after {@link ensure_connected} brings the server up. */
+		public signal void connected();
+
+		private bool connecting = false;
+		private Gee.ArrayList<Pending> connect_waiters = new Gee.ArrayList<Pending>();
+
+		private int in_flight = 0;
+		private Gee.ArrayQueue<Pending> slot_waiters = new Gee.ArrayQueue<Pending>();
+
+		/** One outstanding request (or queued caller waiting for a slot). */
+		protected class Pending
+		{
+			public GLib.SourceFunc? resume = null;
+			/** True once the caller has yielded; only then may it be resumed. */
+			public bool waiting = false;
+			public bool done = false;
+			public Json.Node? response = null;
+			public GLib.Error? error = null;
+		}
+
 		public abstract async void connect() throws Error;
 		/** Close the MCP connection (subprocess/HTTP). Named to avoid hiding GLib.Object.disconnect. */
 		public abstract new void disconnect();
-		public abstract async Gee.ArrayList<OLLMmcp.Factory> tools() throws Error;
-		public abstract async string call(string name, Json.Object arguments) throws Error;
+
+		/**
+		 * Send one serialized JSON-RPC message. Responses may be delivered to
+		 * {@link dispatch} before or after this returns.
+		 */
+		protected abstract async void transmit(string body) throws Error;
+
+		/**
+		 * Connect if not already connected; callers arriving while a connect
+		 * is running wait for it and get its result.
+		 */
+		public async void ensure_connected() throws Error
+		{
+			if (this.is_connected) {
+				return;
+			}
+			if (this.connecting) {
+				var w = new Pending();
+				w.resume = this.ensure_connected.callback;
+				this.connect_waiters.add(w);
+				yield;
+				if (w.error != null) {
+					throw w.error.copy();
+				}
+				return;
+			}
+			this.connecting = true;
+			GLib.Error? failed = null;
+			try {
+				yield this.connect();
+				this.is_connected = true;
+			} catch (GLib.Error e) {
+				failed = e;
+				this.disconnect();
+			}
+			this.connecting = false;
+			foreach (var w in this.connect_waiters) {
+				w.error = failed;
+				GLib.Idle.add((owned) w.resume);
+			}
+			this.connect_waiters.clear();
+			if (failed != null) {
+				throw failed;
+			}
+			this.connected();
+		}
+
+		public virtual async Gee.ArrayList<OLLMmcp.Factory> tools() throws Error
+		{
+			yield this.ensure_connected();
+			var response = yield this.rpc(new OLLMmcp.JsonRpcRequest() {
+				method = "tools/list"
+			});
+			var factories = new Gee.ArrayList<OLLMmcp.Factory>();
+			var result_node = this.result_of(response);
+			if (result_node == null) {
+				return factories;
+			}
+			var list_result = Json.gobject_deserialize(typeof(OLLMmcp.ToolsListResult), result_node) as OLLMmcp.ToolsListResult;
+			if (list_result == null) {
+				return factories;
+			}
+			foreach (var f in list_result.tools) {
+				factories.add(f);
+			}
+			return factories;
+		}
+
+		public virtual async string call(string name, Json.Object arguments) throws Error
+		{
+			yield this.ensure_connected();
+			var response = yield this.rpc(new OLLMmcp.JsonRpcRequest() {
+				method = "tools/call",
+				params_tools_call = new OLLMmcp.CallToolParams() {
+					name = name,
+					arguments = arguments
+				}
+			});
+			var result_node = this.result_of(response);
+			if (result_node == null) {
+				return "";
+			}
+			var call_result = Json.gobject_deserialize(typeof(OLLMmcp.CallToolResult), result_node) as OLLMmcp.CallToolResult;
+			if (call_result == null) {
+				return "";
+			}
+			return call_result.text_content();
+		}
+
+		/**
+		 * MCP initialize handshake: initialize request, then the
+		 * initialized notification.
+		 */
+		protected async void init() throws Error
+		{
+			yield this.rpc(new OLLMmcp.JsonRpcRequest() {
+				method = "initialize",
+				params_initialize = new OLLMmcp.InitializeParams()
+			});
+			var notif = new OLLMmcp.InitializedNotification();
+			yield this.transmit(Json.to_string(Json.gobject_serialize(notif), false));
+		}
+
+		/**
+		 * Send a request and wait for the response with the same id.
+		 *
+		 * Assigns req.id. Waits for a free slot when {@link max_in_flight}
+		 * requests are already outstanding. A reply that has not arrived
+		 * after {@link timeout_seconds} fails the call; a late reply is
+		 * dropped as an unknown id.
+		 *
+		 * @return the full response envelope
+		 * @throws Error on transport failure, timeout or a JSON-RPC error member
+		 */
+		protected async Json.Node rpc(OLLMmcp.JsonRpcRequest req) throws Error
+		{
+			yield this.acquire_slot();
+			req.id = this.next_id++;
+			var p = new Pending();
+			this.pending.set(req.id, p);
+			try {
+				yield this.transmit(Json.to_string(Json.gobject_serialize(req), false));
+			} catch (GLib.Error e) {
+				this.pending.unset(req.id);
+				this.release_slot();
+				throw e;
+			}
+			if (!p.done) {
+				p.resume = this.rpc.callback;
+				p.waiting = true;
+				uint timer = 0;
+				if (this.timeout_seconds > 0) {
+					timer = GLib.Timeout.add_seconds(this.timeout_seconds, () => {
+						timer = 0;
+						this.fail_request(req.id, new GLib.IOError.TIMED_OUT(
+							"MCP %s: no reply after %u seconds".printf(req.method, this.timeout_seconds)));
+						return false;
+					});
+				}
+				yield;
+				if (timer != 0) {
+					GLib.Source.remove(timer);
+				}
+			}
+			this.pending.unset(req.id);
+			this.release_slot();
+			if (p.error != null) {
+				throw p.error.copy();
+			}
+			this.check_jerr(p.response);
+			return p.response;
+		}
+
+		/**
+		 * Route one incoming JSON-RPC text (object or batch array).
+		 *
+		 * Responses complete the matching {@link pending} entry; requests from
+		 * the server get an answer via {@link transmit}; notifications and
+		 * unknown ids are logged and dropped.
+		 */
+		protected void dispatch(string text)
+		{
+			var data = text.strip();
+			if (data == "") {
+				return;
+			}
+			var parser = new Json.Parser();
+			try {
+				parser.load_from_data(data, -1);
+			} catch (GLib.Error e) {
+				GLib.debug("MCP: ignoring invalid JSON-RPC message: %s", e.message);
+				return;
+			}
+			var root = parser.get_root();
+			if (root == null) {
+				return;
+			}
+			if (root.get_node_type() == Json.NodeType.ARRAY) {
+				var arr = root.get_array();
+				for (uint i = 0; i < arr.get_length(); i++) {
+					this.dispatch_node(arr.get_element(i));
+				}
+				return;
+			}
+			this.dispatch_node(root);
+		}
+
+		private void dispatch_node(Json.Node node)
+		{
+			var obj = node.get_node_type() == Json.NodeType.OBJECT ? node.get_object() : null;
+			if (obj == null) {
+				return;
+			}
+			if (obj.has_member("method")) {
+				if (obj.has_member("id")) {
+					this.answer_server_request.begin(obj);
+					return;
+				}
+				GLib.debug("MCP: notification %s", obj.get_string_member("method"));
+				return;
+			}
+			if (!obj.has_member("id") || obj.get_member("id").get_value_type() != typeof(int64)) {
+				GLib.debug("MCP: response without numeric id");
+				return;
+			}
+			var id = (int) obj.get_int_member("id");
+			var p = this.pending.get(id);
+			if (p == null || p.done) {
+				GLib.debug("MCP: response for unknown id %d", id);
+				return;
+			}
+			p.response = node;
+			this.complete(p);
+		}
+
+		/**
+		 * Server-to-client requests: answer ping, reject everything else
+		 * (we advertise no client capabilities).
+		 */
+		private async void answer_server_request(Json.Object req)
+		{
+			var reply = new Json.Builder();
+			reply.begin_object();
+			reply.set_member_name("jsonrpc").add_string_value("2.0");
+			reply.set_member_name("id").add_value(req.get_member("id").copy());
+			if (req.get_string_member("method") == "ping") {
+				reply.set_member_name("result").begin_object().end_object();
+			} else {
+				reply.set_member_name("error").begin_object();
+				reply.set_member_name("code").add_int_value(-32601);
+				reply.set_member_name("message").add_string_value("Method not found");
+				reply.end_object();
+			}
+			reply.end_object();
+			try {
+				yield this.transmit(Json.to_string(reply.get_root(), false));
+			} catch (GLib.Error e) {
+				GLib.debug("MCP: reply to server request failed: %s", e.message);
+			}
+		}
+
+		/**
+		 * Fail the request with id if it is still waiting for its reply.
+		 */
+		protected void fail_request(int id, GLib.Error error)
+		{
+			var p = this.pending.get(id);
+			if (p == null || p.done) {
+				return;
+			}
+			p.error = error.copy();
+			this.complete(p);
+		}
+
+		/**
+		 * Fail every outstanding request (connection lost or closed).
+		 */
+		protected void fail_pending(GLib.Error error)
+		{
+			foreach (var p in this.pending.values) {
+				if (p.done) {
+					continue;
+				}
+				p.error = error.copy();
+				this.complete(p);
+			}
+		}
+
+		private void complete(Pending p)
+		{
+			p.done = true;
+			if (!p.waiting) {
+				return;
+			}
+			p.waiting = false;
+			GLib.Idle.add((owned) p.resume);
+		}
+
+		private async void acquire_slot()
+		{
+			if (this.in_flight < int.max(1, this.max_in_flight)) {
+				this.in_flight++;
+				return;
+			}
+			var w = new Pending();
+			w.resume = this.acquire_slot.callback;
+			this.slot_waiters.offer(w);
+			yield;
+		}
+
+		/** Hand the slot to the next queued caller, or free it. */
+		private void release_slot()
+		{
+			var w = this.slot_waiters.poll();
+			if (w == null) {
+				this.in_flight--;
+				return;
+			}
+			GLib.Idle.add((owned) w.resume);
+		}
+
+		private Json.Node? result_of(Json.Node response)
+		{
+			var root = response.get_object();
+			if (root == null || !root.has_member("result")) {
+				return null;
+			}
+			return root.get_member("result");
+		}
+
+		private void check_jerr(Json.Node? response) throws Error
+		{
+			Json.Object? obj = response != null ? response.get_object() : null;
+			if (obj == null || !obj.has_member("error")) {
+				return;
+			}
+			var err_node = obj.get_member("error");
+			var err = Json.gobject_deserialize(typeof(OLLMmcp.McpJsonRpcError), err_node) as OLLMmcp.McpJsonRpcError;
+			string msg = err != null && err.message != "" ? err.message : "JSON-RPC error";
+			throw new GLib.IOError.FAILED("MCP error: " + msg);
+		}
 	}
 }
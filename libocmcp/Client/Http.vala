@@ -21,14 +21,14 @@
  *   OLLMmcp.Client
  *   └── Http : Client.Base
  *       ├── config          OLLMmcp.Config
- *       ├── session        Soup.Session?
+ *       ├── session        Soup.Session? (keep-alive, max_conns_per_host = max_in_flight)
  *       ├── base_url       string (from config.url)
- *       ├── next_id        uint (JSON-RPC request id)
- *       ├── connect()      → initialize + initialized; uses InitializeParams
- *       ├── disconnect()   → clears session
- *       ├── tools()   → jrequest("tools/list") → ToolsListResult.tools (Gee.ArrayList<Factory>)
- *       ├── call()    → jrequest("tools/call") → CallToolResult.text_content()
- *       └── jrequest(method, params_json?)  → JSON-RPC envelope (Json.Object) + Json.to_string, POST, parse; on error uses McpJsonRpcError
+ *       ├── session_id     string (Mcp-Session-Id from initialize, echoed on later POSTs)
+ *       ├── connect()      → Base.init() (initialize + initialized)
+ *       ├── disconnect()   → clears session, fails pending calls
+ *       ├── transmit(body) → POST; JSON body → Base.dispatch(), or starts read_events()
+ *       └── read_events(stream, id) → SSE "data:" lines joined per event → Base.dispatch();
+ *                                      runs in the background, fails id if the stream ends first
  */
 
 namespace OLLMmcp.Client
@@ -36,13 +36,18 @@ namespace OLLMmcp.Client
 	/**
 	 * MCP client over HTTP: connects to an already-running MCP server at a URL.
 	 * JSON-RPC via HTTP POST; no process lifecycle.
+	 *
+	 * Each request is its own POST, so up to {@link Base.max_in_flight} calls
+	 * run at once over pooled keep-alive connections. Replies may come back
+	 * as a plain JSON body or as a streamable-HTTP ''text/event-stream'';
+	 * both are routed by id through {@link Base.dispatch}.
 	 */
 	public class Http : Base
 	{
 		private OLLMmcp.Config config;
 		private Soup.Session? session;
 		private string base_url;
-		private uint next_id = 1;
+		private string session_id = "";
 
 		public Http(
 			OLLMmcp.Config config,
@@ -55,134 +60,147 @@ namespace OLLMmcp.Client
 
 		public override async void connect() throws Error
 		{
-			this.session = new Soup.Session();
-
-			yield this.jrequest(new OLLMmcp.JsonRpcRequest() {
-				id = (int) this.next_id++,
-				method = "initialize",
-				params_initialize = new OLLMmcp.InitializeParams()
-			});
-
-			var notif = new OLLMmcp.InitializedNotification();
-			string body = Json.to_string(Json.gobject_serialize(notif), false);
-			var msg = new Soup.Message("POST", this.base_url);
-			msg.set_request_body_from_bytes("application/json", new GLib.Bytes((uint8[]) body.to_utf8()));
-			try {
-				yield this.session.send_async(msg, GLib.Priority.DEFAULT, null);
-			} catch (GLib.Error e) {
-				throw new GLib.IOError.FAILED("MCP HTTP initialized: " + e.message);
-			}
+			this.max_in_flight = this.config.max_concurrent;
+			this.timeout_seconds = (uint) int.max(0, this.config.timeout);
+			this.session_id = "";
+			this.session = new Soup.Session() {
+				max_conns_per_host = int.max(2, this.max_in_flight),
+				max_conns = int.max(10, this.max_in_flight * 2),
+				idle_timeout = 60,
+				timeout = this.timeout_seconds
+			};
+			yield this.init();
 		}
 
 		public override void disconnect()
 		{
 			this.session = null;
+			this.session_id = "";
+			this.is_connected = false;
+			this.fail_pending(new GLib.IOError.CLOSED("MCP server '" + this.config.id + "' disconnected"));
 		}
 
-		public override async Gee.ArrayList<OLLMmcp.Factory> tools() throws Error
-		{
-			var response = yield this.jrequest(new OLLMmcp.JsonRpcRequest() {
-				id = (int) this.next_id++,
-				method = "tools/list"
-			});
-			Json.Node? result_node = null;
-			if (response != null) {
-				var root = response.get_object();
-				if (root != null && root.has_member("result")) {
-					result_node = root.get_member("result");
-				}
-			}
-			if (result_node == null) {
-				return new Gee.ArrayList<OLLMmcp.Factory>();
-			}
-			var list_result = Json.gobject_deserialize(typeof(OLLMmcp.ToolsListResult), result_node) as OLLMmcp.ToolsListResult;
-			if (list_result == null) {
-				return new Gee.ArrayList<OLLMmcp.Factory>();
-			}
-			var factories = new Gee.ArrayList<OLLMmcp.Factory>();
-			foreach (var f in list_result.tools) {
-				factories.add(f);
-			}
-			return factories;
-		}
-
-		public override async string call(string name, Json.Object arguments) throws Error
-		{
-			var call_params = new OLLMmcp.CallToolParams() {
-				name = name,
-				arguments = arguments
-			};
-			var response = yield this.jrequest(new OLLMmcp.JsonRpcRequest() {
-				id = (int) this.next_id++,
-				method = "tools/call",
-				params_tools_call = call_params
-			});
-			Json.Node? result_node = null;
-			if (response != null) {
-				var root = response.get_object();
-				if (root != null && root.has_member("result")) {
-					result_node = root.get_member("result");
-				}
-			}
-			if (result_node == null) {
-				return "";
-			}
-			var call_result = Json.gobject_deserialize(typeof(OLLMmcp.CallToolResult), result_node) as OLLMmcp.CallToolResult;
-			if (call_result == null) {
-				return "";
-			}
-			return call_result.text_content();
-		}
-
-		private async Json.Node? jrequest(OLLMmcp.JsonRpcRequest req) throws Error
+		/**
+		 * POST one message and dispatch whatever the server answers with.
+		 * 202 Accepted (notifications) and empty bodies carry no messages.
+		 * An event stream is read in the background, so the caller waits
+		 * for its reply in {@link Base.rpc} rather than for the stream to
+		 * close.
+		 */
+		protected override async void transmit(string body) throws Error
 		{
 			if (this.session == null) {
 				throw new GLib.IOError.FAILED("MCP HTTP client not connected");
 			}
-
-			string body = Json.to_string(Json.gobject_serialize(req), false);
 			var message = new Soup.Message("POST", this.base_url);
-			message.set_request_body_from_bytes("application/json", new GLib.Bytes((uint8[]) body.to_utf8()));
+			message.request_headers.replace("Accept", "application/json, text/event-stream");
+			if (this.session_id != "") {
+				message.request_headers.replace("Mcp-Session-Id", this.session_id);
+			}
+			message.set_request_body_from_bytes("application/json", new GLib.Bytes(body.data));
 
-			GLib.Bytes? bytes;
+			InputStream stream;
 			try {
-				bytes = yield this.session.send_and_read_async(message, GLib.Priority.DEFAULT, null);
+				stream = yield this.session.send_async(message, GLib.Priority.DEFAULT, null);
 			} catch (GLib.Error e) {
 				throw new GLib.IOError.FAILED("MCP HTTP request failed: " + e.message);
 			}
 
-			if (bytes == null || bytes.get_size() == 0) {
-				throw new GLib.IOError.FAILED("Empty MCP HTTP response");
+			var sid = message.response_headers.get_one("Mcp-Session-Id");
+			if (sid != null && sid != "") {
+				this.session_id = sid;
 			}
 
-			if (message.status_code != 200) {
+			if (message.status_code < 200 || message.status_code >= 300) {
+				var err_text = yield this.read_all(stream);
 				throw new GLib.IOError.FAILED(
-					"MCP HTTP " + message.status_code.to_string() + ": " + (string) bytes.get_data()
+					"MCP HTTP " + message.status_code.to_string() + ": " + err_text
 				);
 			}
+			if (message.status_code == 202) {
+				return;
+			}
 
-			string data = (string) bytes.get_data();
-			var parser = new Json.Parser();
+			var content_type = message.response_headers.get_content_type(null);
+			if (content_type == "text/event-stream") {
+				this.read_events.begin(new DataInputStream(stream), this.request_id(body));
+				return;
+			}
+			this.dispatch(yield this.read_all(stream));
+		}
+
+		/**
+		 * Server-sent events: ''data:'' lines are joined and dispatched when
+		 * the blank line ending each event arrives, so a response is
+		 * delivered as soon as its event is complete.
+		 *
+		 * @param id request the stream answers (-1 for none); failed if the
+		 *     stream ends or breaks before its reply arrived
+		 */
+		private async void read_events(DataInputStream reader, int id)
+		{
+			var data = new StringBuilder();
+			string? line = null;
+			var why = "closed before the reply";
 			try {
-				parser.load_from_data(data, -1);
+				while ((line = yield reader.read_line_async(GLib.Priority.DEFAULT, null)) != null) {
+					line = line.chomp();
+					if (line == "") {
+						if (data.len > 0) {
+							this.dispatch(data.str);
+							data.truncate(0);
+						}
+						continue;
+					}
+					if (!line.has_prefix("data:")) {
+						continue;
+					}
+					if (data.len > 0) {
+						data.append_c('\n');
+					}
+					data.append(line.substring(line.has_prefix("data: ") ? 6 : 5));
+				}
+				if (data.len > 0) {
+					this.dispatch(data.str);
+				}
 			} catch (GLib.Error e) {
-				throw new GLib.IOError.FAILED("Invalid MCP JSON response: " + e.message);
+				why = e.message;
 			}
-
-			Json.Node? root = parser.get_root();
-			if (root == null) {
-				throw new GLib.IOError.FAILED("No JSON root in MCP response");
+			if (id >= 0) {
+				this.fail_request(id, new GLib.IOError.FAILED(
+					"MCP HTTP event stream: " + why));
 			}
+		}
 
-			var root_obj = root.get_object();
-			if (root_obj != null && root_obj.has_member("error")) {
-				var err_node = root_obj.get_member("error");
-				var err = Json.gobject_deserialize(typeof(OLLMmcp.McpJsonRpcError), err_node) as OLLMmcp.McpJsonRpcError;
-				string msg = err != null && err.message != "" ? err.message : "JSON-RPC error";
-				throw new GLib.IOError.FAILED("MCP error: " + msg);
+		/** JSON-RPC id of a serialized request, or -1 (notification, reply). */
+		private int request_id(string body)
+		{
+			var parser = new Json.Parser();
+			try {
+				parser.load_from_data(body, -1);
+			} catch (GLib.Error e) {
+				return -1;
+			}
+			var root = parser.get_root();
+			if (root == null || root.get_node_type() != Json.NodeType.OBJECT) {
+				return -1;
+			}
+			var obj = root.get_object();
+			if (!obj.has_member("method") || !obj.has_member("id")
+					|| obj.get_member("id").get_value_type() != typeof(int64)) {
+				return -1;
 			}
+			return (int) obj.get_int_member("id");
+		}
 
-			return root;
+		private async string read_all(InputStream stream) throws Error
+		{
+			var mem = new MemoryOutputStream.resizable();
+			yield mem.splice_async(stream, GLib.OutputStreamSpliceFlags.CLOSE_SOURCE, GLib.Priority.DEFAULT, null);
+			size_t written;
+			mem.write_all({ 0 }, out written);
+			mem.close();
+			return (string) mem.steal_data();
 		}
 	}
 }
@@ -46,7 +46,8 @@ namespace OLLMmcp.Client
 		private GLib.Subprocess? process;
 		private DataInputStream? stdout_reader;
 		private DataOutputStream? stdin_writer;
-		private uint next_id = 1;
+		private bool writing = false;
+		private Gee.ArrayQueue<Pending> write_waiters = new Gee.ArrayQueue<Pending>();
 
 		public Stdio(OLLMmcp.Config config, OLLMfiles.ProjectManager project_manager)
 		{
@@ -84,6 +85,9 @@ namespace OLLMmcp.Client
 
 			this.stdout_reader = new DataInputStream(stdout_pipe);
 			this.stdin_writer = new DataOutputStream(stdin_pipe);
+			this.max_in_flight = this.config.max_concurrent;
+			this.timeout_seconds = (uint) int.max(0, this.config.timeout);
+			this.read_loop.begin(this.stdout_reader);
 
 			yield this.init();
 		}
@@ -102,65 +106,24 @@ namespace OLLMmcp.Client
 			}
 			this.stdout_reader = null;
 			this.stdin_writer = null;
+			this.is_connected = false;
+			this.fail_pending(new GLib.IOError.CLOSED("MCP server '" + this.config.id + "' disconnected"));
 			if (this.run_seccomp != null) {
 				this.run_seccomp.detach_sources();
 				this.run_seccomp = null;
 			}
 		}
 
-		public override async Gee.ArrayList<OLLMmcp.Factory> tools() throws Error
-		{
-			var response = yield this.jrequest(new OLLMmcp.JsonRpcRequest() {
-				id = (int) this.next_id++,
-				method = "tools/list"
-			});
-			Json.Node? result_node = null;
-			if (response != null) {
-				var root = response.get_object();
-				if (root != null && root.has_member("result")) {
-					result_node = root.get_member("result");
-				}
-			}
-			if (result_node == null) {
-				return new Gee.ArrayList<OLLMmcp.Factory>();
-			}
-			var list_result = Json.gobject_deserialize(typeof(OLLMmcp.ToolsListResult), result_node) as OLLMmcp.ToolsListResult;
-			if (list_result == null) {
-				return new Gee.ArrayList<OLLMmcp.Factory>();
-			}
-			var factories = new Gee.ArrayList<OLLMmcp.Factory>();
-			foreach (var f in list_result.tools) {
-				factories.add(f);
-			}
-			return factories;
-		}
-
+		/**
+		 * tools/call plus the sandbox evidence collected so far.
+		 *
+		 * Evidence is gathered per server process, not per call, so with
+		 * several calls in flight each result may mention activity from
+		 * its neighbours.
+		 */
 		public override async string call(string name, Json.Object arguments) throws Error
 		{
-			var call_params = new OLLMmcp.CallToolParams() {
-				name = name,
-				arguments = arguments
-			};
-			var response = yield this.jrequest(new OLLMmcp.JsonRpcRequest() {
-				id = (int) this.next_id++,
-				method = "tools/call",
-				params_tools_call = call_params
-			});
-			Json.Node? result_node = null;
-			if (response != null) {
-				var root = response.get_object();
-				if (root != null && root.has_member("result")) {
-					result_node = root.get_member("result");
-				}
-			}
-			if (result_node == null) {
-				return "";
-			}
-			var call_result = Json.gobject_deserialize(typeof(OLLMmcp.CallToolResult), result_node) as OLLMmcp.CallToolResult;
-			if (call_result == null) {
-				return "";
-			}
-			string text = call_result.text_content();
+			string text = yield base.call(name, arguments);
 			if (this.run_seccomp == null) {
 				return text;
 			}
@@ -248,65 +211,74 @@ namespace OLLMmcp.Client
 			return argv;
 		}
 
-		private async void init() throws Error
-		{
-			yield this.jrequest(new OLLMmcp.JsonRpcRequest() {
-				id = (int) this.next_id++,
-				method = "initialize",
-				params_initialize = new OLLMmcp.InitializeParams()
-			});
-
-			var notif = new OLLMmcp.InitializedNotification();
-			yield this.write(Json.to_string(Json.gobject_serialize(notif), false));
-		}
-
-		private async Json.Node? jrequest(OLLMmcp.JsonRpcRequest req) throws Error
-		{
-			yield this.write(Json.to_string(Json.gobject_serialize(req), false));
-
-			var response = yield this.read_jresponse();
-			this.check_jerr(response);
-			return response;
-		}
-
-		private async Json.Node? read_jresponse() throws Error
+		/**
+		 * Read newline-delimited JSON-RPC from the server until EOF and hand
+		 * each line to {@link dispatch}. Fails outstanding calls when the
+		 * process goes away.
+		 */
+		private async void read_loop(DataInputStream reader)
 		{
-			string? line = yield this.stdout_reader.read_line_async(GLib.Priority.DEFAULT, null);
-			if (line == null || line.strip() == "") {
-				throw new GLib.IOError.FAILED("Empty or missing JSON-RPC response");
-			}
-
-			var parser = new Json.Parser();
-			try {
-				parser.load_from_data(line.strip(), -1);
-			} catch (GLib.Error e) {
-				throw new GLib.IOError.FAILED("Invalid JSON-RPC response: " + e.message);
-			}
-
-			Json.Node? root = parser.get_root();
-			if (root == null) {
-				throw new GLib.IOError.FAILED("No JSON root in response");
+			string? line = null;
+			while (true) {
+				try {
+					line = yield reader.read_line_async(GLib.Priority.DEFAULT, null);
+				} catch (GLib.Error e) {
+					if (reader == this.stdout_reader) {
+						this.fail_pending(new GLib.IOError.FAILED("MCP read failed: " + e.message));
+						this.disconnect();
+					}
+					return;
+				}
+				if (line == null) {
+					break;
+				}
+				this.dispatch(line);
 			}
-			return root;
-		}
-
-		private void check_jerr(Json.Node? response) throws Error
-		{
-			Json.Object? obj = response != null ? response.get_object() : null;
-			if (obj == null || !obj.has_member("error")) {
+			if (reader != this.stdout_reader) {
 				return;
 			}
-			var err_node = obj.get_member("error");
-			var err = Json.gobject_deserialize(typeof(OLLMmcp.McpJsonRpcError), err_node) as OLLMmcp.McpJsonRpcError;
-			string msg = err != null && err.message != "" ? err.message : "JSON-RPC error";
-			throw new GLib.IOError.FAILED("MCP error: " + msg);
+			// Server exited: tear down so the next call respawns it via ensure_connected().
+			this.fail_pending(new GLib.IOError.CLOSED(
+				"MCP server '" + this.config.id + "' closed its output"
+			));
+			this.disconnect();
 		}
 
-		private async void write(string body) throws Error
+		/**
+		 * Write one message line. Writes are serialized: a second
+		 * write_all_async on the same stream would fail with PENDING.
+		 * The server may go away while a write is queued, so the writer is
+		 * checked again once it is this write's turn.
+		 */
+		protected override async void transmit(string body) throws Error
 		{
-			string line = body + "\n";
-			uint8[] buf = (uint8[]) line.to_utf8();
-			yield this.stdin_writer.write_async(buf, GLib.Priority.DEFAULT, null);
+			if (this.stdin_writer == null) {
+				throw new GLib.IOError.NOT_CONNECTED("MCP server '" + this.config.id + "' is not running");
+			}
+			if (this.writing) {
+				var w = new Pending();
+				w.resume = this.transmit.callback;
+				this.write_waiters.offer(w);
+				yield;
+			}
+			this.writing = true;
+			try {
+				var writer = this.stdin_writer;
+				if (writer == null) {
+					throw new GLib.IOError.NOT_CONNECTED(
+						"MCP server '" + this.config.id + "' went away");
+				}
+				string line = body + "\n";
+				size_t written;
+				yield writer.write_all_async(line.data, GLib.Priority.DEFAULT, null, out written);
+			} finally {
+				var w = this.write_waiters.poll();
+				if (w == null) {
+					this.writing = false;
+				} else {
+					GLib.Idle.add((owned) w.resume);
+				}
+			}
 		}
 	}
 }
@@ -63,6 +63,19 @@ namespace OLLMmcp
 		 */
 		public Gee.ArrayList<string> allow_writes { get; set; default = new Gee.ArrayList<string>(); }
 
+		/**
+		 * Most JSON-RPC requests sent to this server at once (mcp.json ''max_concurrent'').
+		 * Extra tool calls queue in the client until a reply frees a slot.
+		 */
+		public int max_concurrent { get; set; default = 4; }
+
+		/**
+		 * Seconds to wait for one reply (mcp.json ''timeout''); 0 waits
+		 * forever. A server that stops answering fails the call instead of
+		 * blocking it.
+		 */
+		public int timeout { get; set; default = 120; }
+
 		public Config()
 		{
 		}
@@ -19,7 +19,7 @@ namespace OLLMmcp
 {
 	/**
 	 * Tool factory for one MCP tools/list entry (name, description,
-	 * inputSchema).
+	 * inputSchema, annotations).
 	 *
 	 * Deserialized from the wire; {@link create_tool} builds a {@link Tool}
 	 * for {@link OLLMchat.History.Manager.register_tool}.
@@ -30,6 +30,19 @@ namespace OLLMmcp
 		public string description { get; set; default = ""; }
 		/** JSON Schema for parameters (MCP wire name "inputSchema"). */
 		public Json.Object inputSchema { get; set; default = new Json.Object(); }
+		/** MCP tool annotations (readOnlyHint, destructiveHint, ...); empty when the server sends none. */
+		public Json.Object annotations { get; set; default = new Json.Object(); }
+
+		/**
+		 * Server declares the tool does not modify its environment
+		 * (''annotations.readOnlyHint''); such calls may run concurrently.
+		 */
+		public bool read_only {
+			get {
+				return this.annotations.has_member("readOnlyHint")
+					&& this.annotations.get_boolean_member("readOnlyHint");
+			}
+		}
 
 		public unowned ParamSpec? find_property(string name)
 		{
@@ -55,6 +68,11 @@ namespace OLLMmcp
 				node.set_object(this.inputSchema);
 				return node;
 			}
+			if (property_name == "annotations") {
+				var node = new Json.Node(Json.NodeType.OBJECT);
+				node.set_object(this.annotations);
+				return node;
+			}
 			return default_serialize_property(property_name, value, pspec);
 		}
 
@@ -68,6 +86,14 @@ namespace OLLMmcp
 				value.set_boxed(this.inputSchema);
 				return true;
 			}
+			if (property_name == "annotations") {
+				this.annotations = (property_node.get_node_type() == Json.NodeType.OBJECT)
+					? property_node.get_object()
+					: new Json.Object();
+				value = Value(typeof(Json.Object));
+				value.set_boxed(this.annotations);
+				return true;
+			}
 			return default_deserialize_property(property_name, out value, pspec, property_node);
 		}
 
@@ -18,15 +18,24 @@
 namespace OLLMmcp
 {
 	/**
-	 * Loads MCP servers: connect, tools/list, register {@link Tool} instances.
+	 * Loads MCP servers: register {@link Tool} instances, connect on demand.
 	 *
-	 * {@link Registry} creates clients; this type only connects and registers.
+	 * {@link Registry} creates clients; this type only registers and refreshes.
+	 *
+	 * Tools come from {@link ToolCache} when the server's config has been
+	 * seen before, so {@link run} returns without starting any server. A
+	 * cached server is started by the first call to one of its tools, and
+	 * its tools/list is then re-read and the differences applied to the
+	 * manager. Servers with no cache are discovered in the background.
 	 */
 	public class Loader : Object
 	{
 		private unowned Registry registry;
 		private Gee.ArrayList<Client.Base> clients =
 			new Gee.ArrayList<Client.Base>();
+		private ToolCache cache = new ToolCache();
+		/** Bumped by {@link disconnect_all}; refreshes from an older run are dropped. */
+		private uint generation = 0;
 
 		public Loader(Registry registry)
 		{
@@ -34,19 +43,22 @@ namespace OLLMmcp
 		}
 
 		/**
-		 * For each enabled config: connect, list tools, register with manager.
+		 * For each enabled config: create a client and register its tools.
 		 *
-		 * Failures for one server are logged; other servers still load.
+		 * Cached tools are registered before this returns; uncached servers
+		 * are connected and listed in the background. Failures for one
+		 * server are logged; other servers still load.
 		 *
 		 * @param manager receives registered tools
 		 * @param configs MCP server entries from mcp.json
 		 */
-		public async void run(
+		public void run(
 			OLLMchat.History.Manager manager,
 			Gee.ArrayList<Config> configs,
 			OLLMfiles.ProjectManager project_manager
 		)
 		{
+			var gen = this.generation;
 			foreach (var config in configs) {
 				if (!config.enabled) {
 					continue;
@@ -62,33 +74,83 @@ namespace OLLMmcp
 					);
 					continue;
 				}
-				try {
-					yield client.connect();
-				} catch (GLib.Error e) {
-					GLib.warning(
-						"MCP server '%s': connect failed: %s",
-						config.id,
-						e.message
-					);
+				this.clients.add(client);
+				var cached = this.cache.load(config);
+				if (cached == null) {
+					this.refresh.begin(manager, config, client, gen);
 					continue;
 				}
-				this.clients.add(client);
-				try {
-					var factories = yield client.tools();
-					foreach (var factory in factories) {
-						manager.register_tool(
-							factory.create_tool(client, config.id)
-						);
-					}
-				} catch (GLib.Error e) {
-					GLib.warning(
-						"MCP server '%s': tools/list failed: %s",
-						config.id,
-						e.message
-					);
-					client.disconnect();
-					this.clients.remove(client);
+				this.apply(manager, config, client, cached);
+				client.connected.connect(() => {
+					this.refresh.begin(manager, config, client, gen);
+				});
+			}
+		}
+
+		/**
+		 * Re-read tools/list (connecting if needed), update the manager and
+		 * the cache.
+		 */
+		private async void refresh(
+			OLLMchat.History.Manager manager,
+			Config config,
+			Client.Base client,
+			uint gen
+		)
+		{
+			Gee.ArrayList<Factory> factories;
+			try {
+				factories = yield client.tools();
+			} catch (GLib.Error e) {
+				GLib.warning(
+					"MCP server '%s': tools/list failed: %s",
+					config.id,
+					e.message
+				);
+				return;
+			}
+			if (gen != this.generation) {
+				return;
+			}
+			this.apply(manager, config, client, factories);
+			this.cache.save(config, factories);
+		}
+
+		/**
+		 * Make the manager's mcp:ID:* tools match factories: drop tools the
+		 * server no longer lists, add new ones, replace changed ones.
+		 * Replacements keep the user's enabled state.
+		 */
+		private void apply(
+			OLLMchat.History.Manager manager,
+			Config config,
+			Client.Base client,
+			Gee.ArrayList<Factory> factories
+		)
+		{
+			var prefix = "mcp:" + config.id + ":";
+			var wanted = new Gee.HashMap<string, OLLMchat.Tool.BaseTool>();
+			foreach (var factory in factories) {
+				var tool = factory.create_tool(client, config.id);
+				wanted.set(tool.name, tool);
+			}
+			var stale = new Gee.ArrayList<string>();
+			foreach (var name in manager.tools.keys) {
+				if (name.has_prefix(prefix) && !wanted.has_key(name)) {
+					stale.add(name);
+				}
+			}
+			foreach (var name in stale) {
+				manager.unregister_tool(name);
+			}
+			foreach (var entry in wanted.entries) {
+				var old = manager.tools.get(entry.key);
+				if (old != null) {
+					entry.value.active = old.active;
+				} else if (manager.config.tools.has_key(entry.key)) {
+					entry.value.active = manager.config.tools.get(entry.key).enabled;
 				}
+				manager.register_tool(entry.value);
 			}
 		}
 
@@ -97,6 +159,7 @@ namespace OLLMmcp
 		 */
 		public void disconnect_all()
 		{
+			this.generation++;
 			foreach (var client in this.clients) {
 				client.disconnect();
 			}
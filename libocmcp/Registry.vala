@@ -22,7 +22,7 @@ namespace OLLMmcp
 	 * Registry for MCP tools.
 	 *
 	 * Loads mcp.json, creates clients per enabled {@link Config}, and registers
-	 * tools via {@link Loader}.
+	 * tools via {@link Loader} (from {@link ToolCache} when available).
 	 */
 	public class Registry : Object
 	{
@@ -66,7 +66,10 @@ namespace OLLMmcp
 		}
 
 		/**
-		 * Load MCP config, connect servers, register MCP tools on manager.
+		 * Load MCP config and register MCP tools on manager.
+		 *
+		 * Does not wait for any server: cached tools are registered at once
+		 * and servers start on first use (see {@link Loader}).
 		 */
 		public void fill_tools(
 			OLLMchat.History.Manager manager,
@@ -79,21 +82,7 @@ namespace OLLMmcp
 				return;
 			}
 			this.loader.disconnect_all();
-			var loop = new GLib.MainLoop();
-			this.loader.run.begin(
-				manager,
-				configs,
-				project_manager,
-				(obj, res) => {
-					try {
-						this.loader.run.end(res);
-					} catch (GLib.Error e) {
-						GLib.warning("MCP loader failed: %s", e.message);
-					}
-					loop.quit();
-				}
-			);
-			loop.run();
+			this.loader.run(manager, configs, project_manager);
 		}
 	}
 }
@@ -103,6 +103,16 @@ namespace OLLMmcp
 			}
 		}
 
+		/**
+		 * Read-only MCP tools overlap within a turn; the client multiplexes
+		 * the calls on one connection up to {@link Config.max_concurrent}.
+		 */
+		public override bool parallel_safe {
+			get {
+				return this.factory.read_only;
+			}
+		}
+
 		public override Type config_class()
 		{
 			return typeof(OLLMchat.Settings.BaseToolConfig);
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, see <https://www.gnu.org/licenses/>.
+ */
+
+namespace OLLMmcp
+{
+	/**
+	 * On-disk copy of each server's last tools/list result.
+	 *
+	 * One file per server under ''ollmchat/mcp'' in
+	 * {@link GLib.Environment.get_user_cache_dir}, named from the
+	 * server id and a hash of its whole {@link Config} entry, so editing a
+	 * server in mcp.json (command, args, env, url, ...) never reuses the
+	 * old schemas. {@link Loader} registers tools from here without
+	 * starting the server.
+	 */
+	public class ToolCache : Object
+	{
+		private string dir;
+
+		public ToolCache()
+		{
+			this.dir = GLib.Path.build_filename(
+				GLib.Environment.get_user_cache_dir(), "ollmchat", "mcp"
+			);
+		}
+
+		/**
+		 * Cached tool factories for config, or null when nothing usable is stored.
+		 */
+		public Gee.ArrayList<Factory>? load(Config config)
+		{
+			var path = this.path_for(config);
+			if (!GLib.FileUtils.test(path, GLib.FileTest.EXISTS)) {
+				return null;
+			}
+			try {
+				string contents;
+				GLib.FileUtils.get_contents(path, out contents);
+				var parser = new Json.Parser();
+				parser.load_from_data(contents, -1);
+				var root = parser.get_root();
+				if (root == null || root.get_node_type() != Json.NodeType.ARRAY) {
+					return null;
+				}
+				var ret = new Gee.ArrayList<Factory>();
+				var arr = root.get_array();
+				for (var i = 0; i < arr.get_length(); i++) {
+					var f = Json.gobject_deserialize(typeof(Factory), arr.get_element(i)) as Factory;
+					if (f != null && f.name != "") {
+						ret.add(f);
+					}
+				}
+				return ret;
+			} catch (GLib.Error e) {
+				GLib.debug("MCP tool cache %s: %s", path, e.message);
+				return null;
+			}
+		}
+
+		/**
+		 * Store the tools/list result for config (replaces any earlier file
+		 * for the same server id).
+		 */
+		public void save(Config config, Gee.ArrayList<Factory> factories)
+		{
+			var arr = new Json.Array();
+			foreach (var f in factories) {
+				arr.add_element(Json.gobject_serialize(f));
+			}
+			var root = new Json.Node(Json.NodeType.ARRAY);
+			root.set_array(arr);
+			try {
+				GLib.DirUtils.create_with_parents(this.dir, 0755);
+				this.remove_stale(config);
+				GLib.FileUtils.set_contents(this.path_for(config), Json.to_string(root, false));
+			} catch (GLib.Error e) {
+				GLib.warning("MCP tool cache for '%s': %s", config.id, e.message);
+			}
+		}
+
+		private string path_for(Config config)
+		{
+			var hash = GLib.Checksum.compute_for_string(
+				GLib.ChecksumType.SHA256,
+				Json.to_string(Json.gobject_serialize(config), false)
+			);
+			return GLib.Path.build_filename(
+				this.dir,
+				"%s-%s.json".printf(
+					GLib.Uri.escape_string(config.id, null, false),
+					hash.substring(0, 16)
+				)
+			);
+		}
+
+		/** Remove files for older versions of this server's config. */
+		private void remove_stale(Config config) throws GLib.Error
+		{
+			var prefix = GLib.Uri.escape_string(config.id, null, false) + "-";
+			var d = GLib.Dir.open(this.dir);
+			string? name;
+			while ((name = d.read_name()) != null) {
+				if (!name.has_prefix(prefix) || !name.has_suffix(".json")) {
+					continue;
+				}
+				// id "a" must not remove files for id "a-b"
+				if (name.length != prefix.length + 16 + 5) {
+					continue;
+				}
+				GLib.FileUtils.unlink(GLib.Path.build_filename(this.dir, name));
+			}
+		}
+	}
+}
@@ -62,6 +62,8 @@ namespace OLLMtools.CodebaseSearch
 		
 		public override string name { get { return "codebase_search"; } }
 		public override string title { get { return "Semantic Codebase Search Tool"; } }
+		public override bool parallel_safe { get { return true; } }
+		public override bool prefetch_safe { get { return true; } }
 		public override string example_call {
 			get { return "{\"name\": \"codebase_search\", \"arguments\": {\"query\": \"where is file reading implemented\"}}"; }
 		}
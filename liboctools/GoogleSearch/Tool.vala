@@ -28,6 +28,7 @@ namespace OLLMtools.GoogleSearch
 	{
 	public override string name { get { return "google_search"; } }
 		public override string title { get { return "Google Search Tool"; } }
+		public override bool parallel_safe { get { return true; } }
 		public override string example_call {
 			get { return "{\"name\": \"google_search\", \"arguments\": {\"query\": \"Vala programming\"}}"; }
 		}
@@ -345,7 +345,8 @@ namespace OLLMtools.ReadFile
 						"Error: " + error_msg)));
 				throw new GLib.IOError.FAILED(error_msg);
 			}
-			if (!(yield this.file.read())) {
+			// Summaries come from the daemon's outline cache; no content needed here
+			if (!this.summarize && !(yield this.file.read())) {
 				var error_msg = "Failed to read file: " + this.normalized_path;
 				this.agent.add_message(new OLLMchat.Message("ui", 
 					OLLMchat.Message.fenced("text.oc-frame-danger Read file Response", 
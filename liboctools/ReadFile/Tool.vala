@@ -32,6 +32,8 @@ namespace OLLMtools.ReadFile
 	public override Type config_class() { return typeof(OLLMchat.Settings.BaseToolConfig); }
 			
 		public override string title { get { return "Read File Tool"; } }
+		public override bool parallel_safe { get { return true; } }
+		public override bool prefetch_safe { get { return true; } }
 		public override string example_call {
 			get { return "{\"name\": \"read_file\", \"arguments\": {\"file_path\": \"src/main.vala\", \"start_line\": 1, \"end_line\": 30}}"; }
 		}
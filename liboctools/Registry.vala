@@ -80,7 +80,24 @@ namespace OLLMtools
 		{
 			// Register standard liboctools tools with project_manager
 			manager.register_tool(new ReadFile.Tool(project_manager));
-			manager.register_tool(new RunCommand.Tool(project_manager));
+			var run_command_tool = new RunCommand.Tool(project_manager);
+			manager.register_tool(run_command_tool);
+			// kept sandboxes end with their agent and at exit; drop overlays a previous run left
+			manager.agent_released.connect((agent) => {
+				run_command_tool.release_worker(agent);
+			});
+			manager.session_removed.connect((session) => {
+				if (session.agent != null) {
+					run_command_tool.release_worker(session.agent);
+				}
+			});
+			var app = GLib.Application.get_default();
+			if (app != null) {
+				app.shutdown.connect(() => {
+					run_command_tool.release_workers(true);
+				});
+			}
+			OLLMbwrap.Overlay.remove_stale();
 			manager.register_tool(new WebFetch.Tool(project_manager));
 			manager.register_tool(new EditMode.Tool(project_manager));
 			manager.register_tool(new WriteFile.Tool(project_manager));
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+namespace OLLMtools.RunCommand
+{
+	/**
+	 * Tool-specific configuration for run_command.
+	 *
+	 * Extends BaseToolConfig with sandbox tuning.
+	 */
+	public class Config : OLLMchat.Settings.BaseToolConfig
+	{
+		/**
+		 * Keep the bubblewrap overlay between consecutive commands of the same
+		 * chat session instead of rebuilding it for every command.
+		 */
+		[Description(nick = "Warm overlay", blurb = "Reuse the sandbox overlay between commands in the same session (faster after large installs or builds)")]
+		public bool keep_warm_overlay { get; set; default = false; }
+
+		/**
+		 * Keep one sandbox process running per chat session and send each
+		 * command to it, instead of starting bubblewrap for every command.
+		 * Implies a warm overlay.
+		 */
+		[Description(nick = "Persistent sandbox", blurb = "Keep the sandbox running between commands in the same session (much lower per-command overhead)")]
+		public bool keep_sandbox_running { get; set; default = false; }
+
+		/**
+		 * Seconds a command in the persistent sandbox may run before the
+		 * sandbox is stopped; 0 means no limit.
+		 */
+		[Description(nick = "Persistent sandbox timeout", blurb = "Stop a command in the persistent sandbox after this many seconds (0 for no limit)")]
+		public int sandbox_timeout { get; set; default = 900; }
+
+		/**
+		 * Default constructor.
+		 */
+		public Config()
+		{
+		}
+	}
+}
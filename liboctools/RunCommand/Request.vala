@@ -279,12 +279,39 @@ namespace OLLMtools.RunCommand
 					run_status + "\n\n$ " + this.command)));
 			
 			// Execute the tool async
+			var preview = nl >= 0 ? this.command.substring(0, nl).strip() : this.command.strip();
+			this.agent.notification(new OLLMrpc.Notification() {
+				method = "event.run_command.start",
+				message = preview
+			});
 			try {
 				return yield this.execute_tool_async();
 			} catch (Error e) {
 				return "ERROR: " + e.message;
+			} finally {
+				this.agent.notification(new OLLMrpc.Notification() {
+					method = "event.run_command.end",
+					message = preview
+				});
 			}
 		}
+
+		/**
+		 * Forward a capture's rate-limited {@link OLLMbwrap.OutputCapture.progress}
+		 * to the activity banner while the command runs.
+		 *
+		 * @return handler id, for captures that outlive the request
+		 */
+		private ulong watch_output(OLLMbwrap.OutputCapture capture)
+		{
+			return capture.progress.connect((line) => {
+				this.agent.notification(new OLLMrpc.Notification() {
+					method = "event.run_command.output",
+					message = line,
+					progress_completed = capture.total_lines
+				});
+			});
+		}
 		
 		/**
 		 * Async method to execute the command with non-blocking I/O.
@@ -327,22 +354,30 @@ namespace OLLMtools.RunCommand
 					project,
 					project_manager
 				);
-				// due to vala async ctor quirk
-				var bubble = new OLLMbwrap.Bubble(verification);
-				bubble.project_path = project_path;
-				bubble.allow_network = this.network;
-				bubble.write_tokens = this.write_array;
-				bubble.write_roots = write_roots;
-
-				var output = yield bubble.exec(
-					this.command,
-					normalized_working_dir
-				);
+				// defaults are registered once with the tool (Registry)
+				var tool_config = this.agent.config().tools.get("run_command") as Config;
+				var keep_running = tool_config != null && tool_config.keep_sandbox_running;
+
+				string output;
+				if (keep_running || (tool_config != null && tool_config.keep_warm_overlay)) {
+					// the worker is shared by the session: set it up only once it is ours
+					var worker = run_command_tool.worker_for(this.agent, project_path, verification);
+					yield worker.acquire_turn();
+					try {
+						var bubble = keep_running ? worker.bubble
+							: new OLLMbwrap.Bubble.with_overlay(worker.bubble.overlay);
+						worker.timeout_seconds = (uint) int.max(0, tool_config.sandbox_timeout);
+						output = yield this.run_in(bubble, keep_running ? worker : null,
+							project_path, write_roots, normalized_working_dir);
+					} finally {
+						worker.release_turn();
+					}
+				} else {
+					output = yield this.run_in(new OLLMbwrap.Bubble(verification), null,
+						project_path, write_roots, normalized_working_dir);
+				}
 				
-				// Truncate output if needed
-				// FIXME - not sure this is a great idea - we will be bumping the context up soon
-				// with ollama create tricks
-				output = this.truncate_output(output, 100);
+				// Output is already bounded (head + tail lines) by the bubble's captures
 				if (output.strip() == "") {
 					output = "No output received from command";
 				}
@@ -360,6 +395,36 @@ namespace OLLMtools.RunCommand
 			}
 		}
 		
+		/**
+		 * Set this request's sandbox profile on bubble and run the command,
+		 * forwarding its output while it runs. With worker (whose turn the
+		 * caller holds) the command goes to the persistent sandbox.
+		 */
+		private async string run_in(
+			OLLMbwrap.Bubble bubble,
+			OLLMbwrap.Worker? worker,
+			string project_path,
+			Gee.HashMap<string, string> write_roots,
+			string working_dir) throws Error
+		{
+			bubble.project_path = project_path;
+			bubble.allow_network = this.network;
+			bubble.write_tokens = this.write_array;
+			bubble.write_roots = write_roots;
+			// the worker's captures outlive this request
+			var out_watch = this.watch_output(bubble.stdout_capture);
+			var err_watch = this.watch_output(bubble.stderr_capture);
+			try {
+				if (worker != null) {
+					return yield worker.exec_held(this.command, working_dir);
+				}
+				return yield bubble.exec(this.command, working_dir);
+			} finally {
+				bubble.stdout_capture.disconnect(out_watch);
+				bubble.stderr_capture.disconnect(err_watch);
+			}
+		}
+		
 		/**
 		 * Execute command using regular GLib.Subprocess (fallback for Flatpak or when bwrap is unavailable).
 		 * 
@@ -417,6 +482,10 @@ namespace OLLMtools.RunCommand
 			string stdout_output;
 			string stderr_output;
 			int exit_status = 0;
+			var out_cap = new OLLMbwrap.OutputCapture();
+			var err_cap = new OLLMbwrap.OutputCapture();
+			this.watch_output(out_cap);
+			this.watch_output(err_cap);
 
 #if G_OS_WIN32
 			GLib.Subprocess subprocess;
@@ -432,18 +501,19 @@ namespace OLLMtools.RunCommand
 				throw new GLib.IOError.FAILED("Failed to create subprocess: " + e.message);
 			}
 
-			// Win32 pipe reads via read_line_async can hang; STDIN_INHERIT can block cmd.exe.
-			string? stdout_buf = null;
-			string? stderr_buf = null;
-			bool success = false;
+			// STDIN_INHERIT can block cmd.exe: give it an empty stdin instead
 			try {
-				success = yield subprocess.communicate_utf8_async (null, null, out stdout_buf, out stderr_buf);
+				subprocess.get_stdin_pipe ().close (null);
+			} catch (GLib.Error e) {
+				GLib.debug ("closing stdin: %s", e.message);
+			}
+			// Pipes are read in blocks (read_line_async can hang on Win32 pipes) into bounded captures
+			try {
+				yield OLLMbwrap.OutputCapture.collect (subprocess, out_cap, err_cap);
+				exit_status = OLLMbwrap.OutputCapture.exit_code (subprocess);
 			} catch (GLib.Error e) {
 				throw new GLib.IOError.FAILED("Failed to run command: " + e.message);
 			}
-			stdout_output = stdout_buf ?? "";
-			stderr_output = stderr_buf ?? "";
-			exit_status = success ? 0 : subprocess.get_exit_status ();
 #else
 			if (this.run_as_root) {
 				var klauncher = new GLib.SubprocessLauncher (GLib.SubprocessFlags.NONE);
@@ -475,26 +545,16 @@ namespace OLLMtools.RunCommand
 				this.elevation_password = "";
 			}
 
-			var stdout_stream = subprocess.get_stdout_pipe ();
-			var stderr_stream = subprocess.get_stderr_pipe ();
-			stdout_output = yield this.read_stream_async (stdout_stream);
-			stderr_output = yield this.read_stream_async (stderr_stream);
-
+			// Both pipes drain concurrently into bounded captures while the process runs
 			try {
-				if (!(yield subprocess.wait_async (null))) {
-					exit_status = subprocess.get_exit_status ();
-				}
+				yield OLLMbwrap.OutputCapture.collect (subprocess, out_cap, err_cap);
+				exit_status = OLLMbwrap.OutputCapture.exit_code (subprocess);
 			} catch (GLib.Error e) {
-				if (!subprocess.get_successful ()) {
-					exit_status = subprocess.get_exit_status ();
-				}
 				throw new GLib.IOError.FAILED("Failed to wait for process: " + e.message);
 			}
 #endif
-			
-			// Truncate outputs if they exceed max lines (50)
-			stdout_output = this.truncate_output(stdout_output, 50);
-			//stderr_output = this.truncate_output(stderr_output, 50);
+			stdout_output = out_cap.to_text ();
+			stderr_output = err_cap.to_text ();
 			
 			// Escape code blocks in stdout output
  			
@@ -554,68 +614,6 @@ namespace OLLMtools.RunCommand
 			return output_content;
 		}
 		
-		/**
-		 * Truncates output to a maximum number of lines, adding a truncation message.
-		 * 
-		 * @param output The output string to truncate
-		 * @param max_lines Maximum number of lines to keep (default: 50)
-		 * @return Truncated output with truncation message if needed
-		 */
-		private string truncate_output(string output, int max_lines = 50)
-		{
-			if (output == "") {
-				return output;
-			}
-			
-			var lines = output.split("\n");
-			var total_lines = lines.length;
-			
-			if (total_lines <= max_lines) {
-				return output;
-			}
-			
-			// Truncate to max_lines
-			var truncated_lines = lines[0:max_lines];
-			var truncated = string.joinv("\n", truncated_lines);
-			
-			// Add truncation message (similar to codesearch tool format)
-			return truncated + "\n\n// ... (output truncated: showing first " + max_lines.to_string() + " of " + total_lines.to_string() + " lines, output too long) ...";
-		}
-
-#if !G_OS_WIN32
-		/**
-		 * Async method to read from a stream and accumulate output.
-		 */
-		private async string read_stream_async (InputStream? stream)
-		{
-			if (stream == null) {
-				return "";
-			}
-
-			var data_input = new GLib.DataInputStream (stream);
-			string output = "";
-
-			try {
-				while (true) {
-					string? line = yield data_input.read_line_async (GLib.Priority.DEFAULT, null);
-
-					if (line == null) {
-						break;
-					}
-
-					if (output != "") {
-						output += "\n";
-					}
-					output += line;
-				}
-			} catch (GLib.Error e) {
-				return output;
-			}
-
-			return output;
-		}
-#endif
-		
 		// FUTURE: Streaming support - uncomment these methods and fields to enable real-time output
 		// private OLLMchat.Message? current_tool_message = null;
 		// 
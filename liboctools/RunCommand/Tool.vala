@@ -42,7 +42,7 @@ namespace OLLMtools.RunCommand
 			
 		public override string name { get { return "run_command"; } }
 		
-		public override Type config_class() { return typeof(OLLMchat.Settings.BaseToolConfig); }
+		public override Type config_class() { return typeof(Config); }
 		public override string title { get { return "Run Shell Commands Tool"; } }
 		public override string example_call {
 			get { return "{\"name\": \"run_command\", \"arguments\": {\"command\": \"ls -la\"}}"; }
@@ -101,6 +101,19 @@ If the command fails, you should handle the error gracefully and provide a helpf
 		 * Optional - set to null if not available.
 		 */
 		public OLLMfiles.ProjectManager? project_manager { get; set; default = null; }
+
+		/**
+		 * Sessions kept between commands when {@link Config.keep_warm_overlay}
+		 * or {@link Config.keep_sandbox_running} is on: one worker (and its
+		 * warm overlay) per agent, most recently used last.
+		 */
+		private Gee.HashMap<OLLMchat.Agent.Interface, OLLMbwrap.Worker> workers =
+			new Gee.HashMap<OLLMchat.Agent.Interface, OLLMbwrap.Worker>();
+		private Gee.ArrayList<OLLMchat.Agent.Interface> recent =
+			new Gee.ArrayList<OLLMchat.Agent.Interface>();
+
+		/** Sessions kept warm before the least recently used idle one is released. */
+		private const int MAX_WORKERS = 4;
 		
 		public Tool(OLLMfiles.ProjectManager? project_manager = null)
 		{
@@ -113,6 +126,97 @@ If the command fails, you should handle the error gracefully and provide a helpf
 			return new Tool(this.project_manager);
 		}
 		
+		/**
+		 * Worker for agent and project_path, created on first use.
+		 *
+		 * With {@link Config.keep_sandbox_running} off only its turn and warm
+		 * overlay are used. A new project for the agent releases its previous
+		 * worker, so changes never leak between projects; other agents keep
+		 * theirs until {@link MAX_WORKERS} is exceeded. Callers hold the
+		 * worker's turn while they use it, and a worker is only released once
+		 * its turn is free.
+		 */
+		public OLLMbwrap.Worker worker_for(
+			OLLMchat.Agent.Interface agent,
+			string project_path,
+			OLLMtools.FileVerification verification)
+		{
+			this.recent.remove(agent);
+			this.recent.add(agent);
+			var worker = this.workers.get(agent);
+			if (worker != null && worker.bubble.project_path == project_path) {
+				return worker;
+			}
+			if (worker != null) {
+				this.retire(worker);
+			}
+			worker = new OLLMbwrap.Worker(new OLLMbwrap.Overlay(verification));
+			worker.bubble.project_path = project_path;
+			this.workers.set(agent, worker);
+
+			for (var i = 0; i < this.recent.size - 1
+					&& this.workers.size > MAX_WORKERS; ) {
+				var old = this.workers.get(this.recent.get(i));
+				if (old.is_busy) {
+					i++;
+					continue;
+				}
+				this.workers.unset(this.recent.get(i));
+				this.recent.remove_at(i);
+				this.retire(old);
+			}
+			return worker;
+		}
+
+		/**
+		 * Stop the sandbox kept for agent and delete its warm overlay, once
+		 * its current command (if any) has finished. Called when a session
+		 * replaces or drops the agent.
+		 */
+		public void release_worker(OLLMchat.Agent.Interface agent)
+		{
+			var worker = this.workers.get(agent);
+			this.recent.remove(agent);
+			if (worker == null) {
+				return;
+			}
+			this.workers.unset(agent);
+			this.retire(worker);
+		}
+
+		/**
+		 * Stop every kept sandbox and delete the warm overlays.
+		 *
+		 * @param now do not wait for running commands, and delete the
+		 *   overlays before returning (application shutdown)
+		 */
+		public void release_workers(bool now = false)
+		{
+			foreach (var worker in this.workers.values) {
+				if (now) {
+					worker.release(true);
+					continue;
+				}
+				this.retire(worker);
+			}
+			this.workers.clear();
+			this.recent.clear();
+		}
+
+		/** Release worker now, or after the caller holding its turn is done. */
+		private void retire(OLLMbwrap.Worker worker)
+		{
+			if (!worker.is_busy) {
+				worker.release();
+				return;
+			}
+			worker.acquire_turn.begin((obj, res) => {
+				worker.acquire_turn.end(res);
+				worker.release();
+				worker.release_turn();
+			});
+		}
+		
 		protected override OLLMchat.Tool.RequestBase? deserialize(Json.Node parameters_node)
 		{
 			return Json.gobject_deserialize(typeof(Request), parameters_node) as OLLMchat.Tool.RequestBase;
@@ -25,6 +25,7 @@ namespace OLLMtools.SessionFetch
 	{
 		public override string name { get { return "session_fetch"; } }
 		public override string title { get { return "Session Fetch Tool"; } }
+		public override bool parallel_safe { get { return true; } }
 		public override Type config_class() { return typeof(OLLMchat.Settings.BaseToolConfig); }
 		public override string example_call {
 			get {
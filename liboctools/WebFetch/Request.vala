@@ -29,12 +29,25 @@ namespace OLLMtools.WebFetch
 		/** Beyond this many newline-separated lines, tool output is capped for the LLM and UI. */
 		private const int TOOL_BODY_MAX_LINES = 200;
 
+		/** Text or markdown output beyond this many bytes is not read (minified pages have few lines). */
+		private const size_t TOOL_BODY_MAX_BYTES = 256 * 1024;
+
+		/** Hard cap on response bytes read, whatever the format. */
+		private const int64 BODY_MAX_BYTES = 8 * 1024 * 1024;
+
+		/** Read size for streaming the response body. */
+		private const size_t READ_CHUNK = 16384;
+
 		// Parameter properties
 		public string url { get; set; default = ""; }
 		/** Requested output: "markdown", "raw", or "base64". */
 		public string format { get; set; default = "markdown"; }
 		/** Actual result type after conversion: "markdown", "html", "json", "text", or "base64". Set by convert_content. */
 		private string result_format = "text";
+		/** True when reading stopped before the end of the body (line budget or {@link BODY_MAX_BYTES}). */
+		private bool cut_off = false;
+		/** Body bytes read by {@link read_content} (all of them unless {@link cut_off}), for the cache. */
+		private GLib.Bytes body_read = new GLib.Bytes({});
 		
 		/**
 		 * Default constructor.
@@ -77,15 +90,28 @@ namespace OLLMtools.WebFetch
 			this.agent.add_message(new OLLMchat.Message("ui", 
 				OLLMchat.Message.fenced("text.oc-frame-info.collapsed request", this.to_summary ())));
 			
+			var cache = ((Tool) this.tool).http_cache;
+			var cached = cache.lookup(this.url);
+			if (cached != null && cached.fresh()) {
+				var text = cache.variant(cached, this.format);
+				if (text != null) {
+					return this.cached_result(cached, text);
+				}
+			}
+
 			// Fetch URL with redirects disabled (redirects require approval)
-			Bytes content;
+			GLib.InputStream body;
 			Soup.Message? message = null;
 			try {
 				// Note: libsoup 3.0 handles redirects automatically, but we check status codes
 				// and handle redirects manually below to require approval
 				message = new Soup.Message("GET", this.url);
 				message.request_headers.replace("User-Agent", USER_AGENT);
-				content = yield ((Tool) this.tool).soup.send_and_read_async(
+				if (cached != null) {
+					cache.add_validators(cached, message);
+				}
+				// headers only; the body is streamed (and cut short) by read_content
+				body = yield ((Tool) this.tool).soup.send_async(
 					message, GLib.Priority.DEFAULT, null);
 			} catch (GLib.Error e) {
 				throw new GLib.IOError.FAILED("Failed to fetch URL: " + e.message);
@@ -95,9 +121,34 @@ namespace OLLMtools.WebFetch
 			if (message == null) {
 				throw new GLib.IOError.FAILED("Failed to create HTTP message");
 			}
+
+			// Not modified: reuse the cached conversion, or convert the cached body
+			if (message.status_code == 304 && cached != null) {
+				this.close_body(body);
+				cache.revalidated(cached, message);
+				var text = cache.variant(cached, this.format);
+				if (text != null) {
+					return this.cached_result(cached, text);
+				}
+				var cached_body = cache.body(cached);
+				if (cached_body == null) {
+					throw new GLib.IOError.FAILED("HTTP 304 but the cached copy of " + this.url + " is gone");
+				}
+				var converted = yield this.read_content(
+					new GLib.MemoryInputStream.from_bytes(cached_body),
+					cached.content_type.split(";")[0].strip());
+				// a body cached after a cut-off read is still only the first part
+				this.cut_off = this.cut_off || cached.partial;
+				var result = this.finish_result(converted);
+				cache.store_variant(cached, this.format, result);
+				return result;
+			}
 			
 			// Handle non-redirect cases (redirects are handled below)
 			// Check HTTP status for errors
+			if (message.status_code < 200 || message.status_code >= 300) {
+				this.close_body(body);
+			}
 			if (message.status_code < 200 || message.status_code >= 400) {
 				throw new GLib.IOError.FAILED("HTTP error: " + message.status_code.to_string());
 			}
@@ -107,28 +158,12 @@ namespace OLLMtools.WebFetch
 				// Detect content type
 				var content_type = this.detect_content_type(message.response_headers);
 				
-				// Convert content based on content type and format (updates this.format to actual format used)
-				var result = this.convert_content(content, content_type);
-				result = result.replace("\r\n", "\n");
-				var parts = result.split("\n");
-				if (parts.length > TOOL_BODY_MAX_LINES) {
-					result = string.joinv("\n", parts[0:TOOL_BODY_MAX_LINES]) +
-						"\n\n[Truncated: response had " + parts.length.to_string() +
-						" lines; showing the first " + TOOL_BODY_MAX_LINES.to_string() +
-						" lines only. Do not pull large page slices here (e.g. curl piped " +
-						"to head or wide ranges); that still floods context. For a targeted " +
-						"follow-up via run_command, use a narrow pipeline — for example " +
-						"curl -sL '" + this.url + "' | grep -E 'YourPattern' — so only matching " +
-						"lines are returned. That run_command must include \"network\": true " +
-						"(curl needs outbound network; the user may need to approve).]\n";
+				// Read and convert only as much as the output budget needs (sets result_format)
+				var result = this.finish_result(yield this.read_content(body, content_type));
+				var entry = cache.store(this.url, message, this.body_read, this.cut_off);
+				if (entry != null) {
+					cache.store_variant(entry, this.format, result);
 				}
-
-				// Send response message to UI using result_format (markdown, html, json, text, base64)
-				var response_title = this.tool.name + " - response (" + this.result_format + ")";
-				var type_prefix = this.result_format == "base64" ? "text" : this.result_format;
-				this.agent.add_message(new OLLMchat.Message("ui", 
-					OLLMchat.Message.fenced(type_prefix + ".oc-frame-success.collapsed " + response_title, result)));
-				
 				return result;
 			}
 			
@@ -178,6 +213,155 @@ namespace OLLMtools.WebFetch
 			);
 		}
 		
+		/**
+		 * Cap converted output at {@link TOOL_BODY_MAX_LINES} (with a note on
+		 * how to look further) and show it in the UI.
+		 *
+		 * @param converted output of {@link read_content}
+		 * @return text returned to the model
+		 */
+		private string finish_result(string converted)
+		{
+			var result = converted.replace("\r\n", "\n");
+			var parts = result.split("\n");
+			if (parts.length > TOOL_BODY_MAX_LINES || this.cut_off) {
+				var shown = int.min(parts.length, TOOL_BODY_MAX_LINES);
+				var had = this.cut_off
+					? "more than " + shown.to_string()
+					: parts.length.to_string();
+				result = string.joinv("\n", parts[0:shown]) +
+					"\n\n[Truncated: response had " + had +
+					" lines; showing the first " + shown.to_string() +
+					" lines only. Do not pull large page slices here (e.g. curl piped " +
+					"to head or wide ranges); that still floods context. For a targeted " +
+					"follow-up via run_command, use a narrow pipeline — for example " +
+					"curl -sL '" + this.url + "' | grep -E 'YourPattern' — so only matching " +
+					"lines are returned. That run_command must include \"network\": true " +
+					"(curl needs outbound network; the user may need to approve).]\n";
+			}
+			this.show_result(result);
+			return result;
+		}
+
+		/**
+		 * Result stored by an earlier fetch of the same URL and format.
+		 */
+		private string cached_result(OllamaWeb.HttpCache.Entry entry, string text)
+		{
+			this.result_format = this.result_format_for(entry.content_type.split(";")[0].strip());
+			this.show_result(text);
+			return text;
+		}
+
+		/**
+		 * Send response message to UI using result_format (markdown, html, json, text, base64).
+		 */
+		private void show_result(string result)
+		{
+			var response_title = this.tool.name + " - response (" + this.result_format + ")";
+			var type_prefix = this.result_format == "base64" ? "text" : this.result_format;
+			this.agent.add_message(new OLLMchat.Message("ui", 
+				OLLMchat.Message.fenced(type_prefix + ".oc-frame-success.collapsed " + response_title, result)));
+		}
+
+		/**
+		 * Stream the body and convert it, stopping once the output has more
+		 * than {@link TOOL_BODY_MAX_LINES} lines or {@link TOOL_BODY_MAX_BYTES},
+		 * or {@link BODY_MAX_BYTES} were read, so big pages cost only what the
+		 * model will see.
+		 * HTML is converted to markdown chunk by chunk as it arrives.
+		 *
+		 * Sets {@link result_format} (as {@link convert_content}), {@link cut_off}
+		 * and {@link body_read}.
+		 *
+		 * @param body response body stream (closed here)
+		 * @param content_type The detected Content-Type
+		 * @return Converted content as string
+		 */
+		protected async string read_content(GLib.InputStream body, string content_type) throws Error
+		{
+			var normalized_type = content_type.down();
+			var is_text = normalized_type.has_prefix("text/") || normalized_type == "application/json";
+			Markdown.HtmlParser? html = null;
+			if (normalized_type == "text/html" && this.format != "raw") {
+				html = new Markdown.HtmlParser("");
+			}
+
+			var raw = new GLib.ByteArray();
+			var buf = new uint8[READ_CHUNK];
+			int64 total = 0;
+			var lines = 0;
+			this.cut_off = false;
+			try {
+				while (true) {
+					var n = yield body.read_async(buf, GLib.Priority.DEFAULT, null);
+					if (n <= 0) {
+						break;
+					}
+					var chunk = buf[0:(int) n];
+					total += n;
+					raw.append(chunk);
+					if (html != null) {
+						html.push(chunk);
+						if (html.writer.md.len > TOOL_BODY_MAX_BYTES
+								|| html.writer.line_count() > TOOL_BODY_MAX_LINES) {
+							this.cut_off = true;
+							break;
+						}
+					} else {
+						if (is_text) {
+							foreach (var b in chunk) {
+								if (b == '\n') {
+									lines++;
+								}
+							}
+							if (lines > TOOL_BODY_MAX_LINES || raw.len > TOOL_BODY_MAX_BYTES) {
+								this.cut_off = true;
+								break;
+							}
+						}
+					}
+					if (total >= BODY_MAX_BYTES) {
+						this.cut_off = true;
+						break;
+					}
+				}
+			} catch (GLib.Error e) {
+				this.close_body(body);
+				throw new GLib.IOError.FAILED("Failed to fetch URL: " + e.message);
+			}
+			this.close_body(body);
+
+			var len = raw.len;
+			// convert_content casts text bodies to string
+			raw.append({ 0 });
+			this.body_read = new GLib.Bytes.from_bytes(GLib.ByteArray.free_to_bytes(raw), 0, len);
+
+			if (html != null) {
+				this.result_format = "markdown";
+				return html.finish();
+			}
+			if (this.cut_off && !is_text) {
+				throw new GLib.IOError.FAILED(
+					"Response is larger than " + (BODY_MAX_BYTES / (1024 * 1024)).to_string() +
+					" MB; too large to return as base64");
+			}
+			var ret = this.convert_content(this.body_read, content_type);
+			return this.cut_off ? ret.make_valid() : ret;
+		}
+
+		/**
+		 * Close a response body without waiting for the rest of it.
+		 */
+		private void close_body(GLib.InputStream body)
+		{
+			try {
+				body.close(null);
+			} catch (GLib.Error e) {
+				GLib.debug("web_fetch: closing body: %s", e.message);
+			}
+		}
+
 		/**
 		 * Core HTTP fetching logic (GET only).
 		 * 
@@ -262,45 +446,51 @@ namespace OLLMtools.WebFetch
 		 * @return Converted content as string
 		 */
 		protected string convert_content(Bytes content, string content_type)
+		{
+			this.result_format = this.result_format_for(content_type);
+			switch (this.result_format) {
+				case "base64":
+					return this.convert_to_base64(content);
+				case "markdown":
+					return this.convert_html_to_markdown(content);
+				default:
+					return (string)content.get_data();
+			}
+		}
+
+		/**
+		 * Result type for a Content-Type and the format property: markdown,
+		 * html, json, text, or base64.
+		 *
+		 * @param content_type The detected Content-Type
+		 */
+		protected string result_format_for(string content_type)
 		{
 			// Normalize content type to lowercase for comparison
 			var normalized_type = content_type.down();
 			
 			// Content-Type starts with "image/" → always base64 (regardless of format parameter)
 			if (normalized_type.has_prefix("image/")) {
-				this.result_format = "base64";
-				return this.convert_to_base64(content);
+				return "base64";
 			}
 			
 			// Content-Type is "text/html" → handle based on format parameter
 			if (normalized_type == "text/html") {
-				switch (this.format) {
-					case "raw":
-						this.result_format = "html";
-						return (string)content.get_data();
-					case "base64":
-					case "markdown":
-					default:
-						this.result_format = "markdown";
-						return this.convert_html_to_markdown(content);
-				}
+				return this.format == "raw" ? "html" : "markdown";
 			}
 			
 			// Content-Type starts with "text/" (non-HTML) → return raw text
 			if (normalized_type.has_prefix("text/")) {
-				this.result_format = "text";
-				return (string)content.get_data();
+				return "text";
 			}
 			
 			// Content-Type is "application/json" → return raw JSON
 			if (normalized_type == "application/json") {
-				this.result_format = "json";
-				return (string)content.get_data();
+				return "json";
 			}
 			
 			// Content-Type is anything else → base64
-			this.result_format = "base64";
-			return this.convert_to_base64(content);
+			return "base64";
 		}
 		
 		/**
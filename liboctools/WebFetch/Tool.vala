@@ -32,6 +32,8 @@ namespace OLLMtools.WebFetch
 		
 		public override Type config_class() { return typeof(OLLMchat.Settings.BaseToolConfig); }
 		public override string title { get { return "Web Fetch URL Tool"; } }
+		public override bool parallel_safe { get { return true; } }
+		public override bool prefetch_safe { get { return true; } }
 		public override string example_call {
 			get { return "{\"name\": \"web_fetch\", \"arguments\": {\"url\": \"https://example.com\"}}"; }
 		}
@@ -67,12 +69,18 @@ The tool requires permission to access the domain of the URL being fetched.""";
 		 * tool is registered on the history manager.
 		 */
 		public Soup.Session soup;
+
+		/**
+		 * Disk cache for fetched pages and their converted output.
+		 */
+		public OllamaWeb.HttpCache http_cache;
 		
 	public Tool(OLLMfiles.ProjectManager? project_manager = null)
 	{
 		base();
 		this.project_manager = project_manager;
 		this.soup = new Soup.Session();
+		this.http_cache = OllamaWeb.HttpCache.shared();
 	}
 		
 		public OLLMchat.Tool.BaseTool clone() throws Error
@@ -87,7 +87,9 @@ namespace OLLMvector2
 			return embeddings.get_vector (0);
 		}
 
-		public async OLLMchat.Response.FloatArray embed_to_float_array (string[] texts) throws GLib.Error
+		public async OLLMchat.Response.FloatArray embed_to_float_array (
+			string[] texts,
+			OLLMchat.Call.Priority priority = OLLMchat.Call.Priority.INTERACTIVE) throws GLib.Error
 		{
 			if (texts.length == 0) {
 				return new OLLMchat.Response.FloatArray (0);
@@ -100,6 +102,7 @@ namespace OLLMvector2
 				input = texts,
 				dimensions = -1
 			};
+			call.priority = priority;
 			var response = yield call.exec_embedding ();
 			if (response.embeddings.rows == 0) {
 				throw new GLib.IOError.FAILED ("Failed to get embeddings");
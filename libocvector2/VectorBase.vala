@@ -117,6 +117,8 @@ namespace OLLMvector2
 						stream = true,
 						options = usage.options
 					};
+					chat.priority = OLLMchat.Call.Priority.BACKGROUND;
+					chat.response_cache = OLLMchat.Call.ResponseCache.shared();
 					// Only stream analysis output to stderr when on main thread (e.g. CLI); skip when in background thread
 					var main_ctx = GLib.MainContext.default();
 					var current_ctx = GLib.MainContext.get_thread_default();
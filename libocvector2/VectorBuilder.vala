@@ -278,7 +278,8 @@ namespace OLLMvector2
 			meta.element_name = element_name;
 			meta.description = description;
 
-			var embeddings = yield this.database.embed_to_float_array ({ description });
+			var embeddings = yield this.database.embed_to_float_array (
+				{ description }, OLLMchat.Call.Priority.BACKGROUND);
 			if (embeddings.rows == 0) {
 				return;
 			}
@@ -300,7 +301,8 @@ namespace OLLMvector2
 				documents[i] = format_document (elements.get (i));
 			}
 
-			var embeddings = yield this.database.embed_to_float_array (documents);
+			var embeddings = yield this.database.embed_to_float_array (
+				documents, OLLMchat.Call.Priority.BACKGROUND);
 			if (embeddings.rows != elements.size) {
 				throw new GLib.IOError.FAILED ("Embedding count mismatch");
 			}
@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ */
+
+namespace OllamaWeb
+{
+	/**
+	 * Directory of cached files with an ''index.json'' of
+	 * {@link DiskCacheEntry} records, capped at {@link max_bytes} and
+	 * evicted least recently used first.
+	 *
+	 * Base of {@link HttpCache} and OLLMchat.Call.ResponseCache. Subclasses
+	 * name their entry type and files and decide what a hit or a store
+	 * means; this class keeps the index, sizes and eviction. Callers on
+	 * several threads hold {@link mutex} around every call.
+	 */
+	public abstract class DiskCache : Object
+	{
+		/** Hits only move last_used; their index write waits this long (ms). */
+		private const uint SAVE_DELAY_MS = 5000;
+
+		/** Directory holding index.json and the entries' files. */
+		public string dir { get; construct; }
+
+		/** Size cap for all entries' files; least recently used entries go first. */
+		public int64 max_bytes { get; set; default = 64 * 1024 * 1024; }
+
+		protected GLib.Mutex mutex = GLib.Mutex();
+		private Gee.HashMap<string, DiskCacheEntry> entries =
+			new Gee.HashMap<string, DiskCacheEntry>();
+		private bool loaded = false;
+		private int64 total = 0;
+		private uint save_timeout_id = 0;
+
+		/** Concrete entry type stored in the index. */
+		protected abstract GLib.Type entry_type();
+
+		/** File suffixes (see {@link path}) that may exist for entry. */
+		protected abstract string[] suffixes(DiskCacheEntry entry);
+
+		/**
+		 * Write a pending index update now (e.g. before exit). Hits only
+		 * change last_used, so losing one costs LRU accuracy, not entries.
+		 */
+		public void flush()
+		{
+			this.mutex.lock();
+			if (this.save_timeout_id != 0) {
+				this.save();
+			}
+			this.mutex.unlock();
+		}
+
+		/** Entry stored under key, or null. */
+		protected DiskCacheEntry? find(string key)
+		{
+			this.load();
+			return this.entries.get(key);
+		}
+
+		/** Count a hit for LRU; the index write is deferred. */
+		protected void touch(DiskCacheEntry entry)
+		{
+			entry.last_used = GLib.get_real_time() / 1000000;
+			this.schedule_save();
+		}
+
+		/**
+		 * Index entry, whose files are written, replacing any earlier entry
+		 * for the key; evicts and saves.
+		 */
+		protected void add(DiskCacheEntry entry)
+		{
+			var old = this.find(entry.key);
+			if (old != null && old != entry) {
+				this.drop(old);
+			}
+			this.entries.set(entry.key, entry);
+			this.total += entry.size;
+			this.evict();
+			this.save();
+		}
+
+		/** entry gained a file of bytes; evicts and saves. */
+		protected void grow(DiskCacheEntry entry, int64 bytes)
+		{
+			entry.size += bytes;
+			this.total += bytes;
+			this.evict();
+			this.save();
+		}
+
+		/** Delete entry's files and forget it (index saved by the caller). */
+		protected void drop(DiskCacheEntry entry)
+		{
+			foreach (var suffix in this.suffixes(entry)) {
+				GLib.FileUtils.unlink(this.path(entry, suffix));
+			}
+			if (this.entries.get(entry.key) == entry) {
+				this.entries.unset(entry.key);
+				this.total -= entry.size;
+			}
+		}
+
+		protected string path(DiskCacheEntry entry, string suffix)
+		{
+			return GLib.Path.build_filename(this.dir, entry.file_id + "." + suffix);
+		}
+
+		/** Remove least recently used entries until under {@link max_bytes}. */
+		private void evict()
+		{
+			if (this.total <= this.max_bytes) {
+				return;
+			}
+			var by_use = new Gee.ArrayList<DiskCacheEntry>();
+			by_use.add_all(this.entries.values);
+			by_use.sort((a, b) => {
+				return a.last_used < b.last_used ? -1 : (a.last_used > b.last_used ? 1 : 0);
+			});
+			foreach (var entry in by_use) {
+				if (this.total <= this.max_bytes) {
+					break;
+				}
+				this.drop(entry);
+			}
+		}
+
+		private void load()
+		{
+			if (this.loaded) {
+				return;
+			}
+			this.loaded = true;
+			var index = GLib.Path.build_filename(this.dir, "index.json");
+			if (!GLib.FileUtils.test(index, GLib.FileTest.EXISTS)) {
+				return;
+			}
+			try {
+				var parser = new Json.Parser();
+				parser.load_from_file(index);
+				var root = parser.get_root();
+				if (root == null || root.get_node_type() != Json.NodeType.ARRAY) {
+					return;
+				}
+				root.get_array().foreach_element((arr, i, node) => {
+					var entry = Json.gobject_deserialize(this.entry_type(), node) as DiskCacheEntry;
+					if (entry == null || entry.key == "" || entry.file_id == "") {
+						return;
+					}
+					this.entries.set(entry.key, entry);
+					this.total += entry.size;
+				});
+			} catch (GLib.Error e) {
+				GLib.warning("Cache index %s: %s", index, e.message);
+			}
+		}
+
+		/** Save the index once a burst of hits has passed. */
+		private void schedule_save()
+		{
+			if (this.save_timeout_id != 0) {
+				return;
+			}
+			this.save_timeout_id = GLib.Timeout.add(SAVE_DELAY_MS, () => {
+				this.mutex.lock();
+				this.save_timeout_id = 0;
+				this.save();
+				this.mutex.unlock();
+				return false;
+			});
+		}
+
+		/** Write index.json (also used to persist a drop). */
+		protected void save()
+		{
+			if (this.save_timeout_id != 0) {
+				GLib.Source.remove(this.save_timeout_id);
+				this.save_timeout_id = 0;
+			}
+			var arr = new Json.Array();
+			foreach (var entry in this.entries.values) {
+				arr.add_element(Json.gobject_serialize(entry));
+			}
+			var root = new Json.Node(Json.NodeType.ARRAY);
+			root.set_array(arr);
+			try {
+				GLib.DirUtils.create_with_parents(this.dir, 0700);
+				GLib.FileUtils.set_contents(
+					GLib.Path.build_filename(this.dir, "index.json"),
+					Json.to_string(root, false));
+			} catch (GLib.Error e) {
+				GLib.warning("Cache index %s: %s", this.dir, e.message);
+			}
+		}
+	}
+}
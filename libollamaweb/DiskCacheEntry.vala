@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ */
+
+namespace OllamaWeb
+{
+	/**
+	 * Index record of a {@link DiskCache}; subclasses add their own
+	 * metadata. The cached data lives in files named after file_id.
+	 */
+	public class DiskCacheEntry : Object
+	{
+		public string key { get; set; default = ""; }
+		/** File name stem for the entry's files. */
+		public string file_id { get; set; default = ""; }
+		/** Unix time (s) of the last hit, for LRU eviction. */
+		public int64 last_used { get; set; default = 0; }
+		/** Bytes on disk for all of the entry's files. */
+		public int64 size { get; set; default = 0; }
+	}
+}
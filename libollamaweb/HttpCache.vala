@@ -0,0 +1,314 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ */
+
+namespace OllamaWeb
+{
+	/**
+	 * Disk-backed HTTP response cache (private cache semantics).
+	 *
+	 * One entry per URL: the response body plus any number of named
+	 * variants derived from it (e.g. web_fetch markdown), so a hit skips
+	 * both the download and the conversion. Freshness follows
+	 * Cache-Control max-age / no-cache / no-store, Expires and the usual
+	 * Last-Modified heuristic; stale entries with an ETag or Last-Modified
+	 * are revalidated with a conditional GET and reused on 304.
+	 * Total size is capped at {@link DiskCache.max_bytes}, least recently
+	 * used first. Used from the main thread only.
+	 *
+	 * {{{
+	 * var cache = HttpCache.shared();
+	 * var entry = cache.lookup(url);
+	 * if (entry != null && entry.fresh()) {
+	 *     return cache.body(entry);
+	 * }
+	 * var msg = new Soup.Message("GET", url);
+	 * if (entry != null) {
+	 *     cache.add_validators(entry, msg);
+	 * }
+	 * var bytes = yield session.send_and_read_async(msg, ...);
+	 * if (msg.status_code == 304 && entry != null) {
+	 *     cache.revalidated(entry, msg);
+	 *     return cache.body(entry);
+	 * }
+	 * cache.store(url, msg, bytes);
+	 * }}}
+	 */
+	public class HttpCache : DiskCache
+	{
+		/** Heuristic freshness (10% of the Last-Modified age) never exceeds this. */
+		private const int64 HEURISTIC_MAX_S = 86400;
+
+		/**
+		 * Cached response metadata (keyed by URL); the body and variants are
+		 * files next to the index.
+		 */
+		public class Entry : DiskCacheEntry
+		{
+			public string content_type { get; set; default = ""; }
+			public string etag { get; set; default = ""; }
+			public string last_modified { get; set; default = ""; }
+			/** Unix time (s) until which the entry is used without asking the server. */
+			public int64 fresh_until { get; set; default = 0; }
+			/** The stored body is only the start of the response (reader stopped early). */
+			public bool partial { get; set; default = false; }
+			/** Names of stored variants. */
+			public string[] variants { get; set; default = {}; }
+
+			/** Usable without contacting the server. */
+			public bool fresh()
+			{
+				return GLib.get_real_time() / 1000000 < this.fresh_until;
+			}
+
+			/** Has a validator for a conditional GET. */
+			public bool can_revalidate()
+			{
+				return this.etag != "" || this.last_modified != "";
+			}
+		}
+
+		private static HttpCache? shared_cache = null;
+
+		/**
+		 * Process-wide cache under the user cache dir (''ollmchat/http'').
+		 */
+		public static HttpCache shared()
+		{
+			if (shared_cache == null) {
+				shared_cache = new HttpCache(GLib.Path.build_filename(
+					GLib.Environment.get_user_cache_dir(), "ollmchat", "http"));
+			}
+			return shared_cache;
+		}
+
+		public HttpCache(string dir)
+		{
+			Object(dir: dir);
+		}
+
+		protected override GLib.Type entry_type()
+		{
+			return typeof(Entry);
+		}
+
+		protected override string[] suffixes(DiskCacheEntry entry)
+		{
+			string[] ret = { "body" };
+			foreach (var name in ((Entry) entry).variants) {
+				ret += "v-" + name;
+			}
+			return ret;
+		}
+
+		/**
+		 * Entry for url (fresh or not), or null when nothing usable is stored.
+		 * Counts as a use for LRU; the index write for that is deferred (see
+		 * {@link DiskCache.flush}).
+		 */
+		public Entry? lookup(string url)
+		{
+			var entry = this.find(url) as Entry;
+			if (entry == null) {
+				return null;
+			}
+			if (!GLib.FileUtils.test(this.path(entry, "body"), GLib.FileTest.EXISTS)) {
+				this.drop(entry);
+				this.save();
+				return null;
+			}
+			this.touch(entry);
+			return entry;
+		}
+
+		/**
+		 * Make msg a conditional GET for entry (If-None-Match / If-Modified-Since).
+		 */
+		public void add_validators(Entry entry, Soup.Message msg)
+		{
+			if (entry.etag != "") {
+				msg.request_headers.replace("If-None-Match", entry.etag);
+			}
+			if (entry.last_modified != "") {
+				msg.request_headers.replace("If-Modified-Since", entry.last_modified);
+			}
+		}
+
+		/**
+		 * Stored response body, or null if the file went missing.
+		 */
+		public GLib.Bytes? body(Entry entry)
+		{
+			try {
+				uint8[] data;
+				GLib.FileUtils.get_data(this.path(entry, "body"), out data);
+				return new GLib.Bytes.take((owned) data);
+			} catch (GLib.Error e) {
+				GLib.debug("HTTP cache %s: %s", entry.key, e.message);
+				return null;
+			}
+		}
+
+		/**
+		 * Stored variant text (see {@link store_variant}), or null.
+		 */
+		public string? variant(Entry entry, string name)
+		{
+			if (!(name in entry.variants)) {
+				return null;
+			}
+			try {
+				string text;
+				GLib.FileUtils.get_contents(this.path(entry, "v-" + name), out text);
+				return text;
+			} catch (GLib.Error e) {
+				GLib.debug("HTTP cache %s (%s): %s", entry.key, name, e.message);
+				return null;
+			}
+		}
+
+		/**
+		 * Store a 200 response for url, replacing any earlier entry and its
+		 * variants.
+		 *
+		 * @param msg the finished message (status and response headers are read)
+		 * @param body response body (or the part that was read, see partial)
+		 * @param partial reader stopped before the end of the body
+		 * @return the new entry, or null when the response may not or need
+		 *     not be cached (no-store, or neither fresh nor revalidatable)
+		 */
+		public Entry? store(string url, Soup.Message msg, GLib.Bytes body, bool partial = false)
+		{
+			var old = this.find(url);
+			if (old != null) {
+				this.drop(old);
+			}
+			var headers = msg.response_headers;
+			var fresh_until = this.fresh_until_for(headers);
+			var etag = headers.get_one("ETag") ?? "";
+			var last_modified = headers.get_one("Last-Modified") ?? "";
+			if (msg.status_code != 200 || msg.method != "GET" || fresh_until < 0
+					|| (fresh_until <= GLib.get_real_time() / 1000000
+						&& etag == "" && last_modified == "")) {
+				this.save();
+				return null;
+			}
+			var entry = new Entry() {
+				key = url,
+				file_id = GLib.Checksum.compute_for_string(GLib.ChecksumType.SHA256, url).substring(0, 32),
+				content_type = headers.get_one("Content-Type") ?? "",
+				etag = etag,
+				last_modified = last_modified,
+				fresh_until = fresh_until,
+				last_used = GLib.get_real_time() / 1000000,
+				size = (int64) body.get_size(),
+				partial = partial
+			};
+			try {
+				GLib.DirUtils.create_with_parents(this.dir, 0700);
+				GLib.FileUtils.set_data(this.path(entry, "body"), body.get_data());
+			} catch (GLib.Error e) {
+				GLib.warning("HTTP cache %s: %s", url, e.message);
+				return null;
+			}
+			this.add(entry);
+			return entry;
+		}
+
+		/**
+		 * Keep text derived from entry's body (e.g. converted markdown) under
+		 * name; dropped with the entry.
+		 */
+		public void store_variant(Entry entry, string name, string text)
+		{
+			// a variant is fixed by the body it came from
+			if (this.find(entry.key) != entry || name in entry.variants) {
+				return;
+			}
+			try {
+				GLib.FileUtils.set_contents(this.path(entry, "v-" + name), text);
+			} catch (GLib.Error e) {
+				GLib.warning("HTTP cache %s (%s): %s", entry.key, name, e.message);
+				return;
+			}
+			var names = entry.variants;
+			names += name;
+			entry.variants = names;
+			this.grow(entry, text.length);
+		}
+
+		/**
+		 * A conditional GET for entry returned 304: take the new freshness
+		 * (and validators, if sent) from msg.
+		 */
+		public void revalidated(Entry entry, Soup.Message msg)
+		{
+			var headers = msg.response_headers;
+			var fresh_until = this.fresh_until_for(headers);
+			if (fresh_until < 0) {
+				this.drop(entry);
+				this.save();
+				return;
+			}
+			entry.fresh_until = fresh_until;
+			entry.etag = headers.get_one("ETag") ?? entry.etag;
+			entry.last_modified = headers.get_one("Last-Modified") ?? entry.last_modified;
+			entry.last_used = GLib.get_real_time() / 1000000;
+			this.save();
+		}
+
+		/** Forget url. */
+		public void remove(string url)
+		{
+			var entry = this.find(url);
+			if (entry == null) {
+				return;
+			}
+			this.drop(entry);
+			this.save();
+		}
+
+		/**
+		 * Unix time until which a response with headers is fresh; now (or
+		 * earlier) when it must be revalidated first, -1 for no-store.
+		 */
+		private int64 fresh_until_for(Soup.MessageHeaders headers)
+		{
+			var now = GLib.get_real_time() / 1000000;
+			var cc = headers.get_one("Cache-Control");
+			if (cc != null) {
+				var directives = Soup.header_parse_param_list(cc);
+				if (directives.contains("no-store")) {
+					return -1;
+				}
+				if (directives.contains("no-cache")) {
+					return now;
+				}
+				var max_age = directives.get("max-age");
+				if (max_age != null) {
+					var age = int64.parse(headers.get_one("Age") ?? "0");
+					return now + int64.max(0, int64.parse(max_age) - age);
+				}
+			}
+			var expires = headers.get_one("Expires");
+			if (expires != null) {
+				var when = Soup.date_time_new_from_http_string(expires);
+				// invalid dates (e.g. "0") mean already expired
+				return when == null ? now : when.to_unix();
+			}
+			var last_modified = headers.get_one("Last-Modified");
+			if (last_modified != null) {
+				var lm = Soup.date_time_new_from_http_string(last_modified);
+				if (lm != null && lm.to_unix() < now) {
+					return now + int64.min((now - lm.to_unix()) / 10, HEURISTIC_MAX_S);
+				}
+			}
+			return now;
+		}
+	}
+}
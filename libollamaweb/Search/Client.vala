@@ -20,18 +20,39 @@ namespace OllamaWeb.Search
 
 		private Soup.Session session { get; set; default = new Soup.Session(); }
 
+		/** Disk cache for fetched pages (shared with web_fetch). */
+		public HttpCache http_cache { get; set; default = HttpCache.shared(); }
+
 		public async string fetch_path(string path, GLib.Cancellable? cancellable = null) throws Error, GLib.IOError, GLib.Error
 		{
 			var url = BASE_URL + path;
+			var cached = this.http_cache.lookup(url);
+			if (cached != null && cached.fresh()) {
+				var body = this.http_cache.body(cached);
+				if (body != null) {
+					return (string) body.get_data();
+				}
+			}
 			// GLib.debug("ollamaweb GET %s", url);
 			var message = new Soup.Message("GET", url);
 			message.request_headers.append("User-Agent", USER_AGENT);
+			if (cached != null) {
+				this.http_cache.add_validators(cached, message);
+			}
 			try {
 				var bytes = yield this.session.send_and_read_async(
 					message,
 					GLib.Priority.DEFAULT,
 					cancellable
 				);
+				if (message.status_code == 304 && cached != null) {
+					this.http_cache.revalidated(cached, message);
+					var body = this.http_cache.body(cached);
+					if (body != null) {
+						return (string) body.get_data();
+					}
+					throw new Error.NETWORK("HTTP 304 for " + url + " but the cached copy is gone");
+				}
 				if (message.status_code == 429 || message.status_code == 503) {
 					throw new Error.RATE_LIMITED("HTTP " + message.status_code.to_string());
 				}
@@ -41,6 +62,7 @@ namespace OllamaWeb.Search
 				if (message.status_code < 200 || message.status_code >= 300) {
 					throw new Error.NETWORK("HTTP " + message.status_code.to_string() + " for " + url);
 				}
+				this.http_cache.store(url, message, bytes);
 				// GLib.debug(
 				// 	"HTTP %u body_len=%u %s",
 				// 	message.status_code,
@@ -55,6 +55,12 @@ namespace OLLMchat.Agent
 		 */
 		protected OLLMchat.Call.ChatBase chat_call;
 		
+		/**
+		 * Token budget for the history sent on {@link chat_call}; packs
+		 * each request and raises summarize_wanted near the limit.
+		 */
+		public ContextWindow context_window { get; private set; }
+		
 		// Signal handler IDs removed - agent usage now uses direct method calls
 		
 		/**
@@ -83,6 +89,14 @@ namespace OLLMchat.Agent
 		 */
 		public signal void message_completed(OLLMchat.Response.Chat response);
 		
+		/**
+		 * Signal emitted when a tool request created for this agent is
+		 * registered, before it executes. Lets the caller of
+		 * {@link Tool.BaseTool.execute} get its own request without
+		 * shared state on the (shared) tool.
+		 */
+		public signal void tool_registered(OLLMchat.Tool.RequestBase request);
+		
 		/**
 		 * Registry of active tool requests for monitoring streaming chunks.
 		 * Keyed by request_id (auto-generated int).
@@ -123,6 +137,9 @@ namespace OLLMchat.Agent
 				options = usage.options,
 				agent = this
 			};
+			this.context_window = new ContextWindow(usage, this.connection);
+			this.chat_call.context_window = this.context_window;
+			this.session.manager.tool_unregistered.connect(this.on_tool_unregistered);
 			
 			// Only add tools when the model supports tool calling (verified here, not at request time)
 			if (usage.model_obj == null || !usage.model_obj.can_call) {
@@ -141,6 +158,15 @@ namespace OLLMchat.Agent
 			// Signal connections removed - agent usage now uses direct method calls from Chat
 		}
 		
+		/**
+		 * A tool left the manager (e.g. an MCP server stopped listing it);
+		 * stop offering it to the model.
+		 */
+		private void on_tool_unregistered(string name)
+		{
+			this.chat_call.tools.unset(name);
+		}
+		
 		/**
 		 * Destructor - signal disconnections removed (no longer connecting to client signals).
 		 */
@@ -172,6 +198,9 @@ namespace OLLMchat.Agent
 			
 			// If response is done, emit message_completed signal for active tool requests
 			// This allows tools to know when the message is complete and they can process/finalize
+			if (response.done) {
+				this.context_window.observe(response);
+			}
 			if (response.done && response.message != null) {
 				GLib.debug("Agent.handle_stream_chunk: Emitting message_completed signal (response.done=%s, message.role=%s, message.is_done=%s, active_tools.size=%zu)", 
 					response.done.to_string(), response.message.role, response.message.is_done.to_string(), this.active_tools.size);
@@ -197,6 +226,132 @@ namespace OLLMchat.Agent
 		 */
 		public virtual async void on_replay(OLLMchat.Message m) {}
 		
+		/**
+		 * Maximum number of parallel-safe tool calls run at the same time
+		 * by {@link execute_tools}.
+		 */
+		public int max_parallel_tools { get; set; default = 4; }
+		
+		/**
+		 * Start {@link Tool.BaseTool.prefetch_safe} tool calls as soon as
+		 * they appear in the stream, instead of after the reply is done.
+		 */
+		public bool prefetch_tools { get; set; default = true; }
+		
+		/** Prefetches started for {@link prefetch_response}, not yet taken. */
+		private Gee.ArrayList<Prefetch> prefetches = new Gee.ArrayList<Prefetch>();
+		private Response.Chat? prefetch_response = null;
+		/** Tool calls of {@link prefetch_response} already looked at. */
+		private int prefetch_seen = 0;
+		/** Set once a call that is not parallel-safe was seen; later calls must wait for it. */
+		private bool prefetch_barrier = false;
+		/** Cancellable of the streaming call, watched to drop prefetches on cancel. */
+		private GLib.Cancellable? prefetch_cancellable = null;
+		private ulong prefetch_cancel_id = 0;
+		
+		/**
+		 * Called by Chat after each streamed chunk; starts a {@link Prefetch}
+		 * for every new complete call to a prefetch-safe tool.
+		 *
+		 * @param response the response being streamed
+		 */
+		public void prefetch_tool_calls(Response.Chat response)
+		{
+			if (!this.prefetch_tools || response.message == null) {
+				return;
+			}
+			if (response != this.prefetch_response) {
+				this.discard_prefetches();
+				this.prefetch_response = response;
+				this.watch_prefetch_cancel();
+			}
+			if (this.prefetch_cancellable != null && this.prefetch_cancellable.is_cancelled()) {
+				return;
+			}
+			var calls = response.message.tool_calls;
+			for (; this.prefetch_seen < calls.size && !this.prefetch_barrier; this.prefetch_seen++) {
+				if (this.prefetches.size >= int.max(1, this.max_parallel_tools)) {
+					return;
+				}
+				var tool_call = calls.get(this.prefetch_seen);
+				if (tool_call.function.name == "" || tool_call.function.arguments == null) {
+					continue;
+				}
+				if (!this.is_parallel_call(tool_call)) {
+					// Calls after a mutating one must see its effect
+					this.prefetch_barrier = true;
+					return;
+				}
+				var tool = this.chat_call.tools.get(tool_call.function.name);
+				if (!tool.prefetch_safe || tool.is_wrapped || !tool.active) {
+					continue;
+				}
+				var prefetch = new Prefetch(this, tool_call);
+				this.prefetches.add(prefetch);
+				prefetch.start(tool);
+			}
+		}
+		
+		/**
+		 * Removes and returns the prefetch started for a call with the same
+		 * tool and arguments, or null.
+		 */
+		private Prefetch? take_prefetch(Response.ToolCall tool_call)
+		{
+			if (this.prefetches.size == 0) {
+				return null;
+			}
+			var signature = Prefetch.signature_for(tool_call);
+			foreach (var prefetch in this.prefetches) {
+				if (prefetch.signature == signature) {
+					this.prefetches.remove(prefetch);
+					return prefetch;
+				}
+			}
+			return null;
+		}
+		
+		/**
+		 * Drops prefetches that no confirmed call has taken.
+		 */
+		private void discard_prefetches()
+		{
+			foreach (var prefetch in this.prefetches) {
+				prefetch.discard();
+			}
+			this.prefetches.clear();
+			this.prefetch_response = null;
+			this.prefetch_seen = 0;
+			this.prefetch_barrier = false;
+			if (this.prefetch_cancel_id != 0) {
+				GLib.SignalHandler.disconnect(this.prefetch_cancellable, this.prefetch_cancel_id);
+				this.prefetch_cancel_id = 0;
+			}
+			this.prefetch_cancellable = null;
+		}
+		
+		/**
+		 * Discard the prefetches of the streaming call when its cancellable
+		 * fires; execute_tools is not reached for a cancelled reply.
+		 */
+		private void watch_prefetch_cancel()
+		{
+			this.prefetch_cancellable = this.chat_call.cancellable;
+			if (this.prefetch_cancellable == null) {
+				return;
+			}
+			var response = this.prefetch_response;
+			this.prefetch_cancel_id = this.prefetch_cancellable.cancelled.connect(() => {
+				// cancel() may run on another thread; drop on the main loop
+				GLib.Idle.add(() => {
+					if (this.prefetch_response == response) {
+						this.discard_prefetches();
+					}
+					return false;
+				});
+			});
+		}
+		
 		/**
 		 * Executes all tool calls and returns tool reply messages.
 		 * 
@@ -209,73 +364,177 @@ namespace OLLMchat.Agent
 		 * - Creating tool reply messages
 		 * - Error handling (creates tool_call_fail message on error, continues with next tool)
 		 * 
+		 * Consecutive calls to tools flagged {@link Tool.BaseTool.parallel_safe}
+		 * run together (up to {@link max_parallel_tools} at once); any other
+		 * tool waits for those to finish and then runs on its own. Reply
+		 * messages are always returned in the order of tool_calls.
+		 * Prefetched results are only used for calls before the first such
+		 * tool; later calls run again after it.
+		 * 
 		 * @param tool_calls The list of tool calls to execute
 		 * @return Array of tool reply messages (tool_reply or tool_call_fail messages)
 		 */
 		public virtual async Gee.ArrayList<Message> execute_tools(Gee.ArrayList<Response.ToolCall> tool_calls)
 		{
+			var results = new Gee.ArrayList<Message?>();
+			var batch = new Gee.ArrayList<int>();
+			
+			for (var i = 0; i < tool_calls.size; i++) {
+				results.add(null);
+				var tool_call = tool_calls.get(i);
+				if (this.is_parallel_call(tool_call)) {
+					batch.add(i);
+					continue;
+				}
+				// Mutating (or unknown) tool - flush the parallel batch first
+				yield this.execute_parallel(tool_calls, batch, results);
+				batch.clear();
+				// Prefetches of later calls ran before this one; re-execute them
+				this.discard_prefetches();
+				var reply = yield this.execute_tool(tool_call);
+				results.set(i, reply);
+			}
+			yield this.execute_parallel(tool_calls, batch, results);
+			this.discard_prefetches();
+
 			var reply_messages = new Gee.ArrayList<Message>();
+			foreach (var msg in results) {
+				reply_messages.add(msg);
+			}
+			return reply_messages;
+		}
+		
+		/**
+		 * Whether a tool call can run alongside other calls in this turn.
+		 */
+		private bool is_parallel_call(Response.ToolCall tool_call)
+		{
+			if (!this.chat_call.tools.has_key(tool_call.function.name)) {
+				return false;
+			}
+			var tool = this.chat_call.tools.get(tool_call.function.name);
+			return tool.parallel_safe && !tool.is_wrapped;
+		}
+		
+		/**
+		 * Runs the calls at the given indexes concurrently, at most
+		 * {@link max_parallel_tools} at a time, storing each reply at its
+		 * index in results.
+		 */
+		private async void execute_parallel(
+			Gee.ArrayList<Response.ToolCall> tool_calls,
+			Gee.ArrayList<int> indexes,
+			Gee.ArrayList<Message?> results)
+		{
+			if (indexes.size == 0) {
+				return;
+			}
+			if (indexes.size == 1) {
+				var reply = yield this.execute_tool(tool_calls.get(indexes.get(0)));
+				results.set(indexes.get(0), reply);
+				return;
+			}
+			GLib.debug("Agent.execute_parallel: running %d tool calls (limit %d)",
+				indexes.size, this.max_parallel_tools);
 			
-			foreach (var tool_call in tool_calls) {
-				GLib.debug("Executing tool '%s' (id='%s')",
-					tool_call.function.name, tool_call.id);
-				
-				// Get tool from chat_call.tools (tools defaults to empty HashMap, never null)
-				if (!this.chat_call.tools.has_key(tool_call.function.name)) {
-					var available_tools_str = "";
-					if (this.chat_call.tools.size > 0) {
-						available_tools_str = "'" + string.joinv("', '", this.chat_call.tools.keys.to_array()) + "'";
-					}
-					
-					var err_message = "ERROR: You requested a tool called '" + tool_call.function.name + 
-						" ', however we only have these tools: " + available_tools_str;
-					
-					var error_msg = new Message("ui", err_message);
-					this.handle_tool_message(error_msg);
-					reply_messages.add(new Message.tool_call_invalid(tool_call, err_message));
-					continue; // Continue to next tool call
+			var limit = int.max(1, this.max_parallel_tools);
+			var running = 0;
+			var next = 0;
+			GLib.SourceFunc? resume = null;
+			
+			while (next < indexes.size || running > 0) {
+				while (running < limit && next < indexes.size) {
+					var idx = indexes.get(next++);
+					running++;
+					this.execute_tool.begin(tool_calls.get(idx), (o, res) => {
+						results.set(idx, this.execute_tool.end(res));
+						running--;
+						if (resume == null) {
+							return;
+						}
+						var cb = (owned) resume;
+						resume = null;
+						GLib.Idle.add((owned) cb);
+					});
+				}
+				resume = execute_parallel.callback;
+				yield;
+			}
+		}
+		
+		/**
+		 * Executes a single tool call.
+		 * 
+		 * Never throws; failures become tool_call_invalid / tool_call_fail
+		 * messages so the model sees them in the reply.
+		 * 
+		 * @param tool_call The tool call to execute
+		 * @return The tool reply message for this call
+		 */
+		protected virtual async Message execute_tool(Response.ToolCall tool_call)
+		{
+			GLib.debug("Executing tool '%s' (id='%s')",
+				tool_call.function.name, tool_call.id);
+			
+			// Get tool from chat_call.tools (tools defaults to empty HashMap, never null)
+			if (!this.chat_call.tools.has_key(tool_call.function.name)) {
+				var available_tools_str = "";
+				if (this.chat_call.tools.size > 0) {
+					available_tools_str = "'" + string.joinv("', '", this.chat_call.tools.keys.to_array()) + "'";
 				}
 				
-				var tool = this.chat_call.tools.get(tool_call.function.name);
+				var err_message = "ERROR: You requested a tool called '" + tool_call.function.name + 
+					" ', however we only have these tools: " + available_tools_str;
 				
-				try {
+				var error_msg = new Message("ui", err_message);
+				this.handle_tool_message(error_msg);
+				return new Message.tool_call_invalid(tool_call, err_message);
+			}
+			
+			var tool = this.chat_call.tools.get(tool_call.function.name);
+			
+			try {
+				// Use the result of a call started while the reply streamed, if any
+				string? result = null;
+				var prefetch = this.take_prefetch(tool_call);
+				if (prefetch != null) {
+					result = yield prefetch.result();
+				}
+				if (result == null) {
 					// Execute the tool - tool.execute() will set request.agent = chat_call.agent
-					var result = yield tool.execute(this.chat_call, tool_call);
-					
-					// Log result summary (truncate if too long)
-					var result_summary = result.length > 100 ? result.substring(0, 100) + "..." : result;
-					
-					// Check if result is an error and display it in UI
-					if (result.has_prefix("ERROR:")) {
-						GLib.debug("Tool '%s' returned error result: %s",
-							tool_call.function.name, result);
-						var error_msg = new Message("ui", result);
-						this.handle_tool_message(error_msg);
-					} else {
-						GLib.debug("Tool '%s' executed successfully, result length: %zu, preview: %s",
-							tool_call.function.name, result.length, result_summary);
-					}
-					
-					// Create tool reply message
-					var tool_reply = new Message.tool_reply(
-						tool_call.id, 
-						tool_call.function.name,
-						result
-					);
-					GLib.debug("Created tool reply message: role='%s', tool_call_id='%s', name='%s', content length=%zu",
-						tool_reply.role, tool_reply.tool_call_id, tool_reply.name, tool_reply.content.length);
-					reply_messages.add(tool_reply);
-				} catch (Error e) {
-					GLib.debug("Error executing tool '%s' (id='%s'): %s", 
-						tool_call.function.name, tool_call.id, e.message);
-					var error_msg = new Message("ui", "Error executing tool '" + tool_call.function.name + "': " + e.message);
+					result = yield tool.execute(this.chat_call, tool_call);
+				}
+				
+				// Log result summary (truncate if too long)
+				var result_summary = result.length > 100 ? result.substring(0, 100) + "..." : result;
+				
+				// Check if result is an error and display it in UI
+				if (result.has_prefix("ERROR:")) {
+					GLib.debug("Tool '%s' returned error result: %s",
+						tool_call.function.name, result);
+					var error_msg = new Message("ui", result);
 					this.handle_tool_message(error_msg);
-					reply_messages.add(new Message.tool_call_fail(tool_call, e));
-					continue; // Continue to next tool call
+				} else {
+					GLib.debug("Tool '%s' executed successfully, result length: %zu, preview: %s",
+						tool_call.function.name, result.length, result_summary);
 				}
+				
+				// Create tool reply message
+				var tool_reply = new Message.tool_reply(
+					tool_call.id, 
+					tool_call.function.name,
+					result
+				);
+				GLib.debug("Created tool reply message: role='%s', tool_call_id='%s', name='%s', content length=%zu",
+					tool_reply.role, tool_reply.tool_call_id, tool_reply.name, tool_reply.content.length);
+				return tool_reply;
+			} catch (Error e) {
+				GLib.debug("Error executing tool '%s' (id='%s'): %s", 
+					tool_call.function.name, tool_call.id, e.message);
+				var error_msg = new Message("ui", "Error executing tool '" + tool_call.function.name + "': " + e.message);
+				this.handle_tool_message(error_msg);
+				return new Message.tool_call_fail(tool_call, e);
 			}
-
-			return reply_messages;
 		}
 		
 		/**
@@ -301,17 +560,29 @@ namespace OLLMchat.Agent
 		/**
 		 * Set chat_call.model from session; customize if model_obj is set. On customize failure,
 		 * add ui-warning message and use default model. Override in subclasses (e.g. Skill Runner).
+		 *
+		 * The context window asks the server for the model's context first; when it
+		 * has to choose one ({@link ContextWindow.pinned_num_ctx}) that value is baked
+		 * into the customized model, so the server runs with the size history is packed to.
 		 */
 		public virtual async void fill_model()
 		{
+			this.context_window.usage = this.session.model_usage;
 			if (this.session.model_usage.model_obj == null) {
 				this.chat_call.model = this.session.model_usage.model;
 				return;
 			}
+			yield this.context_window.probe(this.session.model_usage.model);
+			var options = this.chat_call.options;
+			var pinned = this.context_window.pinned_num_ctx;
+			if (pinned > 0 && options.num_ctx <= 0) {
+				options = options.clone();
+				options.num_ctx = pinned;
+			}
 			try {
 				var customized_model_name = yield this.session.model_usage.model_obj.customize(
 					this.connection,
-					this.chat_call.options
+					options
 				);
 				this.chat_call.model = customized_model_name;
 			} catch (Error e) {
@@ -444,6 +715,7 @@ namespace OLLMchat.Agent
 		public void replace_chat(Call.ChatBase new_chat)
 		{
 			this.chat_call = new_chat;
+			this.chat_call.context_window = this.context_window;
 		}
 		
 		/**
@@ -467,6 +739,7 @@ namespace OLLMchat.Agent
 			// Note: message_failed not needed - errors propagate as exceptions
 			
 			GLib.debug("Agent.register_tool_monitoring: Registered request '%d' for monitoring", request_id);
+			this.tool_registered(request);
 		}
 		
 		/**
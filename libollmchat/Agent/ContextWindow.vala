@@ -0,0 +1,548 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+namespace OLLMchat.Agent
+{
+	/**
+	 * Token budget for the message history sent on one agent's chat call.
+	 *
+	 * Counts tokens per message and caches the counts by content hash, so
+	 * a long session only tokenizes each message once. Counts are exact
+	 * when the model is a local GGUF (vocab-only load of the model file);
+	 * otherwise they are estimated from a characters-per-token ratio that
+	 * {@link observe} calibrates against the server's prompt token count.
+	 *
+	 * {@link pack} is applied by {@link Call.ChatBase} when it serializes
+	 * the request: leading system messages and the newest turn are always
+	 * kept, older turns are dropped oldest first once the budget is
+	 * exceeded (in steps, see {@link drop_headroom}, so the start of the
+	 * prompt stays the same for several turns and the server can reuse its
+	 * KV cache), and oversized tool results are cut to head and tail. That
+	 * keeps the request under ''num_ctx'' instead of letting the server
+	 * truncate (and re-prefill) on its own. The context size is never a
+	 * silent guess: it is set in the options, reported by the server
+	 * ({@link probe}), or chosen here and sent with the request
+	 * ({@link pinned_num_ctx}).
+	 *
+	 * When a response shows the prompt above {@link summarize_ratio} of the
+	 * budget, or pack had to drop turns, {@link summarize_wanted} is emitted
+	 * so the agent can fold history in the background (Chatter schedules its
+	 * summarizer) before anything more has to be dropped.
+	 */
+	public class ContextWindow : Object
+	{
+		/**
+		 * Context chosen for an Ollama (or local llama) model when neither
+		 * the options, the model's parameters nor the server give one; it
+		 * is then sent with the request ({@link pinned_num_ctx}). Set
+		 * ''num_ctx'' in the model options to use a larger context.
+		 */
+		public const int DEFAULT_NUM_CTX = 4096;
+
+		/**
+		 * Context the server reports for the loaded model (Ollama
+		 * ''/api/ps''), 0 when unknown; see {@link probe}.
+		 */
+		public int server_num_ctx { get; set; default = 0; }
+
+		/**
+		 * Model usage supplying ''num_ctx'' / context length; refreshed by
+		 * {@link Base.fill_model}.
+		 */
+		public Settings.ModelUsage? usage { get; set; default = null; }
+
+		/**
+		 * Connection of the chat call; a non-HTTP URL is a local GGUF
+		 * directory whose model file provides the tokenizer.
+		 */
+		public Settings.Connection? connection { get; set; default = null; }
+
+		/** Tokens kept free for the reply when num_predict is not set. */
+		public int reserve_tokens { get; set; default = 1024; }
+
+		/** Prompt fill (0..1 of {@link budget}) that triggers {@link summarize_wanted}. */
+		public double summarize_ratio { get; set; default = 0.75; }
+
+		/**
+		 * Share of the budget left free when {@link pack} has to drop turns.
+		 * Later packs keep starting at the same message while it fits, so
+		 * the prompt prefix moves once per this much growth instead of on
+		 * every turn.
+		 */
+		public double drop_headroom { get; set; default = 0.25; }
+
+		/**
+		 * Largest tool result sent whole, in tokens; 0 means a quarter of
+		 * the budget (no limit when the context size is unknown).
+		 */
+		public int tool_result_max { get; set; default = 0; }
+
+		/** Estimated characters per token; calibrated by {@link observe}. */
+		public double chars_per_token { get; private set; default = 4.0; }
+
+		/** Prompt tokens reported by the server for the last response. */
+		public int last_prompt_tokens { get; private set; default = 0; }
+
+		/**
+		 * Set once the prompt crossed {@link summarize_ratio} or pack had to
+		 * drop turns; cleared by the agent when a new summary is in place.
+		 */
+		public bool summary_due { get; set; default = false; }
+
+		/**
+		 * Emitted when the history is approaching the budget.
+		 *
+		 * @param used prompt tokens of the last request
+		 * @param budget tokens available for the prompt
+		 */
+		public signal void summarize_wanted(int used, int budget);
+
+		/* content hash → token count; exact counts only when vocab is loaded */
+		private Gee.HashMap<string, int> counts = new Gee.HashMap<string, int>();
+		private Llama.Model? vocab_model = null;
+		private string vocab_path = "";
+		private int tools_tokens = 0;
+		private string tools_hash = "";
+		/* model name server_num_ctx was probed for */
+		private string probed_model = "";
+		/* last packed request, for observe() */
+		private Gee.ArrayList<Message> last_sent = new Gee.ArrayList<Message>();
+		private Json.Node? last_tools = null;
+		/* first history message kept by the last pack that dropped turns */
+		private Message? kept_from = null;
+
+		public ContextWindow(Settings.ModelUsage? usage, Settings.Connection? connection)
+		{
+			this.usage = usage;
+			this.connection = connection;
+		}
+
+		/**
+		 * Context size the server actually runs the model with, in tokens,
+		 * or 0 when unknown.
+		 *
+		 * options.num_ctx, else the model's own ''num_ctx'' parameter, else
+		 * {@link server_num_ctx}. Otherwise an Ollama or local connection
+		 * uses {@link pinned_num_ctx}, which the request carries; other
+		 * servers (and no connection) use context_length as served.
+		 */
+		public int num_ctx {
+			get {
+				if (this.usage == null) {
+					return 0;
+				}
+				if (this.usage.options.num_ctx > 0) {
+					return this.usage.options.num_ctx;
+				}
+				var model = this.usage.model_obj;
+				if (model != null && model.options.num_ctx > 0) {
+					return model.options.num_ctx;
+				}
+				if (this.server_num_ctx > 0) {
+					return this.server_num_ctx;
+				}
+				var pinned = this.pinned_num_ctx;
+				if (pinned > 0) {
+					return pinned;
+				}
+				return model != null ? model.context_length : 0;
+			}
+		}
+
+		/**
+		 * Context size chosen here that the request must send so the
+		 * server runs with it, or 0 when the options, the model or the
+		 * server already decide it (or the server is not Ollama / local).
+		 *
+		 * {@link DEFAULT_NUM_CTX}, capped at the model's trained
+		 * context_length.
+		 */
+		public int pinned_num_ctx {
+			get {
+				if (this.usage == null || this.usage.options.num_ctx > 0
+						|| this.server_num_ctx > 0) {
+					return 0;
+				}
+				var model = this.usage.model_obj;
+				if (model != null && model.options.num_ctx > 0) {
+					return 0;
+				}
+				if (this.connection == null || (this.connection.url.has_prefix("http")
+						&& this.connection.ollama_native == 0)) {
+					return 0;
+				}
+				var trained = model != null ? model.context_length : 0;
+				return trained > 0 ? int.min(trained, DEFAULT_NUM_CTX) : DEFAULT_NUM_CTX;
+			}
+		}
+
+		/**
+		 * Ask an Ollama server which context it runs model with (''/api/ps''
+		 * reports it for loaded models) and keep it in {@link server_num_ctx}.
+		 *
+		 * Asked once per model name; nothing is asked when the options or
+		 * the model's parameters set ''num_ctx''. A model that is not loaded
+		 * (or a server that does not report it) leaves
+		 * {@link pinned_num_ctx} to be sent instead.
+		 *
+		 * @param model name the request will use
+		 */
+		public async void probe(string model)
+		{
+			if (this.probed_model == model) {
+				return;
+			}
+			this.probed_model = model;
+			this.server_num_ctx = 0;
+			if (this.usage == null || this.usage.options.num_ctx > 0
+					|| this.connection == null || this.connection.ollama_native != 1) {
+				return;
+			}
+			if (this.usage.model_obj != null && this.usage.model_obj.options.num_ctx > 0) {
+				return;
+			}
+			try {
+				var running = yield new Call.Ps(this.connection).exec_models();
+				foreach (var m in running) {
+					if (m.name == model && m.context_length > 0) {
+						this.server_num_ctx = m.context_length;
+						return;
+					}
+				}
+			} catch (GLib.Error e) {
+				GLib.debug("ContextWindow.probe: %s", e.message);
+			}
+		}
+
+		/**
+		 * Tokens available for the prompt (context minus reply reserve),
+		 * or 0 when the context size is unknown.
+		 */
+		public int budget {
+			get {
+				var ctx = this.num_ctx;
+				if (ctx <= 0) {
+					return 0;
+				}
+				var reserve = this.usage.options.num_predict > 0
+					? this.usage.options.num_predict : this.reserve_tokens;
+				return int.max(ctx / 4, ctx - reserve);
+			}
+		}
+
+		/**
+		 * Token count of a piece of text.
+		 */
+		public int count_text(string text)
+		{
+			if (text == "") {
+				return 0;
+			}
+			unowned Llama.Vocab? vocab = this.vocab();
+			if (vocab != null) {
+				return vocab.tokenize(text, false, true).length;
+			}
+			return (int)(text.length / this.chars_per_token) + 1;
+		}
+
+		/**
+		 * Token count of one message including role framing; exact counts
+		 * are cached by content hash.
+		 */
+		public int count(Message msg)
+		{
+			var text = this.message_text(msg);
+			if (this.vocab() == null) {
+				return 4 + this.count_text(text);
+			}
+			var key = GLib.Checksum.compute_for_string(GLib.ChecksumType.MD5, text);
+			if (this.counts.has_key(key)) {
+				return this.counts.get(key);
+			}
+			var ret = 4 + this.count_text(text);
+			this.counts.set(key, ret);
+			return ret;
+		}
+
+		/**
+		 * Sum of {@link count} over a message list.
+		 */
+		public int total(Gee.List<Message> messages)
+		{
+			var ret = 0;
+			foreach (var msg in messages) {
+				ret += this.count(msg);
+			}
+			return ret;
+		}
+
+		/**
+		 * Messages to send for this request, fitted to the budget.
+		 *
+		 * Does not modify the input list or its messages; truncated tool
+		 * results are new {@link Message} objects.
+		 *
+		 * @param messages full history for the call
+		 * @param tools request tools array (counted against the budget), or null
+		 * @return list to serialize
+		 */
+		public Gee.ArrayList<Message> pack(Gee.ArrayList<Message> messages, Json.Node? tools = null)
+		{
+			var ret = new Gee.ArrayList<Message>();
+			this.last_sent = ret;
+			this.last_tools = tools;
+			var budget = this.budget;
+			var tool_max = this.tool_result_max > 0 ? this.tool_result_max
+				: (budget > 0 ? budget / 4 : 0);
+
+			var head = 0;
+			while (head < messages.size && messages.get(head).role == "system") {
+				ret.add(messages.get(head));
+				head++;
+			}
+
+			// Turns: a message plus the tool results that follow it, so an
+			// assistant tool call is never sent without its replies.
+			var groups = new Gee.ArrayList<Gee.ArrayList<Message>>();
+			for (var i = head; i < messages.size; i++) {
+				var msg = messages.get(i);
+				if (msg.role == "tool" && tool_max > 0 && this.count(msg) > tool_max) {
+					msg = this.truncate(msg, tool_max);
+				}
+				if (msg.role != "tool" || groups.size == 0) {
+					groups.add(new Gee.ArrayList<Message>());
+				}
+				groups.get(groups.size - 1).add(msg);
+			}
+			if (budget <= 0 || groups.size == 0) {
+				foreach (var group in groups) {
+					ret.add_all(group);
+				}
+				return ret;
+			}
+
+			var fixed = this.total(ret) + this.count_tools(tools);
+			var first = this.stable_first(groups, fixed, budget);
+			if (first < 0) {
+				// Drop down to budget less drop_headroom, so the next turns
+				// can keep this start (and the cached prefix) as they grow.
+				var target = (int) (budget * (1.0 - this.drop_headroom));
+				first = this.first_fitting(groups, fixed, budget);
+				if (first > 0) {
+					var used = fixed;
+					for (var i = first; i < groups.size; i++) {
+						used += this.total(groups.get(i));
+					}
+					while (used > target && first < groups.size - 1) {
+						used -= this.total(groups.get(first));
+						first++;
+					}
+				}
+				// Start the kept history on a user message when one is available.
+				while (first > 0 && first < groups.size - 1
+					&& groups.get(first).get(0).role != "user") {
+					first++;
+				}
+				this.kept_from = first > 0 ? groups.get(first).get(0) : null;
+			}
+			if (first > 0) {
+				GLib.debug("ContextWindow.pack: dropped %d of %d turns (budget %d)",
+					first, groups.size, budget);
+				this.summary_due = true;
+			}
+			for (var i = first; i < groups.size; i++) {
+				ret.add_all(groups.get(i));
+			}
+			return ret;
+		}
+
+		/**
+		 * Index of the group starting with the message the last dropping
+		 * pack started at, when everything from there still fits; -1 when
+		 * there is none (first drop, after a summary, or it grew too big).
+		 */
+		private int stable_first(Gee.ArrayList<Gee.ArrayList<Message>> groups, int fixed, int budget)
+		{
+			if (this.kept_from == null) {
+				return -1;
+			}
+			for (var i = 0; i < groups.size; i++) {
+				if (groups.get(i).get(0) != this.kept_from) {
+					continue;
+				}
+				var used = fixed;
+				for (var j = i; j < groups.size; j++) {
+					used += this.total(groups.get(j));
+				}
+				return used <= budget ? i : -1;
+			}
+			return -1;
+		}
+
+		/**
+		 * Oldest group from which the history fits the budget; the newest
+		 * group is always kept.
+		 */
+		private int first_fitting(Gee.ArrayList<Gee.ArrayList<Message>> groups, int fixed, int budget)
+		{
+			var first = groups.size - 1;
+			var used = fixed + this.total(groups.get(first));
+			while (first > 0) {
+				var cost = this.total(groups.get(first - 1));
+				if (used + cost > budget) {
+					break;
+				}
+				used += cost;
+				first--;
+			}
+			return first;
+		}
+
+		/**
+		 * Calibrate from a finished response and raise
+		 * {@link summarize_wanted} while {@link summary_due} (the prompt is
+		 * near the budget, or the last pack dropped turns).
+		 *
+		 * @param response completed response with prompt token usage
+		 */
+		public void observe(Response.Chat response)
+		{
+			var prompt = response.prompt_eval_count;
+			if (prompt <= 0) {
+				return;
+			}
+			this.last_prompt_tokens = prompt;
+			if (this.vocab() == null) {
+				var chars = 0;
+				foreach (var msg in this.last_sent) {
+					chars += this.message_text(msg).length;
+				}
+				if (this.last_tools != null) {
+					chars += Json.to_string(this.last_tools, false).length;
+				}
+				// Ollama may count only the uncached part; ignore implausible samples.
+				var sample = (double)chars / prompt;
+				if (sample >= 1.5 && sample <= 8.0) {
+					this.chars_per_token = (this.chars_per_token + sample) / 2.0;
+				}
+			}
+			var budget = this.budget;
+			if (budget > 0 && prompt >= budget * this.summarize_ratio) {
+				this.summary_due = true;
+			}
+			if (this.summary_due) {
+				this.summarize_wanted(prompt, budget);
+			}
+		}
+
+		/**
+		 * Text that the chat template renders for a message (content,
+		 * tool name and tool call arguments).
+		 */
+		private string message_text(Message msg)
+		{
+			var ret = msg.role + "\n" + msg.content;
+			if (msg.name != "") {
+				ret += "\n" + msg.name;
+			}
+			foreach (var tool_call in msg.tool_calls) {
+				var args_node = new Json.Node(Json.NodeType.OBJECT);
+				args_node.set_object(tool_call.function.arguments);
+				ret += "\n" + tool_call.function.name + Json.to_string(args_node, false);
+			}
+			return ret;
+		}
+
+		private int count_tools(Json.Node? tools)
+		{
+			if (tools == null) {
+				return 0;
+			}
+			var json = Json.to_string(tools, false);
+			var key = GLib.Checksum.compute_for_string(GLib.ChecksumType.MD5, json);
+			if (key != this.tools_hash) {
+				this.tools_hash = key;
+				this.tools_tokens = this.count_text(json);
+			}
+			return this.tools_tokens;
+		}
+
+		/**
+		 * Copy of a tool result cut to its first and last lines, with a
+		 * marker saying how much was left out.
+		 */
+		private Message truncate(Message msg, int max_tokens)
+		{
+			var keep = (int)(max_tokens / 2 * this.chars_per_token);
+			var content = msg.content;
+			if (content.length <= keep * 2) {
+				return msg;
+			}
+			var head_end = content.substring(0, keep).last_index_of_char('\n');
+			if (head_end < keep / 2) {
+				head_end = keep;
+			}
+			var tail_start = content.index_of_char('\n', content.length - keep);
+			if (tail_start < 0 || tail_start > content.length - keep / 2) {
+				tail_start = content.length - keep;
+			}
+			// Keep cuts off UTF-8 continuation bytes.
+			while (head_end > 0 && ((uchar)content[head_end] & 0xC0) == 0x80) {
+				head_end--;
+			}
+			while (tail_start < content.length && ((uchar)content[tail_start] & 0xC0) == 0x80) {
+				tail_start++;
+			}
+			var omitted = this.count_text(content.substring(head_end, tail_start - head_end));
+			var ret = new Message.tool_reply(msg.tool_call_id, msg.name,
+				content.substring(0, head_end)
+				+ "\n\n[... " + omitted.to_string() + " tokens of tool output omitted ...]\n\n"
+				+ content.substring(tail_start));
+			return ret;
+		}
+
+		/**
+		 * Vocabulary of the local GGUF model, loaded vocab-only on first
+		 * use; null for remote connections.
+		 */
+		private unowned Llama.Vocab? vocab()
+		{
+			if (this.connection == null || this.usage == null
+				|| this.connection.url.has_prefix("http")) {
+				return null;
+			}
+			var path = GLib.Path.build_filename(
+				this.connection.url, this.usage.model, "model.gguf");
+			if (path != this.vocab_path) {
+				this.vocab_path = path;
+				this.vocab_model = null;
+				this.counts.clear();
+				if (GLib.FileUtils.test(path, GLib.FileTest.IS_REGULAR)) {
+					GGUF.init();
+					var params = Llama.ModelParams();
+					params.vocab_only = true;
+					this.vocab_model = new Llama.Model.from_file(path, params);
+				}
+			}
+			if (this.vocab_model == null) {
+				return null;
+			}
+			return this.vocab_model.get_vocab();
+		}
+	}
+}
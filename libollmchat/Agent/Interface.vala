@@ -101,6 +101,20 @@ namespace OLLMchat.Agent
 		{
 			// Default: no-op for non-agentic usage
 		}
+		
+		/**
+		 * Whether tool requests run through this interface are speculative
+		 * (started before the model finished asking for them).
+		 * 
+		 * Speculative requests never show permission prompts; see
+		 * {@link Tool.RequestBase.deferred}.
+		 * 
+		 * @return false by default; true for {@link Prefetch}
+		 */
+		public virtual bool is_speculative()
+		{
+			return false;
+		}
 	}
 }
 
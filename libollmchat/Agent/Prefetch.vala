@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+namespace OLLMchat.Agent
+{
+	/**
+	 * A tool call started while the reply that requests it is still
+	 * streaming.
+	 *
+	 * Created by {@link Base.prefetch_tool_calls} for tools flagged
+	 * {@link Tool.BaseTool.prefetch_safe} as soon as a complete call shows
+	 * up in the stream. The request runs against this object instead of
+	 * the agent, so its UI messages are held back until the turn finishes
+	 * and the call is confirmed; {@link Base.execute_tool} then takes the
+	 * result with {@link result} instead of running the tool again. A
+	 * prefetch whose call is not in the final reply is dropped with
+	 * {@link discard}, together with its held messages.
+	 *
+	 * Permission prompts are never shown from here: a request that would
+	 * need one is deferred ({@link Tool.RequestBase.deferred}) and the
+	 * real call runs normally.
+	 */
+	public class Prefetch : Object, Interface
+	{
+		/** Agent the confirmed result and held messages go to. */
+		public Base agent { get; construct; }
+
+		/** The streamed call this prefetch was started for. */
+		public Response.ToolCall tool_call { get; construct; }
+
+		/** Tool name plus canonical arguments; see {@link signature_for}. */
+		public string signature { get; private set; default = ""; }
+
+		/** Set once the tool has returned. */
+		public bool finished { get; private set; default = false; }
+
+		private string result_text = "";
+		private Tool.RequestBase? request = null;
+		private bool discarded = false;
+		private Gee.ArrayList<Message> held = new Gee.ArrayList<Message>();
+		private GLib.SourceFunc? resume = null;
+
+		public Prefetch(Base agent, Response.ToolCall tool_call)
+		{
+			Object(agent: agent, tool_call: tool_call);
+			this.signature = signature_for(tool_call);
+		}
+
+		/**
+		 * Identity of a call for matching a prefetch to the final reply:
+		 * tool name and canonical (sorted-key) arguments.
+		 */
+		public static string signature_for(Response.ToolCall tool_call)
+		{
+			var args_node = new Json.Node(Json.NodeType.OBJECT);
+			args_node.set_object(tool_call.function.arguments);
+			return tool_call.function.name + "\n"
+				+ Json.to_string(Call.ChatBase.canonical_node(args_node), false);
+		}
+
+		/**
+		 * Start running the tool in the background.
+		 */
+		public void start(Tool.BaseTool tool)
+		{
+			GLib.debug("Prefetch: starting '%s' while the reply streams", tool.name);
+			tool.execute_as.begin(this.agent.chat(), this.tool_call, this, (o, res) => {
+				this.result_text = tool.execute_as.end(res);
+				this.finished = true;
+				if (this.resume == null) {
+					return;
+				}
+				var cb = (owned) this.resume;
+				this.resume = null;
+				GLib.Idle.add((owned) cb);
+			});
+		}
+
+		/**
+		 * Wait for the tool and hand over its result.
+		 *
+		 * Held UI messages are passed to the agent first.
+		 *
+		 * @return the tool result, or null when the request was deferred
+		 *         and the call has to be executed normally
+		 */
+		public async string? result()
+		{
+			if (!this.finished) {
+				this.resume = this.result.callback;
+				yield;
+			}
+			if (this.request != null && this.request.deferred) {
+				this.held.clear();
+				return null;
+			}
+			foreach (var msg in this.held) {
+				this.agent.add_message(msg);
+			}
+			this.held.clear();
+			return this.result_text;
+		}
+
+		/**
+		 * Drop the prefetch: the call was not confirmed. Messages the tool
+		 * adds from now on are dropped too.
+		 */
+		public void discard()
+		{
+			GLib.debug("Prefetch: discarding '%s'", this.tool_call.function.name);
+			this.discarded = true;
+			this.held.clear();
+		}
+
+		// Implement Agent.Interface
+		public Call.ChatBase chat()
+		{
+			return this.agent.chat();
+		}
+
+		public ChatPermission.Provider get_permission_provider()
+		{
+			return this.agent.get_permission_provider();
+		}
+
+		public Settings.Config2 config()
+		{
+			return this.agent.config();
+		}
+
+		/**
+		 * Hold the message until the call is confirmed.
+		 */
+		public void add_message(Message message)
+		{
+			if (this.discarded) {
+				return;
+			}
+			this.held.add(message);
+		}
+
+		/**
+		 * Keeps the request to check {@link Tool.RequestBase.deferred};
+		 * prefetched requests are not hooked to the stream.
+		 */
+		public void register_tool_monitoring(int request_id, Tool.RequestBase request)
+		{
+			this.request = request;
+		}
+
+		public bool is_speculative()
+		{
+			return true;
+		}
+	}
+}
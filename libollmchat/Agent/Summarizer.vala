@@ -23,12 +23,13 @@ namespace OLLMchat.Agent
 	 *
 	 * Shared by Chatter and Coding Assistant. Extends {@link Base} so
 	 * {@link Call.ChatCompletions} streams through {@link handle_stream_chunk}
-	 * instead of a manual signal hook. Overrides streaming handlers to persist
-	 * ''summary'' messages rather than ''content-stream'' rows.
+	 * instead of a manual signal hook. Overrides streaming handlers to collect
+	 * the summary text rather than writing ''content-stream'' rows; the
+	 * caller decides when the result is added to the session.
 	 */
 	public class Summarizer : Base
 	{
-		private Message? draft_summary;
+		private string draft_summary = "";
 		private bool waiting_shown;
 		private static GLib.Regex hash_ref_regex;
 
@@ -45,6 +46,10 @@ namespace OLLMchat.Agent
 			base(agent.factory, agent.session);
 			this.chat_call.think = false;
 			this.chat_call.tools.clear();
+			this.chat_call.priority = Call.Priority.BACKGROUND;
+			this.chat_call.response_cache = Call.ResponseCache.shared();
+			// only summaries that pass the hash-link check are cached
+			this.chat_call.defer_cache_store = true;
 		}
 
 		/**
@@ -62,10 +67,11 @@ namespace OLLMchat.Agent
 		}
 
 		/**
-		 * Stream summary text into a ''summary'' transcript message.
+		 * Collect streamed summary text.
 		 *
 		 * Does not call {@link Base.handle_stream_chunk} — the default session
-		 * path creates ''content-stream'' messages.
+		 * path creates ''content-stream'' messages, and a half-written summary
+		 * must never become the active history boundary.
 		 */
 		public override void handle_stream_chunk(
 			string new_text,
@@ -75,67 +81,34 @@ namespace OLLMchat.Agent
 			if (is_thinking) {
 				return;
 			}
-			if (new_text.length == 0 && !response.done) {
-				return;
-			}
-			if (this.draft_summary == null) {
-				this.draft_summary = new Message("summary", new_text);
-				this.session.messages.add(this.draft_summary);
-				this.session.notify_property("display_info");
-			} else if (new_text.length > 0) {
-				this.draft_summary.content += new_text;
-			}
+			this.draft_summary += new_text;
 			if (response.done
 				&& response.message != null
 				&& response.message.content != "") {
-				this.draft_summary.content = response.message.content;
-			}
-			if (response.done && this.draft_summary != null) {
-				this.session.manager.message_added(this.draft_summary, this.session);
+				this.draft_summary = response.message.content;
 			}
 		}
 
 		/**
-		 * Summarize the previous completed turn (not the latest).
+		 * Fold a range of session messages into an updated summary.
 		 *
-		 * Keeps the latest turn raw until a newer turn finishes. Builds
-		 * turn-reference payload, calls the model with tools and thinking
-		 * disabled, streams into a ''summary'' message, and validates hash
-		 * links (one retry on failure).
+		 * Builds the turn-reference payload for ''session.messages[start, end)'',
+		 * calls the model with tools and thinking disabled on top of
+		 * previous_summary, and validates hash links (one retry on failure).
+		 * Does not touch ''session.messages''.
 		 *
+		 * @param start first message index to fold
+		 * @param end index after the last message to fold
+		 * @param previous_summary summary covering everything before start, or ""
 		 * @param cancellable optional cancel token for the summary request
+		 * @return validated summary text, or "" on failure
 		 */
-		public async void run(
+		public async string summarize(
+			int start,
+			int end,
+			string previous_summary,
 			GLib.Cancellable? cancellable = null)
 		{
-			/* Fold the previous completed turn only; keep the latest turn raw. */
-			var last_user_sent = -1;
-			var prev_user_sent = -1;
-			for (var i = this.session.messages.size - 1; i >= 0; i--) {
-				if (this.session.messages.get(i).role != "user-sent") {
-					continue;
-				}
-				if (last_user_sent < 0) {
-					last_user_sent = i;
-					continue;
-				}
-				prev_user_sent = i;
-				break;
-			}
-			if (prev_user_sent < 0) {
-				GLib.debug("summarize skip first turn only last_user_sent=%d", last_user_sent);
-				return;
-			}
-			var user_sent_index = prev_user_sent;
-			var turn_end = last_user_sent;
-
-			var previous_summary = "";
-			foreach (var msg in this.session.messages) {
-				if (msg.role == "summary") {
-					previous_summary = msg.content;
-				}
-			}
-
 			var allowed = new Gee.HashSet<string>();
 			var prev_render = new Markdown.Document.Render();
 			prev_render.parse(previous_summary);
@@ -147,7 +120,7 @@ namespace OLLMchat.Agent
 			}
 
 			var turn_references = "";
-			for (var i = user_sent_index; i < turn_end; i++) {
+			for (var i = start; i < end; i++) {
 				var msg = this.session.messages.get(i);
 				var n = i.to_string();
 				switch (msg.role) {
@@ -204,12 +177,12 @@ namespace OLLMchat.Agent
 			if (usage.connection == ""
 				|| !this.session.manager.config.connections.has_key(usage.connection)) {
 				GLib.debug("summarize early return no connection");
-				return;
+				return "";
 			}
 
 			var validation_issue = "";
 			for (var attempt = 0; attempt < 2; attempt++) {
-				this.draft_summary = null;
+				this.draft_summary = "";
 				this.waiting_shown = false;
 				try {
 					var tpl = new Prompt.Template("chatter_summary.md") {
@@ -234,17 +207,16 @@ namespace OLLMchat.Agent
 					yield this.fill_model();
 					yield this.chat_call.send(messages, cancellable);
 
-					if (this.draft_summary == null
-						|| this.draft_summary.content.strip() == "") {
+					if (this.draft_summary.strip() == "") {
 						GLib.debug("summarize after send empty draft attempt=%d",
 							attempt);
-						return;
+						return "";
 					}
 					GLib.debug("summarize after send draft_len=%u attempt=%d",
-						this.draft_summary.content.length, attempt);
+						this.draft_summary.length, attempt);
 
 					var sum_render = new Markdown.Document.Render();
-					sum_render.parse(this.draft_summary.content);
+					sum_render.parse(this.draft_summary);
 					var issue = "";
 					foreach (var link in sum_render.document.links) {
 						if (link.path != "") {
@@ -266,19 +238,18 @@ namespace OLLMchat.Agent
 
 					if (issue == "") {
 						GLib.debug("summarize validation ok");
-						this.session.save_async.begin();
-						return;
+						this.chat_call.commit_cached();
+						return this.draft_summary;
 					}
 
 					GLib.debug("summarize validation fail: %s", issue);
-					this.session.messages.remove(this.draft_summary);
-					this.draft_summary = null;
 					validation_issue = issue;
 				} catch (GLib.Error e) {
 					GLib.warning("Summarization failed: %s", e.message);
-					return;
+					return "";
 				}
 			}
+			return "";
 		}
 	}
 }
@@ -35,6 +35,13 @@ namespace OLLMchat.Call
 		/** If true, base URL has /api stripped so the request goes to host/v1/... (OpenAI-compatible). */
 		protected bool is_openai = false;
 		public GLib.Cancellable? cancellable { get; set; default = null; }
+		/** Scheduling class on the connection's {@link Scheduler}. */
+		public Priority priority { get; set; default = Priority.INTERACTIVE; }
+		/**
+		 * Opt-in cache for deterministic requests; a byte-identical request
+		 * is answered from it without contacting the server.
+		 */
+		public ResponseCache? response_cache { get; set; default = null; }
 		/** Set by subclasses before streaming; never null when handle_streaming_response runs. */
 		public Response.Base streaming_response { get; set; }
 
@@ -103,7 +110,7 @@ namespace OLLMchat.Call
 
 			GLib.debug("Request URL: %s", url);
 
-			var bytes = yield this.connection.soup.send_and_read_async(message, GLib.Priority.DEFAULT, null);
+			var bytes = yield this.send_scheduled(message);
 
 			if (message.status_code != 200) {
 				if (message.status_code == 400 && bytes != null && bytes.get_size() > 0) {
@@ -115,6 +122,42 @@ namespace OLLMchat.Call
 			return bytes;
 		}
 
+		/**
+		 * Send a non-streaming request through the connection's scheduler.
+		 *
+		 * Background requests are preemptible: when an interactive request
+		 * needs the slot the send is cancelled and queued again.
+		 */
+		private async Bytes send_scheduled(Soup.Message message) throws Error
+		{
+			var scheduler = this.connection.scheduler;
+			while (true) {
+				var ticket = yield scheduler.acquire(this.priority, this.cancellable,
+					this.priority == Priority.BACKGROUND);
+				try {
+					return yield this.connection.soup.send_and_read_async(
+						message, GLib.Priority.DEFAULT, ticket.cancellable);
+				} catch (GLib.IOError e) {
+					if (!ticket.preempted
+						|| (this.cancellable != null && this.cancellable.is_cancelled())) {
+						throw e;
+					}
+					GLib.debug("Request preempted, requeueing: %s", message.uri.to_string());
+				} finally {
+					scheduler.release(ticket);
+				}
+			}
+		}
+
+		/**
+		 * Digest of model as last listed on the connection, or "" when unknown.
+		 */
+		protected string model_digest(string model)
+		{
+			var info = this.connection.models.get(model);
+			return info == null ? "" : info.digest;
+		}
+
 		protected virtual string get_request_body()
 		{
 			var json_node = Json.gobject_serialize(this);
@@ -130,6 +173,8 @@ namespace OLLMchat.Call
 				case "connection":
 				case "cancellable":
 				case "streaming-response":
+				case "priority":
+				case "response-cache":
 					// Exclude these properties from serialization
 					return null;
 				default:
@@ -251,6 +296,24 @@ namespace OLLMchat.Call
 			// Soup is initialized when Connection is created, never null
 			// Timeout is already set on soup (via connection.timeout property)
 			
+			// Streams hold their slot until done; they are never preempted.
+			Scheduler.Ticket ticket;
+			try {
+				ticket = yield this.connection.scheduler.acquire(this.priority, this.cancellable);
+			} catch (GLib.IOError e) {
+				// User cancelled while queued - mark done
+				this.streaming_response.done = true;
+				return;
+			}
+			try {
+				yield this.stream_response(message);
+			} finally {
+				this.connection.scheduler.release(ticket);
+			}
+		}
+
+		private async void stream_response(Soup.Message message) throws Error
+		{
 			InputStream? input_stream = null;
 			try {
 				input_stream = yield this.connection.soup.send_async(
@@ -160,6 +160,10 @@ namespace OLLMchat.Call
 				case "cancellable":
 				case "format-obj":
 				case "agent":
+				case "context-window":
+				case "defer-cache-store":
+				case "priority":
+				case "response-cache":
 					// Exclude runtime/request-internal properties (connection, agent have non-JSON types).
 					// format is serialized explicitly in the "format" case; format-obj is the raw property.
 					return null;
@@ -173,28 +177,7 @@ namespace OLLMchat.Call
 				
 				case "tools":
 					// Only serialize tools if present (model capability is validated when chat is set up)
-					if (this.tools.size == 0) {
-						return null;
-					}
-					var tools_node = new Json.Node(Json.NodeType.ARRAY);
-					tools_node.init_array(new Json.Array());
-					var tools_array = tools_node.get_array();
-					foreach (var entry in this.tools.entries) {
-						var tool = entry.value;
-						if (!tool.active) {
-							continue;
-						}
-						var tool_node = Json.gobject_serialize(tool);
-						var tool_obj = tool_node.get_object();
-						// Use map key as tool name so wrapped aliases (e.g. Grep, ls) are sent correctly
-						var func_node = tool_obj.get_member("function");
-						if (func_node != null && func_node.get_node_type() == Json.NodeType.OBJECT) {
-							func_node.get_object().set_string_member("name", entry.key);
-						}
-						tool_obj.set_string_member("type", tool.tool_type);
-						tools_array.add_element(tool_node);
-					}
-					return tools_node;
+					return this.tools_node();
 				
 				case "format":
 					// If format_obj is set, serialize it instead of the string format
@@ -210,11 +193,18 @@ namespace OLLMchat.Call
 					return default_serialize_property(property_name, value, pspec);
 				
 				case "options":
+					// Send the context size the history is packed to when nothing else sets it
+					var send_options = this.options;
+					var pinned = this.context_window != null ? this.context_window.pinned_num_ctx : 0;
+					if (pinned > 0 && send_options.num_ctx <= 0) {
+						send_options = send_options.clone();
+						send_options.num_ctx = pinned;
+					}
 					// Only serialize options if they have valid values
-					if (!this.options.has_values()) {
+					if (!send_options.has_values()) {
 						return null;
 					}
-					var options_node = Json.gobject_serialize(this.options);
+					var options_node = Json.gobject_serialize(send_options);
 					var obj = options_node.get_object();
 					// Build request options: rename hyphens to underscores
 					var new_obj = new Json.Object();
@@ -231,7 +221,7 @@ namespace OLLMchat.Call
 					var node = new Json.Node(Json.NodeType.ARRAY);
 					node.init_array(new Json.Array());
 					var array = node.get_array();
-					foreach (var m in this.messages) {
+					foreach (var m in this.outbound_messages()) {
 						var msg_node = Json.gobject_serialize(m);
 						m.serialize_images(msg_node.get_object());
 						array.add_element(msg_node);
@@ -314,7 +304,12 @@ namespace OLLMchat.Call
 		private async Response.Chat execute_non_streaming() throws Error
 		{
 			// chat_send signal emission removed - callers handle state directly after calling send()
-			GLib.debug("%s", this.get_request_body());
+			var request_body = this.get_request_body();
+			GLib.debug("%s", request_body);
+			var cached = (Response.Chat) this.streaming_response;
+			if (this.replay_cached(request_body, cached, false)) {
+				return cached;
+			}
 			var bytes = yield this.send_request(true);
 			var root = this.parse_response(bytes);
 
@@ -332,6 +327,7 @@ namespace OLLMchat.Call
 			// Note: client no longer set on response objects
 			response_obj.call = this;
 			response_obj.done = true; // Non-streaming responses are always done
+			this.store_cached(response_obj);
 			
 			// Check for tool calls and handle them recursively
 			if (response_obj.message.tool_calls.size > 0) {
@@ -349,6 +345,10 @@ namespace OLLMchat.Call
 
 			var url = this.build_url();
 			var request_body = this.get_request_body();
+			if (this.replay_cached(request_body, response, true)) {
+				return response;
+			}
+			this.track_prompt_prefix(request_body, response);
 			var message = this.connection.soup_message(this.http_method, url, request_body);
 
 			GLib.debug("%s", url);
@@ -367,6 +367,7 @@ namespace OLLMchat.Call
 				response.done = true;
 				throw e;
 			}
+			this.store_cached(response);
 
 		// Check for tool calls and handle them recursively
 			//GLib.debug("Chat.execute_streaming: done=%s, tool_calls.size=%d, content='%s'", 
@@ -392,6 +393,9 @@ namespace OLLMchat.Call
 			var response = (Response.Chat) this.streaming_response;
 
 			var token = response.addChunk(stream_chunk);
+			if (stream_chunk.message.tool_calls.size > 0 && this.agent != null) {
+				this.agent.prefetch_tool_calls(response);
+			}
 
 			// Emit stream_start signal on first chunk
 			if (response.is_first_chunk) {
@@ -38,6 +38,30 @@ namespace OLLMchat.Call
 		public bool stream { get; set; default = true; }
 		public Gee.HashMap<string, Tool.BaseTool>? tools { get; set; default = new Gee.HashMap<string, Tool.BaseTool>(); }
 		public OLLMchat.Agent.Base? agent { get; set; default = null; }
+		/** When set, {@link outbound_messages} fits the history to its token budget. */
+		public OLLMchat.Agent.ContextWindow? context_window { get; set; default = null; }
+
+		/**
+		 * Hold a finished response back from {@link Base.response_cache}
+		 * until {@link commit_cached}; for callers that validate the output
+		 * and must not cache a reply they reject.
+		 */
+		public bool defer_cache_store { get; set; default = false; }
+
+		/** Key of the current request in {@link Base.response_cache}, or "". */
+		private string cache_key = "";
+		/** Response held by {@link defer_cache_store}, or null. */
+		private Response.Chat? cache_pending = null;
+		/** Bytes per entry of {@link prefix_hashes}. */
+		private const int PREFIX_BLOCK = 256;
+		/**
+		 * Running FNV-1a hash of the previous request body at every
+		 * {@link PREFIX_BLOCK} bytes, for {@link track_prompt_prefix}: a few
+		 * KB for a long prompt instead of a copy of it.
+		 */
+		private uint32[] prefix_hashes = {};
+		/** A request was sent on this call before (prefix_hashes is valid). */
+		private bool prefix_seen = false;
 
 		public signal void stream_chunk(string new_text, bool is_thinking, Response.Chat response);
 		public signal void stream_start();
@@ -52,6 +76,238 @@ namespace OLLMchat.Call
 			this.tools.set(tool.name, tool);
 		}
 
+		/**
+		 * Messages to serialize for the request body: {@link messages}
+		 * packed by {@link context_window} when one is set.
+		 */
+		protected Gee.ArrayList<Message> outbound_messages()
+		{
+			if (this.context_window == null) {
+				return this.messages;
+			}
+			return this.context_window.pack(this.messages, this.tools_node());
+		}
+
+		/**
+		 * Request body `tools` array in a canonical form.
+		 *
+		 * Active tools are emitted sorted by name and every object's members
+		 * are re-emitted in sorted key order, so the serialized tool block is
+		 * byte-identical from one request to the next. Ollama and llama.cpp
+		 * reuse the KV cache only for an identical prompt prefix, and the
+		 * tool definitions are rendered into that prefix.
+		 *
+		 * @return the array node, or null when no tool is active
+		 */
+		protected Json.Node? tools_node()
+		{
+			if (this.tools == null || this.tools.size == 0) {
+				return null;
+			}
+			var names = new Gee.ArrayList<string>();
+			foreach (var entry in this.tools.entries) {
+				if (entry.value.active) {
+					names.add(entry.key);
+				}
+			}
+			if (names.size == 0) {
+				return null;
+			}
+			names.sort((a, b) => GLib.strcmp(a, b));
+			var tools_arr = new Json.Array();
+			foreach (var name in names) {
+				var tool = this.tools.get(name);
+				var tool_node = Json.gobject_serialize(tool);
+				var tool_obj = tool_node.get_object();
+				// Use map key as tool name so wrapped aliases (e.g. Grep, ls) are sent correctly
+				var func_node = tool_obj.get_member("function");
+				if (func_node != null && func_node.get_node_type() == Json.NodeType.OBJECT) {
+					func_node.get_object().set_string_member("name", name);
+				}
+				tool_obj.set_string_member("type", tool.tool_type);
+				tools_arr.add_element(canonical_node(tool_node));
+			}
+			var tools_node = new Json.Node(Json.NodeType.ARRAY);
+			tools_node.init_array(tools_arr);
+			return tools_node;
+		}
+
+		/**
+		 * Records how much of this request body repeats the previous one.
+		 *
+		 * Sets {@link Response.Chat.prompt_prefix_ratio} to the byte share of
+		 * the common prefix with the last request sent on this call, so a
+		 * prompt that churns near the top (and defeats the server's KV
+		 * cache) shows up in the response metrics. The prefix is measured
+		 * in whole {@link PREFIX_BLOCK} blocks by comparing running hashes.
+		 */
+		protected void track_prompt_prefix(string request_body, Response.Chat response)
+		{
+			unowned uint8[] bytes = request_body.data;
+			var prev = this.prefix_hashes;
+			var hashes = new uint32[bytes.length / PREFIX_BLOCK];
+			uint32 hash = 2166136261U;
+			var matched = 0;
+			for (var i = 0; i < hashes.length * PREFIX_BLOCK; i++) {
+				hash = (hash ^ bytes[i]) * 16777619U;
+				if ((i + 1) % PREFIX_BLOCK != 0) {
+					continue;
+				}
+				var block = (i + 1) / PREFIX_BLOCK - 1;
+				hashes[block] = hash;
+				if (matched == block * PREFIX_BLOCK && block < prev.length && prev[block] == hash) {
+					matched = (block + 1) * PREFIX_BLOCK;
+				}
+			}
+			var seen = this.prefix_seen;
+			this.prefix_hashes = hashes;
+			this.prefix_seen = true;
+			if (!seen || bytes.length == 0) {
+				return;
+			}
+			response.prompt_prefix_ratio = (double)matched / bytes.length;
+		}
+
+		/**
+		 * Answers the request from {@link Base.response_cache} when it holds
+		 * a usable entry.
+		 *
+		 * The cached text is fed through response (thinking first, then
+		 * content with done set) and the usual stream signals and agent
+		 * hooks are called, so streaming callers see a normal, fast stream.
+		 *
+		 * @param request_body body that would be sent
+		 * @param response response to fill
+		 * @param emit call stream signals and agent hooks
+		 * @return true when response was filled from the cache
+		 */
+		protected bool replay_cached(string request_body, Response.Chat response, bool emit)
+		{
+			this.cache_key = "";
+			this.cache_pending = null;
+			if (this.response_cache == null || this.connection == null) {
+				return false;
+			}
+			this.cache_key = this.response_cache.key_for(this.connection, request_body);
+			var entry = this.response_cache.lookup(this.cache_key, this.model_digest(this.model));
+			if (entry == null) {
+				return false;
+			}
+			GLib.debug("Response cache hit for %s (%s)", this.model, entry.file_id);
+			var thinking = this.response_cache.thinking(entry);
+			var chunks = new Gee.ArrayList<Response.Chunk>();
+			if (thinking != "") {
+				chunks.add(new Response.Chunk() {
+					model = this.model,
+					message = new Message("assistant", "", thinking)
+				});
+			}
+			chunks.add(new Response.Chunk() {
+				model = this.model,
+				message = new Message("assistant", this.response_cache.content(entry)),
+				done = true,
+				done_reason = entry.done_reason,
+				prompt_eval_count = entry.prompt_eval_count,
+				eval_count = entry.eval_count,
+				cached_tokens = entry.prompt_eval_count
+			});
+			foreach (var chunk in chunks) {
+				response.addChunk(chunk);
+				if (!emit) {
+					continue;
+				}
+				if (response.is_first_chunk) {
+					response.is_first_chunk = false;
+					this.stream_start();
+					if (this.agent != null) {
+						this.agent.handle_stream_started();
+					}
+				}
+				var is_thinking = response.new_thinking.length > 0;
+				var new_text = is_thinking ? response.new_thinking : response.new_content;
+				this.stream_chunk(new_text, is_thinking, response);
+				if (this.agent != null) {
+					this.agent.handle_stream_chunk(new_text, is_thinking, response);
+				}
+			}
+			response.done = true;
+			return true;
+		}
+
+		/**
+		 * Stores a finished response under the key computed by
+		 * {@link replay_cached}, or holds it for {@link commit_cached} when
+		 * {@link defer_cache_store} is set. Tool calls, cancelled and empty
+		 * responses are not cached.
+		 */
+		protected void store_cached(Response.Chat response)
+		{
+			if (this.response_cache == null || this.cache_key == "" || !response.done
+				|| response.message.tool_calls.size > 0 || response.message.content == ""
+				|| (this.cancellable != null && this.cancellable.is_cancelled())) {
+				return;
+			}
+			if (this.defer_cache_store) {
+				this.cache_pending = response;
+				return;
+			}
+			this.write_cached(response);
+		}
+
+		/**
+		 * Caller accepted the last response; store it if it was held back by
+		 * {@link defer_cache_store}.
+		 */
+		public void commit_cached()
+		{
+			if (this.cache_pending == null) {
+				return;
+			}
+			this.write_cached(this.cache_pending);
+			this.cache_pending = null;
+		}
+
+		private void write_cached(Response.Chat response)
+		{
+			this.response_cache.store(this.cache_key, this.model, this.model_digest(this.model),
+				response.message.content, response.message.thinking, response.done_reason,
+				response.prompt_eval_count, response.eval_count);
+		}
+
+		/**
+		 * Deep copy of a JSON node with object members in sorted key order.
+		 * Array order is kept; it is meaningful (e.g. `required`, `enum`).
+		 */
+		public static Json.Node canonical_node(Json.Node node)
+		{
+			switch (node.get_node_type()) {
+				case Json.NodeType.OBJECT:
+					var src = node.get_object();
+					var keys = new Gee.ArrayList<string>();
+					foreach (var key in src.get_members()) {
+						keys.add(key);
+					}
+					keys.sort((a, b) => GLib.strcmp(a, b));
+					var obj = new Json.Object();
+					foreach (var key in keys) {
+						obj.set_member(key, canonical_node(src.get_member(key)));
+					}
+					var obj_node = new Json.Node(Json.NodeType.OBJECT);
+					obj_node.init_object(obj);
+					return obj_node;
+				case Json.NodeType.ARRAY:
+					var arr = new Json.Array();
+					foreach (var el in node.get_array().get_elements()) {
+						arr.add_element(canonical_node(el));
+					}
+					var arr_node = new Json.Node(Json.NodeType.ARRAY);
+					arr_node.init_array(arr);
+					return arr_node;
+				default:
+					return node.copy();
+			}
+		}
+
 		public abstract async Response.Chat send(
 			Gee.ArrayList<Message> messages,
 			GLib.Cancellable? cancellable = null) throws Error;
@@ -107,6 +107,8 @@ namespace OLLMchat.Call
 		{
 			switch (property_name) {
 				case "agent":
+				case "context-window":
+				case "defer-cache-store":
 				case "streaming-response":
 				case "connection":
 				case "cancellable":
@@ -115,7 +117,7 @@ namespace OLLMchat.Call
 					return null;
 				case "messages":
 					var arr = new Json.Array();
-					foreach (var m in this.messages) {
+					foreach (var m in this.outbound_messages()) {
 						var msg_node = Json.gobject_serialize(m);
 						var msg_obj = msg_node.get_object();
 						m.serialize_images(msg_obj);
@@ -218,26 +220,7 @@ namespace OLLMchat.Call
 					return d_node;
 				}
 				case "tools":
-					if (this.tools.size == 0) {
-						return null;
-					}
-					var tools_arr = new Json.Array();
-					foreach (var entry in this.tools.entries) {
-						if (!entry.value.active) {
-							continue;
-						}
-						var tool_node = Json.gobject_serialize(entry.value);
-						var tool_obj = tool_node.get_object();
-						var func_node = tool_obj.get_member("function");
-						if (func_node != null && func_node.get_node_type() == Json.NodeType.OBJECT) {
-							func_node.get_object().set_string_member("name", entry.key);
-						}
-						tool_obj.set_string_member("type", entry.value.tool_type);
-						tools_arr.add_element(tool_node);
-					}
-					var tools_node = new Json.Node(Json.NodeType.ARRAY);
-					tools_node.init_array(tools_arr);
-					return tools_node;
+					return this.tools_node();
 				default:
 					return base.serialize_property(property_name, value, pspec);
 			}
@@ -293,7 +276,12 @@ namespace OLLMchat.Call
 			var stream_orig = this.stream;
 			this.stream = false;
 			try {
-				GLib.debug("%s", this.get_request_body());
+				var request_body = this.get_request_body();
+				GLib.debug("%s", request_body);
+				var cached = new Response.Chat(this.connection, this);
+				if (this.replay_cached(request_body, cached, false)) {
+					return cached;
+				}
 				var bytes = yield this.send_request(true);
 				var root = this.parse_response(bytes);
 				if (root.get_node_type() != Json.NodeType.OBJECT) {
@@ -306,6 +294,7 @@ namespace OLLMchat.Call
 				chat.connection = this.connection;
 				chat.call = this;
 				chat.done = true;
+				this.store_cached(chat);
 				return chat;
 			} finally {
 				this.stream = stream_orig;
@@ -335,11 +324,36 @@ namespace OLLMchat.Call
 			this.stream = true;
 			var request_body = this.get_request_body();
 			this.stream = stream_orig;
+			if (this.replay_cached(request_body, resp, true)) {
+				return resp;
+			}
+			this.track_prompt_prefix(request_body, resp);
 			var soup_msg = this.connection.soup_message(this.http_method, url, request_body);
 
 			GLib.debug("%s", url);
 			GLib.debug("%s", request_body);
 
+			Scheduler.Ticket ticket;
+			try {
+				ticket = yield this.connection.scheduler.acquire(this.priority, this.cancellable);
+			} catch (GLib.IOError e) {
+				resp.done = true;
+				return resp;
+			}
+			try {
+				return yield this.read_stream(soup_msg, resp, stream_start_us);
+			} finally {
+				this.connection.scheduler.release(ticket);
+			}
+		}
+
+		/**
+		 * Send the streaming request and consume its SSE body into resp;
+		 * runs while {@link exec_stream} holds a scheduler slot.
+		 */
+		private async Response.Chat read_stream(
+			Soup.Message soup_msg, Response.Chat resp, int64 stream_start_us) throws Error
+		{
 			GLib.InputStream? input_stream = null;
 			try {
 				input_stream = yield this.connection.soup.send_async(
@@ -429,6 +443,9 @@ namespace OLLMchat.Call
 					continue;
 				}
 				var token = resp.addChunk(chunk);
+				if (chunk.message.tool_calls.size > 0 && this.agent != null) {
+					this.agent.prefetch_tool_calls(resp);
+				}
 
 				if (resp.is_first_chunk) {
 					resp.is_first_chunk = false;
@@ -483,6 +500,7 @@ namespace OLLMchat.Call
 			if (this.agent != null) {
 				this.agent.handle_stream_chunk("", false, resp);
 			}
+			this.store_cached(resp);
 			return resp;
 		}
 
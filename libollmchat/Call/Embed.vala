@@ -56,6 +56,8 @@ namespace OLLMchat.Call
 		{
 			switch (property_name) {
 				case "client":
+				case "priority":
+				case "response-cache":
 					return null;
 				case "input":
 					// If input_array has items, serialize it as "input" (array)
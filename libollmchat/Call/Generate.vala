@@ -52,6 +52,8 @@ namespace OLLMchat.Call
 		{
 			switch (property_name) {
 				case "client":
+				case "priority":
+				case "response-cache":
 					return null;
 				
 				// String properties - default empty string
@@ -116,6 +118,22 @@ namespace OLLMchat.Call
 
 		public async Response.Generate exec_generate() throws Error
 		{
+			var cache_key = "";
+			if (this.response_cache != null && this.connection != null) {
+				cache_key = this.response_cache.key_for(this.connection, this.get_request_body());
+				var entry = this.response_cache.lookup(cache_key, this.model_digest(this.model));
+				if (entry != null) {
+					return new Response.Generate(this.connection) {
+						model = this.model,
+						response = this.response_cache.content(entry),
+						thinking = this.response_cache.thinking(entry),
+						done = true,
+						done_reason = entry.done_reason,
+						prompt_eval_count = entry.prompt_eval_count,
+						eval_count = entry.eval_count
+					};
+				}
+			}
 			var bytes = yield this.send_request(true);
 			var root = this.parse_response(bytes);
 
@@ -131,6 +149,11 @@ namespace OLLMchat.Call
 				throw new OllmError.FAILED("Failed to deserialize generate response");
 			}
 			// Note: client no longer set on response objects
+			if (cache_key != "" && generate_obj.done && generate_obj.response != "") {
+				this.response_cache.store(cache_key, this.model, this.model_digest(this.model),
+					generate_obj.response, generate_obj.thinking, generate_obj.done_reason ?? "",
+					generate_obj.prompt_eval_count, generate_obj.eval_count);
+			}
 			return generate_obj;
 		}
 	}
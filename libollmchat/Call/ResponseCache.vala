@@ -0,0 +1,245 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+namespace OLLMchat.Call
+{
+	/**
+	 * Disk-backed cache of completed LLM responses, keyed by request.
+	 *
+	 * Opt-in per call ({@link Base.response_cache}) for work such as file
+	 * analysis, titles and history summaries, where the same request body
+	 * is sent again after a re-index or a retry. Only deterministic
+	 * requests (temperature 0) are cached; {@link key_for} returns "" for
+	 * the rest. The key is a hash of the endpoint URL and the canonical
+	 * request JSON (sorted keys, streaming flags removed), so streamed and
+	 * non-streamed sends of the same request share an entry.
+	 *
+	 * Entries expire after {@link ttl_seconds} and are dropped when the
+	 * model digest known on the connection ({@link Response.Model.digest})
+	 * differs from the one recorded at store time. Size and LRU eviction
+	 * are handled by {@link OllamaWeb.DiskCache}.
+	 */
+	public class ResponseCache : OllamaWeb.DiskCache
+	{
+		/**
+		 * Cached response metadata; content and thinking are files next to
+		 * the index.
+		 */
+		public class Entry : OllamaWeb.DiskCacheEntry
+		{
+			public string model { get; set; default = ""; }
+			/** Model digest when stored; "" when it was not known. */
+			public string digest { get; set; default = ""; }
+			public string done_reason { get; set; default = ""; }
+			public int prompt_eval_count { get; set; default = 0; }
+			public int eval_count { get; set; default = 0; }
+			public bool has_thinking { get; set; default = false; }
+			/** Unix time (s) the response was stored. */
+			public int64 created { get; set; default = 0; }
+		}
+
+		private static ResponseCache? shared_cache = null;
+
+		/**
+		 * Process-wide cache under the user cache dir (''ollmchat/llm'').
+		 */
+		public static ResponseCache shared()
+		{
+			lock (shared_cache) {
+				if (shared_cache == null) {
+					shared_cache = new ResponseCache(GLib.Path.build_filename(
+						GLib.Environment.get_user_cache_dir(), "ollmchat", "llm"));
+				}
+			}
+			return shared_cache;
+		}
+
+		/** Entries older than this are not used; 0 keeps them until evicted. */
+		public int64 ttl_seconds { get; set; default = 30 * 86400; }
+
+		public ResponseCache(string dir)
+		{
+			Object(dir: dir, max_bytes: 32 * 1024 * 1024);
+		}
+
+		protected override GLib.Type entry_type()
+		{
+			return typeof(Entry);
+		}
+
+		protected override string[] suffixes(OllamaWeb.DiskCacheEntry entry)
+		{
+			return { "content", "thinking" };
+		}
+
+		/**
+		 * Cache key for a request body sent to connection.
+		 *
+		 * @param request_body serialized request JSON
+		 * @return hex digest, or "" when the body is not valid JSON or the
+		 *     request samples (temperature unset or not 0)
+		 */
+		public string key_for(Settings.Connection connection, string request_body)
+		{
+			var parser = new Json.Parser();
+			try {
+				parser.load_from_data(request_body, -1);
+			} catch (GLib.Error e) {
+				return "";
+			}
+			var root = parser.get_root();
+			if (root == null || root.get_node_type() != Json.NodeType.OBJECT
+					|| !this.is_deterministic(root.get_object())) {
+				return "";
+			}
+			var node = ChatBase.canonical_node(root);
+			var obj = node.get_object();
+			foreach (var name in new string[] { "stream", "stream_options", "keep_alive" }) {
+				if (obj.has_member(name)) {
+					obj.remove_member(name);
+				}
+			}
+			return GLib.Checksum.compute_for_string(GLib.ChecksumType.SHA256,
+				connection.url + "\n" + Json.to_string(node, false));
+		}
+
+		/**
+		 * Request asks for temperature 0, top level (OpenAI) or in options
+		 * (Ollama). Without it the server's default samples.
+		 */
+		private bool is_deterministic(Json.Object request)
+		{
+			var holder = request;
+			if (!holder.has_member("temperature") && request.has_member("options")
+					&& request.get_member("options").get_node_type() == Json.NodeType.OBJECT) {
+				holder = request.get_object_member("options");
+			}
+			if (!holder.has_member("temperature")
+					|| holder.get_member("temperature").get_node_type() != Json.NodeType.VALUE) {
+				return false;
+			}
+			return holder.get_double_member("temperature") == 0.0;
+		}
+
+		/**
+		 * Usable entry for key, or null. Expired entries and entries for a
+		 * different model digest are removed. Counts as a use for LRU.
+		 *
+		 * @param digest current model digest, or "" when unknown
+		 */
+		public Entry? lookup(string key, string digest)
+		{
+			if (key == "") {
+				return null;
+			}
+			this.mutex.lock();
+			try {
+				var entry = this.find(key) as Entry;
+				if (entry == null) {
+					return null;
+				}
+				var now = GLib.get_real_time() / 1000000;
+				if ((this.ttl_seconds > 0 && now - entry.created > this.ttl_seconds)
+						|| (digest != "" && entry.digest != "" && digest != entry.digest)
+						|| !GLib.FileUtils.test(this.path(entry, "content"), GLib.FileTest.EXISTS)) {
+					this.drop(entry);
+					this.save();
+					return null;
+				}
+				this.touch(entry);
+				return entry;
+			} finally {
+				this.mutex.unlock();
+			}
+		}
+
+		/** Stored response text, or "" if the file went missing. */
+		public string content(Entry entry)
+		{
+			return this.read(entry, "content");
+		}
+
+		/** Stored thinking text, or "". */
+		public string thinking(Entry entry)
+		{
+			return entry.has_thinking ? this.read(entry, "thinking") : "";
+		}
+
+		/**
+		 * Store a completed response for key, replacing any earlier entry.
+		 */
+		public void store(
+			string key,
+			string model,
+			string digest,
+			string content,
+			string thinking,
+			string done_reason,
+			int prompt_eval_count,
+			int eval_count)
+		{
+			if (key == "") {
+				return;
+			}
+			var now = GLib.get_real_time() / 1000000;
+			var entry = new Entry() {
+				key = key,
+				file_id = key.substring(0, 32),
+				model = model,
+				digest = digest,
+				done_reason = done_reason,
+				prompt_eval_count = prompt_eval_count,
+				eval_count = eval_count,
+				has_thinking = thinking != "",
+				created = now,
+				last_used = now,
+				size = content.length + thinking.length
+			};
+			this.mutex.lock();
+			try {
+				var old = this.find(key);
+				if (old != null) {
+					this.drop(old);
+				}
+				GLib.DirUtils.create_with_parents(this.dir, 0700);
+				GLib.FileUtils.set_contents(this.path(entry, "content"), content);
+				if (entry.has_thinking) {
+					GLib.FileUtils.set_contents(this.path(entry, "thinking"), thinking);
+				}
+				this.add(entry);
+			} catch (GLib.Error e) {
+				GLib.warning("Response cache %s: %s", entry.file_id, e.message);
+				this.save();
+			} finally {
+				this.mutex.unlock();
+			}
+		}
+
+		private string read(Entry entry, string suffix)
+		{
+			try {
+				string text;
+				GLib.FileUtils.get_contents(this.path(entry, suffix), out text);
+				return text;
+			} catch (GLib.Error e) {
+				GLib.debug("Response cache %s (%s): %s", entry.file_id, suffix, e.message);
+				return "";
+			}
+		}
+	}
+}
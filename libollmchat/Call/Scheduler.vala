@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+namespace OLLMchat.Call
+{
+	/**
+	 * Scheduling class of a request on its endpoint.
+	 */
+	public enum Priority
+	{
+		/** User is waiting (chat turn, search query). */
+		INTERACTIVE,
+		/** Bulk or deferred work (indexing, analysis, titles, summaries). */
+		BACKGROUND
+	}
+
+	/**
+	 * Per-endpoint admission control for API requests.
+	 *
+	 * One per {@link Settings.Connection} ({@link Settings.Connection.scheduler}).
+	 * Every {@link Base} request takes a {@link Ticket} before it is sent and
+	 * returns it when the response (or stream) is finished.
+	 *
+	 * At most {@link max_in_flight} requests run at once, background ones at
+	 * most {@link max_background}, so interactive requests normally find a
+	 * free slot straight away. Queued interactive requests are always served
+	 * before queued background ones; when none is free, the newest
+	 * preemptible background request is cancelled and retried by its caller
+	 * once a slot frees up again.
+	 */
+	public class Scheduler : Object
+	{
+		/**
+		 * A granted slot. Send the request with {@link cancellable}; it is
+		 * cancelled when the caller's cancellable is, or on preemption.
+		 */
+		public class Ticket : Object
+		{
+			public Priority priority { get; construct; }
+			/** Background request that can be cancelled and resent. */
+			public bool preemptible { get; construct; }
+			/** Cancelled by the caller's cancellable or by preemption. */
+			public GLib.Cancellable cancellable { get; private set; default = new GLib.Cancellable(); }
+			/** True once {@link cancellable} was cancelled to free the slot. */
+			public bool preempted { get; internal set; default = false; }
+
+			private GLib.Cancellable? caller = null;
+			private ulong caller_handler = 0;
+
+			internal Ticket(Priority priority, bool preemptible, GLib.Cancellable? caller)
+			{
+				Object(priority: priority, preemptible: preemptible);
+				if (caller == null) {
+					return;
+				}
+				if (caller.is_cancelled()) {
+					this.cancellable.cancel();
+					return;
+				}
+				this.caller = caller;
+				this.caller_handler = caller.cancelled.connect(() => {
+					this.cancellable.cancel();
+				});
+			}
+
+			internal void detach()
+			{
+				if (this.caller_handler == 0) {
+					return;
+				}
+				GLib.SignalHandler.disconnect(this.caller, this.caller_handler);
+				this.caller_handler = 0;
+			}
+		}
+
+		/** Caller queued for a slot; resumed on its own main context. */
+		private class Waiter
+		{
+			public Ticket ticket;
+			public GLib.SourceFunc? resume = null;
+			public GLib.MainContext context;
+		}
+
+		/** Requests in flight on this endpoint. */
+		public int max_in_flight { get; set; default = 4; }
+
+		/** Background requests in flight; keep below {@link max_in_flight}. */
+		public int max_background { get; set; default = 2; }
+
+		private Gee.ArrayList<Ticket> running = new Gee.ArrayList<Ticket>();
+		private Gee.ArrayQueue<Waiter> interactive = new Gee.ArrayQueue<Waiter>();
+		private Gee.ArrayQueue<Waiter> background = new Gee.ArrayQueue<Waiter>();
+
+		/**
+		 * Wait for a slot.
+		 *
+		 * @param priority scheduling class of the request
+		 * @param cancellable caller's cancellable; cancelling it while
+		 *        queued abandons the wait
+		 * @param preemptible background request that may be cancelled for
+		 *        an interactive one (only for requests that can be resent)
+		 * @return ticket to pass to {@link release}
+		 * @throws GLib.IOError.CANCELLED when cancelled while queued
+		 */
+		public async Ticket acquire(
+			Priority priority,
+			GLib.Cancellable? cancellable = null,
+			bool preemptible = false) throws GLib.IOError
+		{
+			var ticket = new Ticket(priority, preemptible, cancellable);
+			if (ticket.cancellable.is_cancelled()) {
+				ticket.detach();
+				throw new GLib.IOError.CANCELLED("Request cancelled");
+			}
+			if (this.can_start(priority)) {
+				this.running.add(ticket);
+				return ticket;
+			}
+			var w = new Waiter();
+			w.ticket = ticket;
+			w.context = GLib.MainContext.ref_thread_default();
+			w.resume = this.acquire.callback;
+			var queue = priority == Priority.INTERACTIVE ? this.interactive : this.background;
+			queue.offer(w);
+			if (priority == Priority.INTERACTIVE) {
+				this.preempt();
+			}
+			var cancel_handler = ticket.cancellable.cancelled.connect(() => {
+				if (queue.remove(w)) {
+					this.wake(w);
+				}
+			});
+			yield;
+			ticket.cancellable.disconnect(cancel_handler);
+			if (!this.running.contains(ticket)) {
+				ticket.detach();
+				throw new GLib.IOError.CANCELLED("Request cancelled while queued");
+			}
+			return ticket;
+		}
+
+		/**
+		 * Return a slot and start the next queued request.
+		 */
+		public void release(Ticket ticket)
+		{
+			ticket.detach();
+			if (!this.running.remove(ticket)) {
+				return;
+			}
+			this.dispatch();
+		}
+
+		private int background_running()
+		{
+			var ret = 0;
+			foreach (var t in this.running) {
+				if (t.priority == Priority.BACKGROUND) {
+					ret++;
+				}
+			}
+			return ret;
+		}
+
+		private bool can_start(Priority priority)
+		{
+			if (this.running.size >= int.max(1, this.max_in_flight)) {
+				return false;
+			}
+			if (priority == Priority.INTERACTIVE) {
+				return true;
+			}
+			return this.interactive.is_empty
+				&& this.background_running() < int.max(1, this.max_background);
+		}
+
+		private void dispatch()
+		{
+			while (!this.interactive.is_empty && this.can_start(Priority.INTERACTIVE)) {
+				this.start(this.interactive.poll());
+			}
+			while (!this.background.is_empty && this.can_start(Priority.BACKGROUND)) {
+				this.start(this.background.poll());
+			}
+		}
+
+		private void start(Waiter w)
+		{
+			this.running.add(w.ticket);
+			this.wake(w);
+		}
+
+		private void wake(Waiter w)
+		{
+			var source = new GLib.IdleSource();
+			source.set_callback((owned) w.resume);
+			source.attach(w.context);
+		}
+
+		/**
+		 * Cancel the newest preemptible background request when an
+		 * interactive one is queued and nothing is free.
+		 */
+		private void preempt()
+		{
+			if (this.running.size < int.max(1, this.max_in_flight)) {
+				return;
+			}
+			for (var i = this.running.size - 1; i >= 0; i--) {
+				var t = this.running.get(i);
+				if (t.priority != Priority.BACKGROUND || !t.preemptible || t.preempted) {
+					continue;
+				}
+				GLib.debug("Scheduler: preempting background request for interactive");
+				t.preempted = true;
+				t.cancellable.cancel();
+				return;
+			}
+		}
+	}
+}
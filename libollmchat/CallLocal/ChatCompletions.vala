@@ -159,7 +159,7 @@ namespace OLLMchat.CallLocal
 				"model.gguf"
 			);
 			Llama.ChatMessage[] template_messages = {};
-			foreach (var message in this.messages) {
+			foreach (var message in this.outbound_messages()) {
 				switch (message.role) {
 				case "system":
 					template_messages += Llama.ChatMessage() {
@@ -263,7 +263,7 @@ namespace OLLMchat.CallLocal
 				"model.gguf"
 			);
 			Llama.ChatMessage[] template_messages = {};
-			foreach (var message in this.messages) {
+			foreach (var message in this.outbound_messages()) {
 				switch (message.role) {
 				case "system":
 					template_messages += Llama.ChatMessage() {
@@ -115,6 +115,17 @@ namespace OLLMchat.ChatPermission
 		protected static Gee.HashMap<string, string> global { 
 			get; private set; default = new Gee.HashMap<string, string>(); }
 		
+		/**
+		 * True while request_user() is showing a prompt.
+		 * Tool calls may run in parallel, but only one prompt is shown at a time.
+		 */
+		private bool asking = false;
+		
+		/**
+		 * Requests waiting for the current prompt to finish (FIFO).
+		 */
+		private Gee.ArrayQueue<Waiter> waiting = new Gee.ArrayQueue<Waiter>();
+		
 		/**
 		 * Constructor.
 		 *
@@ -165,35 +176,97 @@ namespace OLLMchat.ChatPermission
 			GLib.debug("Provider.request: Tool '%s' requesting permission for '%s' (operation: %s)",
 				request.tool.name, normalized_path, request.permission_operation.to_string());
 			
-			// Check session permissions
-			if (Provider.session.has_key(normalized_path)) {
-				var result = this.check(Provider.session.get(normalized_path), request.permission_operation);
-				GLib.debug("Provider.request: Found session permission for '%s': %s", normalized_path, result.to_string());
-				if (result == PermissionResult.YES || result == PermissionResult.NO) {
-					return result == PermissionResult.YES;
-				}
+			var stored = this.check_stored(normalized_path, request.permission_operation);
+			if (stored != PermissionResult.ASK) {
+				return stored == PermissionResult.YES;
 			}
 			
-			// Check global permissions
-			if (Provider.global.has_key(normalized_path)) {
-				var result = this.check(Provider.global.get(normalized_path), request.permission_operation);
-				GLib.debug("Provider.request: Found global permission for '%s': %s", normalized_path, result.to_string());
-				if (result == PermissionResult.YES || result == PermissionResult.NO) {
-					return result == PermissionResult.YES;
+			// Only one prompt at a time; parallel tool calls queue here
+			if (this.asking) {
+				var waiter = new Waiter();
+				waiter.resume = this.request.callback;
+				this.waiting.offer(waiter);
+				yield;
+				// The previous prompt may have stored an answer for this path
+				stored = this.check_stored(normalized_path, request.permission_operation);
+				if (stored != PermissionResult.ASK) {
+					this.next_waiter();
+					return stored == PermissionResult.YES;
 				}
 			}
+			this.asking = true;
 			
 			// No stored permission found - ask user
 			GLib.debug("Provider.request: No stored permission found, asking user: '%s'", request.permission_question);
 			var response = yield this.request_user(request);
 			GLib.debug("Provider.request: User responded with: %s", response.to_string());
 			this.handle_response(normalized_path, request.permission_operation, response);
+			this.next_waiter();
 			
 			return (response == PermissionResponse.ALLOW_ONCE || 
 			        response == PermissionResponse.ALLOW_SESSION || 
 			        response == PermissionResponse.ALLOW_ALWAYS);
 		}
 		
+		/**
+		 * Whether a stored session or global answer covers request, so
+		 * {@link request} would not prompt the user.
+		 *
+		 * @param request The Request instance with permission fields built
+		 * @return true when allowed or denied without asking
+		 */
+		public bool has_answer(OLLMchat.Tool.RequestBase request)
+		{
+			return this.check_stored(
+				this.normalize_path(request.permission_target_path),
+				request.permission_operation) != PermissionResult.ASK;
+		}
+		
+		/**
+		 * Looks up session then global storage for a normalized path.
+		 *
+		 * @return YES or NO when an answer is stored, ASK otherwise
+		 */
+		private PermissionResult check_stored(string normalized_path, Operation operation)
+		{
+			// Check session permissions
+			if (Provider.session.has_key(normalized_path)) {
+				var result = this.check(Provider.session.get(normalized_path), operation);
+				GLib.debug("Provider.request: Found session permission for '%s': %s", normalized_path, result.to_string());
+				if (result == PermissionResult.YES || result == PermissionResult.NO) {
+					return result;
+				}
+			}
+			
+			// Check global permissions
+			if (Provider.global.has_key(normalized_path)) {
+				var result = this.check(Provider.global.get(normalized_path), operation);
+				GLib.debug("Provider.request: Found global permission for '%s': %s", normalized_path, result.to_string());
+				if (result == PermissionResult.YES || result == PermissionResult.NO) {
+					return result;
+				}
+			}
+			return PermissionResult.ASK;
+		}
+		
+		/**
+		 * Hands the prompt over to the next queued request, or marks the
+		 * provider idle when nobody is waiting.
+		 */
+		private void next_waiter()
+		{
+			var waiter = this.waiting.poll();
+			if (waiter == null) {
+				this.asking = false;
+				return;
+			}
+			// asking stays true; the woken request now owns the prompt
+			GLib.Idle.add(() => {
+				waiter.resume();
+				return false;
+			});
+		}
+		
 		/**
 		 * Abstract method for requesting permission from user.
 		 * Subclasses implement this to show UI dialogs, prompts, etc.
@@ -404,6 +477,14 @@ namespace OLLMchat.ChatPermission
 					break;
 			}
 		}
+		/**
+		 * Continuation holder for requests queued behind an open prompt.
+		 */
+		private class Waiter
+		{
+			public GLib.SourceFunc resume;
+		}
+		
 		static char[] op_chars = {'r', 'w', 'x'};
 		/**
 		 * Updates a permission string with new operation permission(s).
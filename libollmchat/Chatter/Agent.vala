@@ -21,14 +21,26 @@ namespace OLLMchat.Chatter
 	/**
 	 * Chatter agent.
 	 *
-	 * FIFO queue on {@link pending_messages}; {@link send_async} enqueues chat +
-	 * summarize pairs and drains the queue inline when idle.
+	 * FIFO queue on {@link pending_messages}; {@link send_async} enqueues a
+	 * chat turn and drains the queue inline when idle. Summarizing is off the
+	 * interactive path: each finished turn, and the context window's
+	 * {@link OLLMchat.Agent.ContextWindow.summarize_wanted} mid-turn, call
+	 * {@link schedule_summary}, which folds the finalized turns into the
+	 * running summary in the background and appends the ''summary'' message
+	 * only when no turn is in flight, so the next request never sees a
+	 * partial or stale boundary.
 	 */
 	public class Agent : OLLMchat.Agent.Base
 	{
 		public Agent(Factory factory, History.SessionBase session)
 		{
 			base(factory, session);
+			// History nearing the token budget (or already packed down):
+			// fold what has finalized now rather than after the turn.
+			this.context_window.summarize_wanted.connect((used, budget) => {
+				GLib.debug("summarize wanted used=%d budget=%d", used, budget);
+				this.schedule_summary();
+			});
 		}
 
 		internal Gee.ArrayList<PendingMessage> pending_messages {
@@ -41,8 +53,22 @@ namespace OLLMchat.Chatter
 		internal bool summarizing { get; set; default = false; }
 
 		/**
-		 * Enqueues chat + paired summarize; drains queue when idle; waits until
-		 * both steps for this message complete.
+		 * Index after the last finished turn in ''session.messages''; set by
+		 * {@link PendingMessage.run}. -1 until a turn completes.
+		 */
+		internal int finalized_end { get; set; default = -1; }
+
+		/* Summary folded up to summary_end, not yet in session.messages. */
+		private string summary_pending = "";
+		private int summary_end = -1;
+		private bool summary_again = false;
+		/* range hash (previous summary + folded messages) → summary text */
+		private Gee.HashMap<string, string> summary_cache = new Gee.HashMap<string, string>();
+
+		/**
+		 * Enqueues a chat turn; drains queue when idle; waits until this
+		 * turn's reply completes. Summarizing runs afterwards in the
+		 * background and is not waited on.
 		 *
 		 * @param message API user message (`user-sent` / `ui` already from Session)
 		 * @param cancellable optional cancel token for the main/tool request
@@ -52,11 +78,8 @@ namespace OLLMchat.Chatter
 			GLib.Cancellable? cancellable = null) throws GLib.Error
 		{
 			var entry = new PendingMessage(
-				message, cancellable, true, new Gee.Promise<bool>());
+				message, cancellable, new Gee.Promise<bool>());
 			this.pending_messages.add(entry);
-			// Paired summarize row — same done promise; enqueued before drain starts.
-			this.pending_messages.add(
-				new PendingMessage(null, null, false, entry.done));
 			// Another send_async is already draining; wait on this turn's promise.
 			if (this.pending_processing) {
 				yield entry.done.future.wait_async();
@@ -69,18 +92,150 @@ namespace OLLMchat.Chatter
 					yield head.run(this);
 				} catch (GLib.Error e) {
 					head.done.set_exception(e);
-					// Chat failed — skip the paired summarize row already at queue head.
-					if (head.is_chat && this.pending_messages.size > 0) {
-						this.pending_messages.remove_at(0);
-					}
+					continue;
 				}
+				this.schedule_summary();
 			}
 			this.pending_processing = false;
+			// Queue idle — a summary finished mid-turn can go in now.
+			this.swap_summary();
 			GLib.debug("queue drain done pending=%d before wait",
 				this.pending_messages.size);
 			yield entry.done.future.wait_async();
 			GLib.debug("queue wait returned is_running=%s",
 				this.session.is_running.to_string());
 		}
+
+		/**
+		 * Fold finished turns into the summary in the background.
+		 *
+		 * Only one summarizer runs at a time; a call while it is busy makes
+		 * it go round again once the current fold finishes, so turns that
+		 * finalize meanwhile are folded incrementally on top of it.
+		 */
+		public void schedule_summary()
+		{
+			if (this.summarizing) {
+				this.summary_again = true;
+				return;
+			}
+			this.summarizing = true;
+			this.run_summaries.begin();
+		}
+
+		private async void run_summaries()
+		{
+			do {
+				this.summary_again = false;
+				yield this.summarize_step();
+			} while (this.summary_again);
+			this.summarizing = false;
+			this.swap_summary();
+		}
+
+		/**
+		 * Summarize from the current boundary (appended summary, or pending
+		 * one) up to {@link finalized_end}. Reuses a cached summary when the
+		 * same range with the same starting summary was folded before.
+		 */
+		private async void summarize_step()
+		{
+			var start = this.summary_end;
+			var previous = this.summary_pending;
+			if (start < 0) {
+				start = 0;
+				previous = "";
+				for (var i = this.session.messages.size - 1; i >= 0; i--) {
+					if (this.session.messages.get(i).role == "summary") {
+						start = i + 1;
+						previous = this.session.messages.get(i).content;
+						break;
+					}
+				}
+			}
+			var end = int.min(this.finalized_end, this.session.messages.size);
+			if (end <= start || !this.has_turn(start, end)) {
+				return;
+			}
+
+			var checksum = new GLib.Checksum(GLib.ChecksumType.SHA256);
+			checksum.update(previous.data, previous.length);
+			for (var i = start; i < end; i++) {
+				var msg = this.session.messages.get(i);
+				var line = "\n" + msg.role + "\n" + msg.content;
+				checksum.update(line.data, line.length);
+			}
+			var key = checksum.get_string();
+
+			var text = this.summary_cache.has_key(key) ? this.summary_cache.get(key) : "";
+			if (text == "") {
+				// Own cancellable — Stop on main chat must not abort background summary.
+				text = yield (new OLLMchat.Agent.Summarizer(this)).summarize(
+					start, end, previous, new GLib.Cancellable());
+				if (text == "") {
+					return;
+				}
+				this.summary_cache.set(key, text);
+			}
+			this.summary_pending = text;
+			this.summary_end = end;
+			this.swap_summary();
+		}
+
+		/**
+		 * Append the pending summary as the new history boundary.
+		 *
+		 * Only when no turn is running or queued and no API message
+		 * follows the folded range — {@link create_summary} drops everything
+		 * before the boundary, so anything later must already be in it.
+		 */
+		private void swap_summary()
+		{
+			if (this.summary_end < 0
+				|| this.session.is_running
+				|| this.pending_messages.size > 0) {
+				return;
+			}
+			for (var i = this.summary_end; i < this.session.messages.size; i++) {
+				switch (this.session.messages.get(i).role) {
+					case "user-sent":
+					case "user":
+					case "assistant":
+					case "tool":
+					case "content-stream":
+					case "think-stream":
+						return;
+					default:
+						break;
+				}
+			}
+			var summary = new Message("summary", this.summary_pending);
+			this.summary_pending = "";
+			this.summary_end = -1;
+			this.session.messages.add(summary);
+			this.context_window.summary_due = false;
+			this.session.notify_property("display_info");
+			this.session.manager.message_added(summary, this.session);
+			this.session.save_async.begin();
+		}
+
+		/**
+		 * Whether ''session.messages[start, end)'' holds anything to fold
+		 * (a user prompt or a model reply).
+		 */
+		private bool has_turn(int start, int end)
+		{
+			for (var i = start; i < end; i++) {
+				switch (this.session.messages.get(i).role) {
+					case "user-sent":
+					case "content-stream":
+					case "assistant":
+						return true;
+					default:
+						break;
+				}
+			}
+			return false;
+		}
 	}
 }
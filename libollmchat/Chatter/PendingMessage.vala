@@ -19,53 +19,38 @@
 namespace OLLMchat.Chatter
 {
 	/**
-	 * One queued chat or summarize step. {@link run} relays by {@link is_chat};
-	 * queue drain lives on {@link Agent.send_async}.
+	 * One queued chat turn. {@link run} delivers it; queue drain lives on
+	 * {@link Agent.send_async} and summarizing on {@link Agent.schedule_summary}.
 	 */
 	public class PendingMessage : GLib.Object
 	{
-		public bool is_chat { get; construct; default = true; }
-		public Message? message { get; construct; }
+		public Message message { get; construct; }
 		public GLib.Cancellable? cancellable { get; construct; }
 		public Gee.Promise<bool> done { get; construct; }
 
 		public PendingMessage(
-			Message? message,
+			Message message,
 			GLib.Cancellable? cancellable,
-			bool is_chat,
 			Gee.Promise<bool>? done)
 		{
 			Object(
 				message: message,
 				cancellable: cancellable,
-				is_chat: is_chat,
 				done: done != null ? done : new Gee.Promise<bool>()
 			);
 		}
 
 		/**
-		 * Relay entry: chat deliver when is_chat, else run_summarize.
-		 * Sets ''is_running'' / ''summarizing'' on the agent for the active phase.
+		 * Chat deliver. Sets ''is_running'' on the session for the turn,
+		 * resolves {@link done} on success and marks the turn finalized
+		 * for the background summarizer.
 		 *
 		 * @param agent the Chatter agent supplying session and chat call
 		 */
 		public async void run(Agent agent) throws GLib.Error
 		{
-			GLib.debug("pending run is_chat=%s is_running=%s",
-				this.is_chat.to_string(), agent.session.is_running.to_string());
-			// Summarize row: no message/cancellable; relay to run_summarize.
-			if (!this.is_chat) {
-				agent.summarizing = true;
-				try {
-					yield this.run_summarize(agent);
-				} finally {
-					agent.summarizing = false;
-				}
-				GLib.debug("pending run summarize relay done is_running=%s",
-					agent.session.is_running.to_string());
-				return;
-			}
-
+			GLib.debug("pending run is_running=%s",
+				agent.session.is_running.to_string());
 			agent.session.is_running = true;
 			agent.session.manager.agent_status_change();
 			agent.session.messages.add(this.message);
@@ -99,25 +84,10 @@ namespace OLLMchat.Chatter
 				agent.session.is_running = false;
 				agent.session.manager.agent_status_change();
 			}
+			agent.finalized_end = agent.session.messages.size;
+			this.done.set_value(true);
 			GLib.debug("pending run chat deliver done is_running=%s",
 				agent.session.is_running.to_string());
 		}
-
-		/**
-		 * Summarize the completed chat turn (own cancellable — not main-turn token).
-		 *
-		 * @param agent the Chatter agent for this session
-		 */
-		public async void run_summarize(Agent agent) throws GLib.Error
-		{
-			// Own cancellable — Stop on main chat must not abort background summary.
-			GLib.debug("pending summarize before");
-			yield (new OLLMchat.Agent.Summarizer(agent)).run(
-				new GLib.Cancellable());
-			GLib.debug("pending summarize after");
-			// Turn complete — chat + summarize share this done promise.
-			this.done.set_value(true);
-			GLib.debug("pending promise set_value");
-		}
 	}
 }
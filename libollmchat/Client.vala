@@ -76,6 +76,21 @@ namespace OLLMchat
 		 * @since 1.0
 		 */
 		public Settings.Connection connection { get; set; }
+
+		/**
+		 * Scheduling class applied to the calls this client creates.
+		 *
+		 * Set to {@link Call.Priority.BACKGROUND} for deferred work so it
+		 * yields to interactive requests on the same connection.
+		 */
+		public Call.Priority priority { get; set; default = Call.Priority.INTERACTIVE; }
+
+		/**
+		 * Response cache applied to the calls this client creates, or null.
+		 *
+		 * Only set it for deterministic prompts (see {@link Call.ResponseCache}).
+		 */
+		public Call.ResponseCache? response_cache { get; set; default = null; }
 		
 		
 
@@ -131,6 +146,8 @@ namespace OLLMchat
 				think = true
 			};
 			call.options =  options == null ? new Call.Options() : options; 
+			call.priority = this.priority;
+			call.response_cache = this.response_cache;
 			// Create dummy user-sent Message with original text
 			var user_sent_msg = new Message("user-sent", text.strip());
 			// message_created signal emission removed - callers handle state directly when creating messages
@@ -260,6 +277,8 @@ namespace OLLMchat
 				truncate = truncate
 			};
 			call.options = options == null ? new Call.Options() : options;
+			call.priority = this.priority;
+			call.response_cache = this.response_cache;
 			
 			var result = yield call.exec_embed();
 			
@@ -300,6 +319,8 @@ namespace OLLMchat
 				truncate = truncate
 			};
 			call.options = options == null ? new Call.Options() : options;
+			call.priority = this.priority;
+			call.response_cache = this.response_cache;
 			
 		var result = yield call.exec_embed();
 			
@@ -340,6 +361,8 @@ namespace OLLMchat
 				think = false
 			};
 			call.options = options == null ? new Call.Options() : options;
+			call.priority = this.priority;
+			call.response_cache = this.response_cache;
 			
 			var result = yield call.exec_generate();
 
@@ -371,6 +394,8 @@ namespace OLLMchat
 				prompt = prompt
 			};
 			call.options = options == null ? new Call.Options() : options;
+			call.priority = this.priority;
+			call.response_cache = this.response_cache;
 			return yield call.exec_completions();
 		}
 	}
@@ -147,6 +147,9 @@ namespace OLLMchat.History
 
 			this.agent = agent;
 			this.agent_name = agent_name;
+			if (old_agent != null) {
+				this.manager.agent_released(old_agent);
+			}
 
 			this.manager.agent_activated(agent_factory);
 		}
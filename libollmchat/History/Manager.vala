@@ -89,6 +89,18 @@ namespace OLLMchat.History
 		 * before {@link #agent_activated} for the newly selected factory.
 		 */
 		public signal void agent_deactivated(Agent.Factory factory);
+
+		/**
+		 * Emitted when a session replaces its agent, or is removed, so tools
+		 * can drop state they keep per agent (e.g. run_command's sandbox).
+		 */
+		public signal void agent_released(Agent.Interface agent);
+		
+		/**
+		 * Emitted by {@link unregister_tool} once the tool has left
+		 * {@link tools}; agents drop it from their chat call.
+		 */
+		public signal void tool_unregistered(string name);
 		
 		/** Emitted when session.is_running changes; UI connects and updates send/stop button from manager.session.is_running. */
 		public signal void agent_status_change();
@@ -238,6 +250,20 @@ namespace OLLMchat.History
 			this.tools.set(tool.name, tool);
 		}
 		
+		/**
+		 * Removes a tool registered with {@link register_tool} and emits
+		 * {@link tool_unregistered}. No-op when no tool has that name.
+		 *
+		 * @param name The tool name
+		 */
+		public void unregister_tool(string name)
+		{
+			if (!this.tools.unset(name)) {
+				return;
+			}
+			this.tool_unregistered(name);
+		}
+		
 		/**
 		 * Switches to a new session, deactivating the current one and activating the new one.
 		 *
@@ -573,6 +573,9 @@ namespace OLLMchat.History
 			}
 
 			this.agent = agent;
+			if (old_agent != null) {
+				this.manager.agent_released(old_agent);
+			}
 
 			this.manager.agent_activated(factory);
 		}
@@ -80,7 +80,10 @@ namespace OLLMchat.History
 					"\"" + first_message + "\"\n\n" +
 					"Respond with ONLY the title, no explanation or quotes.";
 				
-				var client = new OLLMchat.Client(connection);
+				var client = new OLLMchat.Client(connection) {
+					priority = OLLMchat.Call.Priority.BACKGROUND,
+					response_cache = OLLMchat.Call.ResponseCache.shared()
+				};
 				var response = yield client.generate(model, prompt);
 				
 				// Extract title (prompt explicitly says "no explanation or quotes")
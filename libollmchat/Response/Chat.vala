@@ -66,6 +66,15 @@ namespace OLLMchat.Response
 		public int64 prompt_eval_duration { get; set; default = 0; }
 		public int eval_count { get; set; default = 0; }
 		public int64 eval_duration { get; set; default = 0; }
+		/** Prompt tokens reused from the server's prefix cache, when the server reports it (v1 usage, llama.cpp timings). */
+		public int cached_tokens { get; set; default = 0; }
+		/**
+		 * Client-side share of this request body that matched the previous
+		 * request on the same call byte for byte (0..1). Set by
+		 * {@link Call.ChatBase}; a low value means the prompt prefix moved
+		 * and the server had to re-prefill.
+		 */
+		public double prompt_prefix_ratio { get; set; default = 0.0; }
 		public string new_content { get; set; default = ""; }
 		public string new_thinking { get; set; default = ""; }
 
@@ -93,28 +102,45 @@ namespace OLLMchat.Response
 			}
 		}
 
+		/**
+		 * Share of prompt tokens served from the server's prefix cache (0..1),
+		 * or 0 when the server does not report cached tokens.
+		 */
+		public double prefix_hit_ratio {
+			get {
+				if (this.cached_tokens <= 0 || this.prompt_eval_count <= 0) {
+					return 0.0;
+				}
+				return double.min(1.0, (double)this.cached_tokens / this.prompt_eval_count);
+			}
+		}
+
 		/**
 		 * Generates a summary string with performance metrics.
 		 *
-		 * @return Summary string in format "Total Duration: X.XXs | Tokens In: X Out: X | X.XX t/s".
+		 * @return Summary string in format "Total Duration: X.XXs | Tokens In: X Out: X | X.XX t/s",
+		 *         with " | Cached: X (N%)" appended when the server reported prefix cache hits.
 		 *         Session.finalize_streaming appends " | " plus display_name_with_size(), or "Unknown model" if model name is empty.
 		 *         Returns "Response completed (metrics not available)" if eval_duration is 0 (no metrics available)
 		 */
 		public string get_summary()
 		{
+			var cached = this.cached_tokens > 0
+				? " | Cached: %d (%.0f%%)".printf(this.cached_tokens, this.prefix_hit_ratio * 100)
+				: "";
 			if (this.eval_duration > 0 || this.total_duration > 0) {
 				return "Total Duration: %.2fs | Tokens In: %d Out: %d | %.2f t/s".printf(
 					this.total_duration_s,
 					this.prompt_eval_count,
 					this.eval_count,
 					this.tokens_per_second
-				);
+				) + cached;
 			}
 			if (this.prompt_eval_count > 0 || this.eval_count > 0) {
 				return "Tokens In: %d Out: %d".printf(
 					this.prompt_eval_count,
 					this.eval_count
-				);
+				) + cached;
 			}
 			return "Response completed (metrics not available)";
 		}
@@ -213,6 +239,8 @@ namespace OLLMchat.Response
 				case "total_duration_s":
 				case "eval_duration_s":
 				case "tokens_per_second":
+				case "prefix-hit-ratio":
+				case "prompt-prefix-ratio":
 				case "call":
 				case "back-tokens":
 					// Exclude computed properties, call (circular), streaming loop state
@@ -261,6 +289,10 @@ namespace OLLMchat.Response
 					if (usage.has_member("completion_tokens")) {
 						this.eval_count = (int)usage.get_int_member("completion_tokens");
 					}
+					var usage_cached = Usage.cached_from(usage);
+					if (usage_cached > 0) {
+						this.cached_tokens = usage_cached;
+					}
 					value = Value(typeof(int));
 					value.set_int(0);
 					return true;
@@ -271,9 +303,22 @@ namespace OLLMchat.Response
 					value.set_string(this.created_at);
 					return true;
 				}
+				case "timings": {
+					// llama.cpp server: only cache_n is of interest
+					if (property_node.get_node_type() == Json.NodeType.OBJECT) {
+						var timings_cached = Usage.cached_from(property_node.get_object());
+						if (timings_cached > 0) {
+							this.cached_tokens = timings_cached;
+						}
+					}
+					value = Value(typeof(int));
+					value.set_int(0);
+					return true;
+				}
 				case "total_duration_s":
 				case "eval_duration_s":
 				case "tokens_per_second":
+				case "prefix-hit-ratio":
 					// Exclude computed properties from deserialization
 					value = Value(pspec.value_type);
 					return true;
@@ -295,6 +340,9 @@ namespace OLLMchat.Response
 			this.eval_duration = chunk.eval_duration;
 			this.prompt_eval_count = chunk.prompt_eval_count;
 			this.eval_count = chunk.eval_count;
+			if (chunk.cached_tokens > 0) {
+				this.cached_tokens = chunk.cached_tokens;
+			}
 			this.done = chunk.done;
 			this.done_reason = chunk.done_reason;
 			this.model = chunk.model;
@@ -98,6 +98,19 @@ namespace OLLMchat.Response
 		 */
 		public Usage? usage { get; set; default = null; }
 
+		/**
+		 * Prompt tokens the server took from its prefix cache: v1
+		 * usage.prompt_tokens_details.cached_tokens or llama.cpp
+		 * timings.cache_n. Zero when not reported (Ollama).
+		 */
+		public int cached_tokens { get; set; default = 0; }
+
+		/**
+		 * llama.cpp server timings object; only read for
+		 * {@link cached_tokens}. Not serialized.
+		 */
+		public Json.Object? timings { get; set; default = null; }
+
 		/**
 		 * Ollama chat: total request time in nanoseconds from the chunk.
 		 * Zero for APIs that do not send this field.
@@ -131,6 +144,7 @@ namespace OLLMchat.Response
 			switch (property_name) {
 				case "choices":
 				case "usage":
+				case "timings":
 					return null;
 				default:
 					return default_serialize_property(property_name, value, pspec);
@@ -145,8 +159,12 @@ namespace OLLMchat.Response
 					this.usage = Json.gobject_deserialize(
 						typeof(Usage), property_node) as Usage;
 					if (this.usage != null) {
+						this.usage.cached_tokens = Usage.cached_from(property_node.get_object());
 						this.prompt_eval_count = this.usage.prompt_tokens;
 						this.eval_count = this.usage.completion_tokens;
+						if (this.usage.cached_tokens > 0) {
+							this.cached_tokens = this.usage.cached_tokens;
+						}
 					}
 					value = Value(typeof(Usage));
 					value.set_object(this.usage);
@@ -195,6 +213,18 @@ namespace OLLMchat.Response
 					value.set_string(this.created_at);
 					return true;
 				}
+				case "timings": {
+					if (property_node.get_node_type() == Json.NodeType.OBJECT) {
+						this.timings = property_node.get_object();
+						var cached = Usage.cached_from(this.timings);
+						if (cached > 0) {
+							this.cached_tokens = cached;
+						}
+					}
+					value = Value(pspec.value_type);
+					value.set_boxed(this.timings);
+					return true;
+				}
 				default:
 					return default_deserialize_property(
 						property_name, out value, pspec, property_node);
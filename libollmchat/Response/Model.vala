@@ -178,6 +178,7 @@ namespace OLLMchat.Response
 		 *
 		 * Available from the show API (show_model() endpoint). This is typically found
 		 * in the model_info object as "{model_name}.context_length" in the API response.
+		 * From the ps() API it is the context the loaded model is running with.
 		 */
 		public int context_length { get; set; default = 0; }
 		/**
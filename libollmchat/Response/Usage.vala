@@ -28,6 +28,38 @@ namespace OLLMchat.Response
 		public int completion_tokens { get; set; default = 0; }
 		public int total_tokens { get; set; default = 0; }
 
+		/**
+		 * Prompt tokens served from the server's prefix (KV) cache.
+		 * Filled from usage.prompt_tokens_details.cached_tokens by the
+		 * response classes; zero when the server does not report it.
+		 */
+		public int cached_tokens { get; set; default = 0; }
+
+		/**
+		 * Cached prompt token count from a usage or llama.cpp timings object.
+		 *
+		 * Understands usage.prompt_tokens_details.cached_tokens (OpenAI, vLLM)
+		 * and timings.cache_n (llama.cpp server).
+		 *
+		 * @param obj usage or timings object from the response
+		 * @return cached token count, or 0 when absent
+		 */
+		public static int cached_from(Json.Object obj)
+		{
+			if (obj.has_member("cache_n")) {
+				return (int)obj.get_int_member("cache_n");
+			}
+			if (!obj.has_member("prompt_tokens_details")) {
+				return 0;
+			}
+			var details = obj.get_member("prompt_tokens_details");
+			if (details.get_node_type() != Json.NodeType.OBJECT
+				|| !details.get_object().has_member("cached_tokens")) {
+				return 0;
+			}
+			return (int)details.get_object().get_int_member("cached_tokens");
+		}
+
 		public override Json.Node serialize_property(string property_name, Value value, ParamSpec pspec)
 		{
 			return default_serialize_property(property_name, value, pspec);
@@ -513,27 +513,136 @@ namespace OLLMchat.Settings
 		}
 
 		/**
-		 * Checks version on all connections and updates is_working flag.
+		 * Seconds allowed for each connection probe in check_connections().
+		 */
+		public const uint PROBE_TIMEOUT = 5;
+
+		/** Caller of check_connections() waiting for the round already running. */
+		private class CheckWaiter
+		{
+			public GLib.SourceFunc? resume = null;
+		}
+
+		/* non-null while a check_connections() round has probes running */
+		private Gee.ArrayList<CheckWaiter>? check_waiters = null;
+		/* the running round has already let its callers go */
+		private bool check_answered = false;
+
+		/**
+		 * Checks all connections concurrently and updates is_working flag.
+		 *
+		 * Each connection keeps its previous is_working value until its own
+		 * probe finishes. Returns once the default connection has answered,
+		 * or once any connection works and the default (if any) has failed,
+		 * so startup waits for the fastest usable server rather than the
+		 * slowest one. Probes still running carry on in the background and
+		 * set is_working when they finish.
+		 *
+		 * Calls made while a round is running join it instead of probing
+		 * again: they return with the first caller, or at once when the
+		 * round has already answered.
 		 */
 		public async void check_connections()
 		{
-			foreach (var entry in this.connections.entries) {
-				var connection = entry.value;
-				// Test connection by calling models endpoint directly with short timeout
-				var original_timeout = connection.timeout;
-				connection.timeout = 5;  // 5 seconds - connection check should be quick
+			if (this.connections.size == 0) {
+				return;
+			}
+			if (this.check_waiters != null) {
+				if (this.check_answered) {
+					return;
+				}
+				var waiter = new CheckWaiter();
+				waiter.resume = this.check_connections.callback;
+				this.check_waiters.add(waiter);
+				yield;
+				return;
+			}
+			this.check_waiters = new Gee.ArrayList<CheckWaiter>();
+			this.check_answered = false;
+			var default_conn = this.default_connection();
+			var round = new Gee.ArrayList<Connection>();
+			round.add_all(this.connections.values);
+			var finished = new Gee.HashSet<Connection>();
+			var pending = round.size;
+			foreach (var connection in round) {
+				this.probe_connection.begin(connection, finished, (obj, res) => {
+					this.probe_connection.end(res);
+					pending--;
+					if (!this.check_answered
+						&& (pending == 0 || this.probe_usable(default_conn, finished))) {
+						this.check_answered = true;
+						GLib.Idle.add(this.check_connections.callback);
+						foreach (var waiter in this.check_waiters) {
+							GLib.Idle.add((owned) waiter.resume);
+						}
+						this.check_waiters.clear();
+					}
+					if (pending == 0) {
+						this.check_waiters = null;
+					}
+				});
+			}
+			yield;
+		}
+
+		/**
+		 * Whether check_connections() can return before all probes finish:
+		 * the default connection works, or it is missing or failed and
+		 * another connection works.
+		 *
+		 * @param finished connections probed in this round
+		 */
+		private bool probe_usable(Connection? default_conn, Gee.HashSet<Connection> finished)
+		{
+			if (default_conn != null && !finished.contains(default_conn)) {
+				return false;
+			}
+			if (default_conn != null && default_conn.is_working) {
+				return true;
+			}
+			foreach (var connection in finished) {
+				if (connection.is_working) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/**
+		 * Probe one connection with a short timeout: list models, then
+		 * detect the Ollama API. On success, cached model details are
+		 * loaded and a full model refresh starts in the background.
+		 * The connection is added to finished when the probe ends.
+		 */
+		private async void probe_connection(Connection connection, Gee.HashSet<Connection> finished)
+		{
+			// Test connection by calling models endpoint directly with short timeout
+			var original_timeout = connection.timeout;
+			connection.timeout = PROBE_TIMEOUT;
+			try {
+				var models_call = new OLLMchat.Call.Models(connection);
+				var models_list = yield models_call.exec_models();
+				connection.is_working = true;
+				yield connection.detect_ollama();
+				connection.models_from_cache(models_list);
+			} catch (Error e) {
+				connection.is_working = false;
+				GLib.debug("Connection %s is not working: %s", connection.url, e.message);
+			} finally {
+				connection.timeout = original_timeout;
+				connection.probed = true;
+				finished.add(connection);
+			}
+			if (!connection.is_working) {
+				return;
+			}
+			connection.load_models.begin((obj, res) => {
 				try {
-					var models_call = new OLLMchat.Call.Models(connection);
-					yield models_call.exec_models();
-					connection.is_working = true;
-					yield connection.detect_ollama();
+					connection.load_models.end(res);
 				} catch (Error e) {
-					connection.is_working = false;
-					GLib.debug("Connection %s is not working: %s", connection.url, e.message);
-				} finally {
-					connection.timeout = original_timeout;
+					GLib.debug("Connection %s: model refresh failed: %s", connection.url, e.message);
 				}
-			}
+			});
 		}
 
 		/**
@@ -66,6 +66,12 @@ namespace OLLMchat.Settings
 		 */
 		public bool is_working = true;
 
+		/**
+		 * Set once check_connections() has finished probing this connection.
+		 * Not saved to config.
+		 */
+		public bool probed = false;
+
 		/**
 		 * Ollama-native API support: -1 = not checked, 0 = no, 1 = yes.
 		 * Set once by detect_ollama() while still -1.
@@ -98,6 +104,15 @@ namespace OLLMchat.Settings
 			set { this.soup.timeout = value; }
 		}
 
+		/**
+		 * Admission control for requests to this endpoint.
+		 *
+		 * Caps concurrent requests and serves interactive calls ahead of
+		 * background ones (see {@link Call.Priority}).
+		 * Non-serialized field (runtime state, not saved to config).
+		 */
+		public Call.Scheduler scheduler;
+
 		/**
 		 * Models loaded from the server, keyed by model name.
 		 *
@@ -109,6 +124,21 @@ namespace OLLMchat.Settings
 		public Gee.HashMap<string, OLLMchat.Response.Model> models { get; private set; 
 			default = new Gee.HashMap<string, OLLMchat.Response.Model>(); }
 
+		/**
+		 * Show-model requests run at once by load_models().
+		 */
+		public const int SHOW_PARALLEL = 4;
+
+		/** Caller of load_models() waiting for the load already running. */
+		private class LoadWaiter
+		{
+			public GLib.SourceFunc? resume = null;
+		}
+
+		/* non-null while load_models() runs; later callers join it */
+		private Gee.ArrayList<LoadWaiter>? load_waiters = null;
+		private GLib.Error? load_error = null;
+
 		/**
 		 * Initializes runtime state (soup session).
 		 * 
@@ -119,7 +149,14 @@ namespace OLLMchat.Settings
 		 */
 		public void init()
 		{
-			this.soup = new Soup.Session();
+			this.scheduler = new Call.Scheduler();
+			// Keep-alive pool sized to the scheduler so queued requests reuse
+			// warm connections; libsoup negotiates HTTP/2 via ALPN on https.
+			this.soup = new Soup.Session.with_options(
+				"max-conns", this.scheduler.max_in_flight + 4,
+				"max-conns-per-host", this.scheduler.max_in_flight + 2,
+				"idle-timeout", 60u
+			);
 			this.timeout = 300; // Default timeout
 		
 		}
@@ -236,53 +273,137 @@ namespace OLLMchat.Settings
 			}
 		}
 
+		/**
+		 * Fills models from the on-disk model cache for listed models not
+		 * loaded yet, without any request.
+		 *
+		 * Lets the UI render models straight after the connection probe
+		 * while load_models() refreshes details in the background.
+		 *
+		 * @param models_list models from the list API
+		 */
+		public void models_from_cache(Gee.ArrayList<OLLMchat.Response.Model> models_list)
+		{
+			foreach (var model in models_list) {
+				model.connection = this;
+				if (this.models.has_key(model.name)) {
+					this.models.get(model.name).connection = this;
+					continue;
+				}
+				var cached_model = model.load_from_cache();
+				if (cached_model != null) {
+					cached_model.connection = this;
+					this.models.set(model.name, cached_model);
+				}
+			}
+		}
+
 		/**
 		 * Loads all available models from the server and stores them in models.
 		 *
 		 * Fetches the list of models, then gets detailed information for each model
 		 * including capabilities. Results are stored in models HashMap.
 		 *
-		 * Replicates the original Client.fetch_all_model_details() behavior:
-		 * calls models() API, then show_model() for each model.
+		 * Details come from the in-memory or file cache while the digest
+		 * reported by the list API matches the cached one; new and changed
+		 * models are fetched with show_model(), up to {@link SHOW_PARALLEL}
+		 * at a time. A stale entry stays in models until its replacement
+		 * arrives.
 		 *
-		 * Note: This method does not refresh model details for models that are already
-		 * cached (in-memory or file cache). It only fetches details for new models that
-		 * are not yet cached. This functionality may be needed in the future to refresh
-		 * cached models with updated server data, but is not currently implemented.
+		 * Concurrent calls share one load: later callers wait for the
+		 * running one and get its result.
 		 *
 		 * @since 1.2.7.11
 		 */
 		public async void load_models() throws Error
+		{
+			if (this.load_waiters != null) {
+				var waiter = new LoadWaiter();
+				waiter.resume = this.load_models.callback;
+				this.load_waiters.add(waiter);
+				yield;
+				if (this.load_error != null) {
+					throw this.load_error.copy();
+				}
+				return;
+			}
+			this.load_waiters = new Gee.ArrayList<LoadWaiter>();
+			this.load_error = null;
+			try {
+				yield this.load_models_run();
+			} catch (Error e) {
+				this.load_error = e.copy();
+			}
+			var waiters = this.load_waiters;
+			this.load_waiters = null;
+			foreach (var waiter in waiters) {
+				GLib.Idle.add((owned) waiter.resume);
+			}
+			if (this.load_error != null) {
+				throw this.load_error.copy();
+			}
+		}
+
+		private async void load_models_run() throws Error
 		{
 			// Create a temporary client to use its methods (which don't store state anymore)
 			var client = new OLLMchat.Client(this);
 			
 			// Get list of models from API (replicates original: yield this.models())
 			var models_list = yield client.models();
+			this.models_from_cache(models_list);
 			
 			// Track which models are still available
 			var current_model_names = new Gee.HashSet<string>();
 			
-			// For each model, get detailed information including capabilities
-			// Replicates original: yield this.show_model(model.name) for each
+			// Models with no cached details, or whose digest changed
+			var to_fetch = new Gee.ArrayQueue<OLLMchat.Response.Model>();
 			foreach (var model in models_list) {
 				current_model_names.add(model.name);
-				model.connection = this;
-
-				// Skip if model already exists in cache
-				if (this.models.has_key(model.name)) {
-					this.models.get(model.name).connection = this;
+				var cached_model = this.models.get(model.name);
+				if (cached_model != null
+					&& (model.digest == "" || cached_model.digest == model.digest)) {
 					continue;
 				}
+				to_fetch.offer(model);
+			}
 
-				// Try to load from file cache
-				var cached_model = model.load_from_cache();
-				if (cached_model != null) {
-					cached_model.connection = this;
-					this.models.set(model.name, cached_model);
-					continue;
+			var workers = int.min(SHOW_PARALLEL, to_fetch.size);
+			if (workers > 0) {
+				GLib.debug("Connection %s: fetching details for %d models",
+					this.url, to_fetch.size);
+				var running = workers;
+				for (var i = 0; i < workers; i++) {
+					this.show_worker.begin(to_fetch, (obj, res) => {
+						this.show_worker.end(res);
+						running--;
+						if (running == 0) {
+							GLib.Idle.add(this.load_models_run.callback);
+						}
+					});
 				}
+				yield;
+			}
+			
+			// Remove old models from cache that are no longer in the list
+			var models_to_remove = new Gee.ArrayList<string>();
+			foreach (var model_name in this.models.keys) {
+				if (!current_model_names.contains(model_name)) {
+					models_to_remove.add(model_name);
+				}
+			}
+			foreach (var model_name in models_to_remove) {
+				this.models.unset(model_name);
+			}
+		}
 
+		/**
+		 * Fetch show-model details for queued models until the queue is empty.
+		 */
+		private async void show_worker(Gee.ArrayQueue<OLLMchat.Response.Model> queue)
+		{
+			while (!queue.is_empty) {
+				var model = queue.poll();
 				// Fetch from API (only this part needs error handling)
 				try {
 					var show_call = new OLLMchat.Call.ShowModel(this, model.name);
@@ -299,20 +420,9 @@ namespace OLLMchat.Settings
 					this.models.set(model.name, detailed_model);
 				} catch (Error e) {
 					GLib.warning("Failed to get details for model %s: %s", model.name, e.message);
-					// Skip this model on error
-				}
-			}
-			
-			// Remove old models from cache that are no longer in the list
-			var models_to_remove = new Gee.ArrayList<string>();
-			foreach (var model_name in this.models.keys) {
-				if (!current_model_names.contains(model_name)) {
-					models_to_remove.add(model_name);
+					// Skip this model on error (a stale cached entry is kept)
 				}
 			}
-			foreach (var model_name in models_to_remove) {
-				this.models.unset(model_name);
-			}
 		}
 	}
 }
@@ -133,14 +133,23 @@ namespace OLLMchat.Settings
 			return default_deserialize_property(property_name, out value, pspec, property_node);
 		}
 		
+		/**
+		 * Context size in tokens: options.num_ctx when set, else
+		 * model_obj.context_length, else 0 (unknown).
+		 */
+		public int context_tokens()
+		{
+			return this.options.num_ctx > 0 ? this.options.num_ctx :
+				(this.model_obj != null && this.model_obj.context_length > 0) ? this.model_obj.context_length : 0;
+		}
+
 		/**
 		 * Returns a pretty string for context size (e.g. "128K ctx"), or "" if none.
-		 * Uses options.num_ctx when set, else model_obj.context_length.
+		 * Uses {@link context_tokens}.
 		 */
 		public string context_size()
 		{
-			int ctx = this.options.num_ctx > 0 ? this.options.num_ctx :
-				(this.model_obj != null && this.model_obj.context_length > 0) ? this.model_obj.context_length : 0;
+			int ctx = this.context_tokens();
 			return ctx <= 0 ? "" : "%dK ctx".printf(ctx / 1024);
 		}
 
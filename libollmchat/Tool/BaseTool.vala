@@ -134,9 +134,27 @@ namespace OLLMchat.Tool
 		 * from a .tool definition file and should use wrapped tool execution flow.
 		 */
 		public bool is_wrapped { get; set; default = false; }
-
-		public RequestBase? last_request { get; set; default = null; }
 		
+		/**
+		 * Whether calls to this tool may run alongside other tool calls in the same turn.
+		 * 
+		 * Read-only tools (reading files, searching, fetching pages) override this
+		 * to return true. Tools that write files, run commands or otherwise have
+		 * side effects keep the default and are executed on their own by
+		 * {@link Agent.Base.execute_tools}. Wrapped tools always run on their own
+		 * since they execute a command template.
+		 */
+		public virtual bool parallel_safe { get { return false; } }
+
+		/**
+		 * Whether calls to this tool may be started while the reply that
+		 * requests them is still streaming (see {@link Agent.Prefetch}).
+		 *
+		 * Only for idempotent read-only tools whose result does not depend
+		 * on anything the rest of the reply could change.
+		 */
+		public virtual bool prefetch_safe { get { return false; } }
+
 		/**
 		 * Command template for wrapped tools.
 		 * 
@@ -245,6 +263,23 @@ namespace OLLMchat.Tool
 			Call.ChatBase chat_call, 
 			Response.ToolCall tool_call, 
 			bool is_markdown = false)
+		{
+			return yield this.execute_as(chat_call, tool_call, chat_call.agent);
+		}
+
+		/**
+		 * Runs a tool call with the given agent interface set on the request
+		 * (e.g. an {@link Agent.Prefetch} that holds UI messages back).
+		 *
+		 * @param chat_call The chat call context for this tool execution
+		 * @param tool_call The tool call object containing id, function name, and arguments
+		 * @param agent Agent interface the request reports to
+		 * @return String result or error message (prefixed with "ERROR: " for errors)
+		 */
+		public async string execute_as(
+			Call.ChatBase chat_call,
+			Response.ToolCall tool_call,
+			Agent.Interface agent)
 		{
 			// Convert parameters Json.Object to Json.Node for deserialization
 			var parameters_node = new Json.Node(Json.NodeType.OBJECT);
@@ -272,13 +307,12 @@ namespace OLLMchat.Tool
 			// Set tool and agent (not in JSON, set after deserialization)
 			request.tool = this;
 			// Set agent property (from chat_call, set after deserialization)
-			request.agent = chat_call.agent;
+			request.agent = agent;
 			
 			// request_id is auto-generated via default value in RequestBase
 			// Register for monitoring (works for both Agent.Base and dummy agents)
 			// Interface methods have default no-op implementations
 			request.agent.register_tool_monitoring(request.request_id, request);
-			this.last_request = request;
 
 			return yield request.execute();
 		}
@@ -95,6 +95,13 @@ namespace OLLMchat.Tool
 		 */
 		public bool is_wrapped { get; set; default = false; }
 		
+		/**
+		 * Set when a speculative run ({@link Agent.Interface.is_speculative})
+		 * stopped before a permission prompt; the result is empty and the
+		 * call must be run again for real. Plain field, not serialized.
+		 */
+		public bool deferred = false;
+		
 		/**
 		 * Default constructor.
 		 * Request objects are created via Json.gobject_deserialize from parameters JSON.
@@ -193,6 +200,12 @@ namespace OLLMchat.Tool
 				GLib.debug("RequestBase.execute: Tool '%s' using permission_provider=%p (%s) from Manager", 
 				this.tool.name, permission_provider, permission_provider.get_type().name());
 				
+				if (this.agent.is_speculative() && !permission_provider.has_answer(this)) {
+					// Never prompt for a prefetch; the real call asks
+					GLib.debug("RequestBase.execute: Tool '%s' deferred until the call is confirmed", this.tool.name);
+					this.deferred = true;
+					return "";
+				}
 				if (!(yield permission_provider.request(this))) {
 					GLib.debug("RequestBase.execute: Permission denied for tool '%s'", this.tool.name);
 					return "ERROR: Permission denied: " + this.permission_question;
@@ -70,6 +70,39 @@ namespace OLLMchatGtk
 		private bool programmatic_scroll_in_progress = false;
 		/** Current thinking child frame (when streaming thinking into a framed box). */
 		private MarkdownGtk.RenderSourceView? thinking_frame = null;
+		/** True while a scroll_to_bottom idle is queued; further calls are folded into it. */
+		private bool scroll_queued = false;
+		/** Backup scroll timeout id (one at a time). */
+		private uint scroll_backup_timer = 0;
+		/** Pending {@link update_parked_rows} timeout (debounces scroll events). */
+		private uint park_timer = 0;
+		/** Rows [live_first, live_last] were left unparked by the last {@link update_parked_rows}. */
+		private int live_first = 0;
+		private int live_last = -1;
+		/** Rows from here up were not yet finished at the last {@link update_parked_rows}. */
+		private int park_limit = 0;
+		/** render_box width the current placeholders were measured at. */
+		private int park_width = 0;
+		/**
+		 * Parsed assistant content keyed by an MD5 of the markdown, so
+		 * showing a session again (switching back, clear and reload) replays
+		 * the document instead of parsing every message. Keyed by content,
+		 * not by {@link OLLMchat.Message}: ChatWidget wraps each message in a
+		 * new one for display, and the cache must not keep messages alive.
+		 */
+		private Gee.HashMap<string, DocEntry> doc_cache =
+			new Gee.HashMap<string, DocEntry>();
+		/** {@link doc_cache} drops its least recently used entry past this many. */
+		private const int DOC_CACHE_MAX = 2000;
+		/** Bumped on every {@link doc_cache} hit or insert, see {@link DocEntry.used}. */
+		private int64 doc_cache_clock = 0;
+
+		private class DocEntry
+		{
+			public Markdown.Document.Document doc;
+			/** doc_cache_clock at the last use. */
+			public int64 used;
+		}
 
 		/**
 		 * Creates a new ChatView instance.
@@ -106,8 +139,13 @@ namespace OLLMchatGtk
 			this.text_view_box.append(this.render_box);
 			// Create single Render instance for assistant messages (uses render_box)
 			this.renderer = new MarkdownGtk.Render(this.render_box) {
-				scroll_to_end = this.scroll_enabled
+				scroll_to_end = this.scroll_enabled,
+				coalesce = true
 			};
+			// Streamed text is rendered once per frame; follow it down when it lands
+			this.renderer.frame_rendered.connect(() => {
+				this.scroll_to_bottom();
+			});
 
 			this.renderer.link_clicked.connect((href, title) => {
 				if (!href.has_prefix("http://") && !href.has_prefix("https://")) {
@@ -166,6 +204,7 @@ namespace OLLMchatGtk
 						vadj.upper,
 						vadj.page_size); */
 					this.programmatic_scroll_in_progress = false;
+					this.queue_park_update();
 					return;
 				}
 				/* GLib.debug(
@@ -175,9 +214,113 @@ namespace OLLMchatGtk
 					vadj.page_size); */
 				// within a few px of bottom = "at bottom" → resume autoscroll; else pause (small scroll up = pause)
 				this.autoscroll_paused_by_user = (vadj.value < vadj.upper - vadj.page_size - 3.0);
+				this.queue_park_update();
+			});
+			// the viewport width changed: parked heights are stale (see update_parked_rows)
+			this.scrolled_window.hadjustment.notify["page-size"].connect(() => {
+				if (this.render_box.n_parked > 0) {
+					this.queue_park_update();
+				}
+			});
+		}
+
+		/**
+		 * Schedule {@link update_parked_rows} once scrolling settles.
+		 */
+		private void queue_park_update()
+		{
+			if (this.park_timer != 0) {
+				GLib.Source.remove(this.park_timer);
+			}
+			this.park_timer = GLib.Timeout.add(150, () => {
+				this.park_timer = 0;
+				this.update_parked_rows();
+				return false;
 			});
 		}
 
+		/**
+		 * Top of a row in text_view_box coordinates (same space as the vadjustment),
+		 * or -1 when the row has no allocation yet.
+		 */
+		private double row_top(int id)
+		{
+			Graphene.Rect bounds;
+			if (!this.render_box.row(id).compute_bounds(this.text_view_box, out bounds)) {
+				return -1.0;
+			}
+			return bounds.origin.y;
+		}
+
+		/**
+		 * Park finished rows more than one page away from the viewport and
+		 * unpark the ones that came back into range.
+		 *
+		 * Only the previously live window and rows finished since the last
+		 * pass are touched, and the first visible row is found by binary
+		 * search, so the cost depends on the viewport, not the session length.
+		 * Rows of the message currently being rendered are never parked.
+		 *
+		 * Placeholder heights only hold for the width they were measured at;
+		 * after a resize every row is shown again and parked on the next
+		 * pass, once it has been laid out at the new width.
+		 */
+		private void update_parked_rows()
+		{
+			var vadj = this.scrolled_window.vadjustment;
+			var limit = int.min(this.render_box.first_id, this.render_box.by_id.size - 1);
+			if (vadj == null || limit <= 0 || vadj.page_size <= 0) {
+				return;
+			}
+			var width = this.render_box.get_width();
+			if (width != this.park_width && this.render_box.n_parked > 0) {
+				this.render_box.unpark_all();
+				this.live_first = 0;
+				this.live_last = this.park_limit - 1;
+				this.park_width = width;
+				this.queue_park_update();
+				return;
+			}
+			this.park_width = width;
+			var top = vadj.value - vadj.page_size;
+			var bottom = vadj.value + 2 * vadj.page_size;
+
+			// first row whose top is past the margin above the viewport; step back one so it covers top
+			var lo = 0;
+			var hi = limit;
+			while (lo < hi) {
+				var mid = (lo + hi) / 2;
+				if (this.row_top(mid) < top) {
+					lo = mid + 1;
+				} else {
+					hi = mid;
+				}
+			}
+			var first = int.max(0, lo - 1);
+			var last = first;
+			while (last + 1 < limit && this.row_top(last + 1) < bottom) {
+				last++;
+			}
+
+			// rows that may currently be unparked: old live window + rows finished since last pass
+			for (var id = this.live_first; id <= this.live_last && id < limit; id++) {
+				if (id < first || id > last) {
+					this.render_box.park(id);
+				}
+			}
+			for (var id = int.min(this.park_limit, limit); id < limit; id++) {
+				if (id < first || id > last) {
+					this.render_box.park(id);
+				}
+			}
+			for (var id = first; id <= last; id++) {
+				this.render_box.unpark(id);
+			}
+			this.live_first = first;
+			this.live_last = last;
+			this.park_limit = limit;
+		}
+
 		/**
 		 * Appends a streaming chunk from the assistant.
 		 * 
@@ -630,10 +773,10 @@ namespace OLLMchatGtk
 				}
 			}
 
-			// Process regular content
+			// Process regular content (complete, so draw it from the cached document)
 			if (message.content != "") {
 				this.is_thinking = false;
-				this.process_new_chunk_direct(message.content, false);  // false = is_thinking
+				this.append_content_document(message);
 			}
 
 			/* GLib.debug(
@@ -654,6 +797,49 @@ namespace OLLMchatGtk
 			return this.render_box.last_id;
 		}
 
+		/**
+		 * Draws complete message content from its parsed document, parsing
+		 * only the first time the message is shown (see {@link doc_cache}).
+		 * Leaves the content block open for finalize_assistant_message_direct().
+		 */
+		private void append_content_document(OLLMchat.Message message)
+		{
+			var key = GLib.Checksum.compute_for_string(GLib.ChecksumType.MD5, message.content);
+			var entry = this.doc_cache.get(key);
+			if (entry == null) {
+				var parsed = new Markdown.Document.Render();
+				parsed.parse(message.content);
+				if (this.doc_cache.size >= DOC_CACHE_MAX) {
+					this.evict_doc();
+				}
+				entry = new DocEntry() {
+					doc = parsed.document
+				};
+				this.doc_cache.set(key, entry);
+			}
+			entry.used = ++this.doc_cache_clock;
+			this.content_state = ContentState.CONTENT;
+			this.start_block_direct(false);
+			this.renderer.render_document(entry.doc);
+			this.last_line = "";
+		}
+
+		/** Drop the least recently used {@link doc_cache} entry. */
+		private void evict_doc()
+		{
+			string? oldest = null;
+			int64 oldest_used = int64.MAX;
+			foreach (var e in this.doc_cache.entries) {
+				if (e.value.used < oldest_used) {
+					oldest = e.key;
+					oldest_used = e.value.used;
+				}
+			}
+			if (oldest != null) {
+				this.doc_cache.unset(oldest);
+			}
+		}
+
 		/**
 		 * Clears all content from the chat view.
 		 * 
@@ -682,6 +868,15 @@ namespace OLLMchatGtk
 				children = next;
 			}
 
+			if (this.park_timer != 0) {
+				GLib.Source.remove(this.park_timer);
+				this.park_timer = 0;
+			}
+			this.live_first = 0;
+			this.live_last = -1;
+			this.park_limit = 0;
+			this.park_width = 0;
+
 			this.render_box = new MarkdownGtk.RenderBox();
 			this.text_view_box.append(this.render_box);
 			this.renderer.disconnect_box();
@@ -849,11 +1044,18 @@ namespace OLLMchatGtk
 				return;
 			}
 			
+			// Streaming calls this per chunk; one queued scroll covers them all
+			if (this.scroll_queued) {
+				return;
+			}
+			this.scroll_queued = true;
+			
 			// Use Idle to scroll after layout is updated, with retry logic
 			GLib.Idle.add(() => {
 				// Check if scrolling is still enabled (might have been disabled during loading)
 				if (!this.scroll_enabled || this.autoscroll_paused_by_user) {
 					/* GLib.debug("scroll_to_bottom idle skip"); */
+					this.scroll_queued = false;
 					return false;
 				}
 				
@@ -862,6 +1064,7 @@ namespace OLLMchatGtk
 				
 				if (vadjustment == null) {
 					//GLib.debug("ChatView: scroll_to_bottom: vadjustment is null");
+					this.scroll_queued = false;
 					return false;
 				}
 				
@@ -869,8 +1072,10 @@ namespace OLLMchatGtk
 				// If upper is 0 or very small, layout might not be complete yet
 				if (vadjustment.upper < 100.0) {
 					// Layout not ready yet, try again on next idle (but only if scrolling is still enabled)
-					return this.scroll_enabled && !this.autoscroll_paused_by_user;
+					this.scroll_queued = this.scroll_enabled && !this.autoscroll_paused_by_user;
+					return this.scroll_queued;
 				}
+				this.scroll_queued = false;
 				
 				// Mark as programmatic so the value_changed handler does not set autoscroll_paused_by_user
 				this.programmatic_scroll_in_progress = true;
@@ -884,7 +1089,11 @@ namespace OLLMchatGtk
 				this.last_scroll_pos = vadjustment.upper + 1000.0;
 				
 				// Also use a timeout as backup in case Idle doesn't catch all layout updates
-				GLib.Timeout.add(100, () => {
+				if (this.scroll_backup_timer != 0) {
+					return false;
+				}
+				this.scroll_backup_timer = GLib.Timeout.add(100, () => {
+					this.scroll_backup_timer = 0;
 					// Check if scrolling is still enabled (might have been disabled during loading)
 					if (!this.scroll_enabled || this.autoscroll_paused_by_user) {
 						return false;
@@ -926,14 +1135,14 @@ namespace OLLMchatGtk
 					return true;
 				}
 				var t = idx;
-				var w = this.render_box.by_id.get(t);
+				var w = this.render_box.row(t);
 				var dx = 0.0;
 				var y = 0.0;
 				while (t > idx - 4 && t > -1 && w != null
 						&& !w.translate_coordinates(this.text_view_box,
 							 0, 0, out dx, out y)) {
 					w = (t > idx - 3) && (t > 0) ?
-						 this.render_box.by_id.get(--t) : null;
+						 this.render_box.row(--t) : null;
 				}
 				if (w == null) {
 					/* GLib.debug(
@@ -1149,7 +1358,8 @@ namespace OLLMchatGtk
 			// Track this frame for width updates
 			this.widgets.add(frame);
 			
-			// Add frame directly to renderer.box
+			// Add frame directly to renderer.box (after any text still queued for the next frame)
+			this.renderer.render_pending();
 			this.renderer.box.appender(frame);
 			
 			frame.set_visible(true);
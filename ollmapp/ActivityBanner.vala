@@ -264,6 +264,30 @@ namespace OLLMapp
 					this.hide();
 					break;
 
+				case "event.run_command.start":
+					this.label.label = "Running: %s".printf(notif.message);
+					this.progress_bar.fraction = 0.0;
+					this.show();
+					break;
+
+				case "event.run_command.output":
+					// one line per update (rate-limited by the tool); keep the banner one row high
+					var out_line = notif.message.strip();
+					if (out_line.char_count() > 120) {
+						out_line = out_line.substring(0, out_line.index_of_nth_char(120)) + "…";
+					}
+					this.label.label = "%lld lines — %s".printf(
+						notif.progress_completed, out_line);
+					this.progress_bar.pulse();
+					this.show();
+					break;
+
+				case "event.run_command.end":
+					this.label.label = "Finished: %s".printf(notif.message);
+					this.progress_bar.fraction = 1.0;
+					this.hide();
+					break;
+
 				default:
 					break;
 			}
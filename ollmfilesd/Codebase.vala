@@ -19,8 +19,9 @@
 namespace OLLMfilesd
 {
 	/**
-	 * Server ''Codebase.*'' wire handlers — vector search, per-file metadata,
-	 * debug embedding dump, database reset, and background index queue control.
+	 * Server ''Codebase.*'' wire handlers — vector search, per-file metadata
+	 * and outlines, symbol and call-site lookup, debug embedding dump,
+	 * database reset, and background index queue control.
 	 *
 	 * Registered once in {@link OllmfilesdApplication}; params are
 	 * {@link VectorParams}. See {@link OLLMrpc.Request.dispatch} for signal
@@ -36,6 +37,9 @@ namespace OLLMfilesd
 		public ProjectManager manager { get; construct; }
 		public OLLMchat.Settings.Config2 config { get; construct; }
 
+		/** Stale files re-parsed before a symbol lookup; more run in the background. */
+		private const int SYMBOLS_INLINE_REFRESH = 20;
+
 		private static string[] VALID_CATEGORIES = {
 			"plan",
 			"documentation",
@@ -81,6 +85,20 @@ namespace OLLMfilesd
 		 */
 		public signal void call_file_info(OLLMrpc.Request request);
 
+		/**
+		 * ''Codebase.outline'' — markdown outline of one file (''read_file''
+		 * summary mode), served from {@link ProjectManager.outline_factory}.
+		 *
+		 * Params: {@link VectorParams.file_path}; {@link VectorParams.language}
+		 * for files outside the active project; ''format=lines'' for line
+		 * ranges instead of AST paths. Reply: ''msg'' with the outline.
+		 *
+		 *  * Read / parse failure → ''response.error''
+		 *
+		 * @param request inbound RPC; {@link VectorParams} on {@link OLLMrpc.Request.param}
+		 */
+		public signal void call_outline(OLLMrpc.Request request);
+
 		/**
 		 * ''Codebase.debug_get'' — dump stored FAISS embedding for one AST path.
 		 *
@@ -126,6 +144,32 @@ namespace OLLMfilesd
 		 */
 		public signal void call_stop(OLLMrpc.Request request);
 
+		/**
+		 * ''Codebase.symbols'' — definitions from the {@link Vector.SymbolIndex}.
+		 *
+		 * Params: {@link VectorParams.query} (''parse'' or ''Tree.parse''),
+		 * optional {@link VectorParams.element_type}, {@link VectorParams.max_results}
+		 * (default 50); with {@link VectorParams.file_path} instead, the outline
+		 * of that file. Reply ''msg'': one {@link SQT.CodeSymbol.to_line} per
+		 * line, or a JSON array when ''format=json''. No embedding or LLM call.
+		 *
+		 *  * No active project → ''response.error''
+		 *  * No match → empty ''msg''
+		 *
+		 * @param request inbound RPC; {@link VectorParams} on {@link OLLMrpc.Request.param}
+		 */
+		public signal void call_symbols(OLLMrpc.Request request);
+
+		/**
+		 * ''Codebase.references'' — call sites of {@link VectorParams.query},
+		 * with the calling method, from the {@link Vector.SymbolIndex}.
+		 *
+		 * Same params and reply as ''Codebase.symbols'' (default limit 100).
+		 *
+		 * @param request inbound RPC; {@link VectorParams} on {@link OLLMrpc.Request.param}
+		 */
+		public signal void call_references(OLLMrpc.Request request);
+
 		construct
 		{
 			this.call_reset.connect((request) => {
@@ -134,6 +178,9 @@ namespace OLLMfilesd
 						this.manager.db,
 						this.manager.vector_db_path
 					);
+					if (this.manager.symbol_index != null) {
+						this.manager.symbol_index.reset();
+					}
 				} catch (GLib.Error e) {
 					request.reply(new OLLMrpc.Response() {
 						id = request.id,
@@ -192,11 +239,49 @@ namespace OLLMfilesd
 					msg = list.size.to_string()
 				});
 			});
+			this.call_outline.connect((request) => {
+				var p = (VectorParams) request.param;
+				var file = this.manager.get_file_from_active_project(p.file_path);
+				if (file == null) {
+					file = new File(this.manager) {
+						path = p.file_path,
+						id = -1,
+						language = p.language
+					};
+				}
+				var outline = this.manager.outline_factory(file);
+				outline.get_outline.begin(p.format == "lines", (obj, res) => {
+					try {
+						request.reply(new OLLMrpc.Response() {
+							id = request.id,
+							msg = outline.get_outline.end(res)
+						});
+					} catch (GLib.Error e) {
+						request.reply(new OLLMrpc.Response() {
+							id = request.id,
+							error = new OLLMrpc.Error(
+								OLLMrpc.RpcErrorCode.INTERNAL_ERROR,
+								e.message
+							)
+						});
+					}
+				});
+			});
 			this.call_search.connect((request) => {
 				this.search.begin(request, (obj, res) => {
 					this.search.end(res);
 				});
 			});
+			this.call_symbols.connect((request) => {
+				this.symbols.begin(request, false, (obj, res) => {
+					this.symbols.end(res);
+				});
+			});
+			this.call_references.connect((request) => {
+				this.symbols.begin(request, true, (obj, res) => {
+					this.symbols.end(res);
+				});
+			});
 			this.call_stop.connect((request) => {
 				this.manager.vector_scan.stop_requested = true;
 				request.reply(new OLLMrpc.Response() {
@@ -489,6 +574,87 @@ namespace OLLMfilesd
 			return generator.to_data(null);
 		}
 
+		/**
+		 * ''Codebase.symbols'' / ''Codebase.references'' handler — answer
+		 * from the symbol index.
+		 *
+		 * A few stale files (the usual case after edits) are re-parsed
+		 * before the lookup. With more than {@link SYMBOLS_INLINE_REFRESH}
+		 * (index not built yet) the refresh runs in the background, shared
+		 * with other callers, and the reply comes from what is indexed so far.
+		 *
+		 * @param request inbound RPC; {@link VectorParams} on {@link OLLMrpc.Request.param}
+		 * @param references true for call sites, false for definitions
+		 */
+		private async void symbols(OLLMrpc.Request request, bool references)
+		{
+			var p = (VectorParams) request.param;
+			var project = this.manager.project_root(p.path);
+			if (project == null || this.manager.symbol_index == null) {
+				request.reply(new OLLMrpc.Response() {
+					id = request.id,
+					error = new OLLMrpc.Error(
+						OLLMrpc.RpcErrorCode.INTERNAL_ERROR,
+						"No active project. Please open a project first."
+					)
+				});
+				return;
+			}
+			if (project.project_files.get_n_items() == 0) {
+				yield project.load_files_from_db();
+			}
+			var index = this.manager.symbol_index;
+			var pending = index.stale_files(project).size;
+			if (pending <= SYMBOLS_INLINE_REFRESH) {
+				yield index.refresh(project);
+				pending = 0;
+			} else if (!index.is_refreshing) {
+				index.refresh.begin(project);
+			}
+
+			Gee.ArrayList<SQT.CodeSymbol> rows;
+			if (!references && p.file_path != "") {
+				// resolve in the project that owns p.path, not the active one
+				var project_file = project.project_files.child_map.get(p.file_path);
+				rows = project_file != null && project_file.file.id > 0
+					? index.outline(project_file.file.id)
+					: new Gee.ArrayList<SQT.CodeSymbol>();
+			} else {
+				var file_ids = project.project_files.get_ids(p.language);
+				if (p.query.strip() == "" || file_ids.size == 0) {
+					rows = new Gee.ArrayList<SQT.CodeSymbol>();
+				} else if (references) {
+					rows = index.references(p.query, file_ids,
+						p.max_results > 0 ? p.max_results : 100);
+				} else {
+					rows = index.definitions(p.query, file_ids, p.element_type,
+						p.max_results > 0 ? p.max_results : 50);
+				}
+			}
+
+			var msg = "";
+			if (p.format == "json") {
+				var arr = new Json.Array();
+				foreach (var row in rows) {
+					arr.add_element(row.to_json());
+				}
+				var root = new Json.Node(Json.NodeType.ARRAY);
+				root.set_array(arr);
+				msg = Json.to_string(root, false);
+			} else {
+				foreach (var row in rows) {
+					msg += row.to_line() + "\n";
+				}
+				if (pending > 0) {
+					msg += "(symbol index still building: %d files not indexed yet)\n".printf(pending);
+				}
+			}
+			request.reply(new OLLMrpc.Response() {
+				id = request.id,
+				msg = msg
+			});
+		}
+
 		/**
 		 * ''Codebase.debug_get'' handler — resolve ''ast_path'' to
 		 * ''vector_id'', reconstruct from FAISS, reply one float per line in
@@ -55,6 +55,9 @@ namespace OLLMfilesd
 				if (this.manager.db != null) {
 					OLLMvector2.SQT.VectorMetadata.cleanup_all_deleted.begin(
 						this.manager.db);
+					if (this.manager.symbol_index != null) {
+						this.manager.symbol_index.prune();
+					}
 				}
 			});
 		}
@@ -126,6 +129,7 @@ namespace OLLMfilesd
 			// so the deletion is at least partially tracked
 			filebase.delete_id = history.id;
 			filebase.saveToDB(this.manager.db, null, false);
+			this.manager.outline_cache.unset(filebase.path);
 			
 			// Note: Signal emission happens during cleanup 
 			//  (in ProjectFiles.cleanup_deleted() / FolderFiles.cleanup_deleted())
@@ -48,6 +48,9 @@ namespace OLLMfilesd
 		 */
 		public static bool background_recurse { get; set; default = true; }
 
+		/** Largest page {@link FolderParams.limit} may ask fetch_files for. */
+		private const int FETCH_FILES_MAX_LIMIT = 500;
+
 		/**
 		 * ListStore of all files in project (used by dropdowns).
 		 */
@@ -205,27 +208,22 @@ namespace OLLMfilesd
 					});
 					return;
 				}
-				p.limit = p.limit < 1 ? 50 : p.limit;
-				p.offset = p.offset < 0 ? 0 : p.offset;
-				var matched = project.project_files.cached_search(
-					p.query.strip().down()
+				// the search keeps offset + limit rows, so neither may be client sized
+				p.limit = p.limit < 1 ? 50 : int.min(p.limit, FETCH_FILES_MAX_LIMIT);
+				p.offset = p.offset.clamp(0, project.project_files.all_files.size);
+				int total;
+				var matched = project.project_files.search(
+					p.query.strip().down(),
+					p.offset,
+					p.limit,
+					out total
 				);
 				var list = new Gee.ArrayList<GLib.Object>();
-				if (p.offset < matched.size) {
-					list.add_all(
-						matched.slice(
-							p.offset,
-							int.min(
-								p.limit,
-								matched.size - p.offset
-							)
-						)
-					);
-				}
+				list.add_all(matched);
 				request.reply(new OLLMrpc.Response() {
 					id = request.id,
 					result = list,
-					msg = matched.size.to_string()
+					msg = total.to_string()
 				});
 			});
 			this.call_fetch_pending_approvals.connect((request) => {
@@ -0,0 +1,334 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+namespace OLLMfilesd
+{
+	/**
+	 * Cached markdown outline of a file (''read_file'' summary mode).
+	 *
+	 * One instance per path via {@link ProjectManager.outline_factory}.
+	 * Both forms (AST paths and line numbers) are built in a single
+	 * tree-sitter pass together with the vector descriptions of the file,
+	 * and kept until the file's mtime or {@link File.last_vector_scan}
+	 * moves on, or {@link needs_reparse} is set by a content change.
+	 * Served by ''Codebase.outline''.
+	 */
+	public class Outline : TreeBase
+	{
+		/**
+		 * Indentation step (spaces per level).
+		 */
+		private const int INDENT_STEP = 3;
+		
+		/**
+		 * File mtime the cached outline was built from (0 = not built).
+		 */
+		public int64 last_parsed { get; private set; default = 0; }
+		
+		/**
+		 * {@link File.last_vector_scan} when built; descriptions change with it.
+		 */
+		public int64 last_vector_scan { get; private set; default = 0; }
+		
+		/**
+		 * Set when file content changed, to rebuild even if the mtime did not move.
+		 */
+		public bool needs_reparse { get; set; default = false; }
+		
+		/**
+		 * Outline with AST paths.
+		 */
+		private string ast_output = "";
+		
+		/**
+		 * Outline with line ranges.
+		 */
+		private string lines_output = "";
+		
+		/**
+		 * Current indentation level.
+		 */
+		private int indent_level = 0;
+		
+		/**
+		 * Vector rows of the file, keyed by AST path (for descriptions).
+		 */
+		private Gee.HashMap<string,OLLMvector2.SQT.VectorMetadata> vectors = new Gee.HashMap<string,OLLMvector2.SQT.VectorMetadata>();
+		
+		/**
+		 * Constructor.
+		 * 
+		 * @param file The OLLMfilesd.File to outline
+		 */
+		public Outline(File file)
+		{
+			base(file);
+		}
+		
+		/**
+		 * Markdown outline, rebuilt only when the file or its index changed.
+		 * 
+		 * @param show_lines true for line ranges, false for AST paths
+		 * @throws Error if the file cannot be read or parsed
+		 * @return Markdown outline
+		 */
+		public async string get_outline(bool show_lines) throws GLib.Error
+		{
+			var file_mtime = this.file.mtime_on_disk();
+			if (file_mtime <= 0 || file_mtime != this.last_parsed
+				|| this.file.last_vector_scan != this.last_vector_scan
+				|| this.needs_reparse) {
+				yield this.build();
+				this.last_parsed = file_mtime;
+			} else {
+				GLib.debug("Outline: cached %s", this.file.path);
+			}
+			return show_lines ? this.lines_output : this.ast_output;
+		}
+		
+		/**
+		 * Parse the file and build both outline forms.
+		 */
+		private async void build() throws GLib.Error
+		{
+			this.needs_reparse = false;
+			this.last_parsed = 0;
+			this.last_vector_scan = this.file.last_vector_scan;
+			
+			var code_content = yield this.load_file_content();
+			yield this.load_vector_metadata();
+			
+			if (this.is_unsupported_language(this.file.language)) {
+				this.ast_output = "# File Summary\n\n* text file (not a code file)\n";
+				this.lines_output = this.ast_output;
+				return;
+			}
+			
+			yield this.init_parser();
+			if (this.language == null) {
+				this.ast_output = "# File Summary\n\n* unsupported language: "
+					+ (this.file.language != "" ? this.file.language : "unknown") + "\n";
+				this.lines_output = this.ast_output;
+				return;
+			}
+			
+			var tree = this.parse_content(code_content);
+			if (tree == null) {
+				throw new GLib.IOError.FAILED("Failed to parse file: " + this.file.path);
+			}
+			
+			this.ast_output = "# File Summary\n\n";
+			this.lines_output = "# File Summary\n\n";
+			this.indent_level = 0;
+			this.traverse_ast(tree.get_root_node(), code_content, null, null, null, null);
+		}
+		
+		private async void load_vector_metadata() throws GLib.Error
+		{
+			this.vectors.clear();
+			if (this.file.id <= 0 || this.file.manager.db == null) {
+				return;
+			}
+			var rows = new Gee.ArrayList<OLLMvector2.SQT.VectorMetadata>();
+			yield OLLMvector2.SQT.VectorMetadata.query(this.file.manager.db).select_async(
+				"WHERE file_id = " + this.file.id.to_string(), rows);
+			foreach (var row in rows) {
+				var ast_path = row.ast_path.strip();
+				if (ast_path == "") {
+					continue;
+				}
+				this.vectors.set(ast_path, row);
+			}
+		}
+		
+		/**
+		 * Recursively traverse AST and extract code elements, outputting markdown.
+		 * 
+		 * @param node Current AST node
+		 * @param code_content Source code content for text extraction
+		 * @param parent_enum_name Parent enum name (for enum values)
+		 * @param current_namespace Current namespace
+		 * @param parent_class_name Parent class/struct/interface name
+		 * @param parent_section Enclosing markdown section node
+		 */
+		private void traverse_ast(TreeSitter.Node node, string code_content, string? parent_enum_name = null, string? current_namespace = null, string? parent_class_name = null, TreeSitter.Node? parent_section = null)
+		{
+			if (TreeSitter.node_is_null(node)) {
+				return;
+			}
+			
+			unowned string? node_type = TreeSitter.node_get_type(node);
+			var node_type_lower = (node_type ?? "").down();
+			var start_line = (int)TreeSitter.node_get_start_point(node).row + 1;
+			var end_line = (int)TreeSitter.node_get_end_point(node).row + 1;
+			
+			// For markdown: track section nodes that contain headings and their content
+			TreeSitter.Node? current_section = parent_section;
+			if (node_type_lower == "section") {
+				current_section = node;
+			}
+			
+			// Track parent enum name for enum_value nodes
+			var current_parent_enum = this.update_parent_enum_from_node(node_type_lower, node, code_content, parent_enum_name);
+			
+			// Track namespace for all elements
+			var updated_namespace = this.update_namespace_from_node(node_type_lower, node, code_content, current_namespace);
+			
+			// Track parent class/struct/interface for methods, properties, fields, etc.
+			var updated_parent_class = this.update_parent_class_from_node(node_type_lower, node, code_content, parent_class_name);
+			
+			// Extract and output element if this node represents a code element
+			var element_type = this.get_element_type(node, this.language);
+			string? cached_element_name = null;
+			bool should_output = false;
+			int saved_indent = this.indent_level;
+			
+			// Headings after list items can be parsed as block_continuation + '#' siblings;
+			// element_name() reads the line, so a name here means a heading pattern
+			if (node_type_lower == "block_continuation" && element_type == "") {
+				cached_element_name = this.element_name(node, code_content);
+				if (cached_element_name != null && cached_element_name != "") {
+					element_type = this.heading_type_at(code_content, TreeSitter.node_get_start_byte(node));
+				}
+			}
+			
+			// Skip namespace declarations - we track namespace for context but don't output them separately
+			if (element_type != "" && element_type != "namespace") {
+				cached_element_name = this.element_name(node, code_content);
+				
+				// For enum_value nodes, prefix with parent enum name if available
+				if (node_type_lower == "enum_value" && current_parent_enum != null && current_parent_enum != ""
+					&& cached_element_name != null && cached_element_name != "") {
+					cached_element_name = "%s.%s".printf(current_parent_enum, cached_element_name);
+				}
+				
+				// Only output if we have a name (skip anonymous elements)
+				if (cached_element_name != null && cached_element_name != "") {
+					should_output = true;
+					
+					// For markdown headings, use section end line if available (includes all content)
+					int output_end_line = end_line;
+					if (element_type.has_prefix("heading") && current_section != null && !TreeSitter.node_is_null(current_section)) {
+						var section_end_line = (int)TreeSitter.node_get_end_point(current_section).row + 1;
+						if (section_end_line > end_line) {
+							output_end_line = section_end_line;
+						}
+					}
+					
+					// For markdown headings, set indent based on heading level (h1=0, h2=1, etc.)
+					if (element_type.has_prefix("heading")) {
+						var heading_num = int.parse(element_type.substring(7));
+						if (heading_num > 0 && heading_num <= 6) {
+							this.indent_level = heading_num - 1;
+						}
+					}
+					
+					this.output_indented_line(node, code_content, element_type, cached_element_name, start_line, output_end_line);
+					
+					// Increase indent for children (for code elements, not markdown headings)
+					if (!element_type.has_prefix("heading")) {
+						this.indent_level++;
+					}
+				}
+			}
+			
+			// Recursively traverse children
+			uint child_count = TreeSitter.node_get_child_count(node);
+			for (uint i = 0; i < child_count; i++) {
+				var child = TreeSitter.node_get_child(node, i);
+				this.traverse_ast(child, code_content, current_parent_enum, updated_namespace, updated_parent_class, current_section);
+			}
+			
+			// For markdown headings, restore saved indent; for code elements, decrease by 1
+			if (should_output) {
+				if (element_type.has_prefix("heading")) {
+					this.indent_level = saved_indent;
+				} else {
+					this.indent_level--;
+				}
+			}
+		}
+		
+		/**
+		 * Heading type (''heading1''..''heading6'') from the '#' run on the
+		 * line containing start_byte, or "".
+		 */
+		private string heading_type_at(string code_content, uint32 start_byte)
+		{
+			// Find line start (search backwards for newline)
+			int line_start = -1;
+			for (int i = (int)start_byte - 1; i >= 0 && i >= (int)start_byte - 500; i--) {
+				if (code_content[i] == '\n') {
+					line_start = i;
+					break;
+				}
+			}
+			// Find line end (search forwards for newline)
+			int line_end = (int)code_content.length;
+			for (uint32 i = start_byte; i < code_content.length && i < start_byte + 500; i++) {
+				if (code_content[i] == '\n') {
+					line_end = (int)i;
+					break;
+				}
+			}
+			if (line_end <= line_start + 1) {
+				return "";
+			}
+			var line_text = code_content.substring(line_start + 1, line_end - line_start - 1);
+			// Check if line starts with 1-6 '#' characters
+			int hash_count = 0;
+			for (int i = 0; i < line_text.length && i < 6; i++) {
+				if (line_text[i] == '#') {
+					hash_count++;
+				} else if (line_text[i] == ' ' || line_text[i] == '\t') {
+					continue;
+				} else {
+					break;
+				}
+			}
+			return hash_count >= 1 ? "heading" + hash_count.to_string() : "";
+		}
+		
+		/**
+		 * Append one element to both outline forms.
+		 * 
+		 * @param node AST node for this element (used to generate AST path)
+		 * @param code_content Source code content (used to generate AST path)
+		 * @param type Element type (e.g., "class", "method")
+		 * @param name Element name
+		 * @param start_line Starting line number (1-indexed)
+		 * @param end_line Ending line number (1-indexed)
+		 */
+		private void output_indented_line(TreeSitter.Node node, string code_content, string type, string name, int start_line, int end_line)
+		{
+			var indent = string.nfill(this.indent_level * INDENT_STEP, ' ');
+			var ast_path_str = this.ast_path(node, code_content);
+			var description = "";
+			if (ast_path_str != "" && this.vectors.has_key(ast_path_str)) {
+				description = " - " + this.vectors.get(ast_path_str).description;
+			}
+			var lines_line = indent + "* " + type + " " + name + " lines " + start_line.to_string() +
+				(end_line != start_line ? "-" + end_line.to_string() : "") + description + "\n";
+			this.lines_output += lines_line;
+			
+			// AST path form falls back to line numbers when no path is available
+			this.ast_output += ast_path_str == "" ? lines_line
+				: indent + "* " + type + " " + name + " ast-path: " + ast_path_str + description + "\n";
+		}
+	}
+}
@@ -0,0 +1,501 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+namespace OLLMfilesd
+{
+	/**
+	 * Fuzzy file-name index behind {@link ProjectFiles.search}.
+	 *
+	 * Every entry is a slot: its lowercase project-relative path is packed
+	 * into one byte arena, with the basename offset and a 64-bit mask of
+	 * the characters it contains. A query is matched as a subsequence
+	 * (fzf style) and scored by basename prefix / substring, word
+	 * boundaries and runs of consecutive characters; only the requested
+	 * page is kept, in a bounded heap.
+	 *
+	 * Typing is incremental: the candidates of each query are kept, and
+	 * a query that extends a cached one ("abc" after "ab") only looks at
+	 * those. Adds test the new slot against the cached queries and removes
+	 * leave a hole, so the cache survives index updates.
+	 *
+	 * Wildcard queries (''*'', ''?'') match basename or relative path
+	 * with a regex and are ordered by path.
+	 */
+	public class PathIndex : Object
+	{
+		/** Cached candidates of one query; each step extends the previous one. */
+		private class Step
+		{
+			public string query;
+			public int[] slots = {};
+		}
+
+		/** Longest chain of cached refinement steps. */
+		private const int MAX_STEPS = 32;
+
+		private uint8[] arena = new uint8[16384];
+		private int arena_len = 0;
+		private int[] starts = {};
+		private int[] lens = {};
+		/** Basename offset within the slot's text. */
+		private int[] base_offs = {};
+		private uint64[] masks = {};
+		private Gee.ArrayList<GLib.Object?> values = new Gee.ArrayList<GLib.Object?>();
+		private Gee.HashMap<string, int> slot_of = new Gee.HashMap<string, int>();
+		private Gee.ArrayList<Step> steps = new Gee.ArrayList<Step>();
+
+		/** Live entries. */
+		public int size {
+			get { return this.slot_of.size; }
+		}
+
+		/**
+		 * Add or replace an entry.
+		 *
+		 * @param key identity of the entry (absolute path)
+		 * @param text path the user searches (project-relative)
+		 * @param value object returned by {@link search}
+		 */
+		public void add(string key, string text, GLib.Object value)
+		{
+			this.remove(key);
+			var lower = text.down();
+			var slot = this.values.size;
+			this.slot_of.set(key, slot);
+			this.values.add(value);
+			this.append_text(lower);
+			foreach (var step in this.steps) {
+				if (!this.matches(slot, step.query.data, mask_of(step.query))) {
+					break;
+				}
+				step.slots += slot;
+			}
+			this.maybe_compact();
+		}
+
+		/**
+		 * Remove an entry; no-op when key is not indexed.
+		 */
+		public void remove(string key)
+		{
+			if (!this.slot_of.has_key(key)) {
+				return;
+			}
+			int slot;
+			this.slot_of.unset(key, out slot);
+			this.values.set(slot, null);
+		}
+
+		/**
+		 * Remove every entry.
+		 */
+		public void clear()
+		{
+			this.arena_len = 0;
+			this.starts = {};
+			this.lens = {};
+			this.base_offs = {};
+			this.masks = {};
+			this.values.clear();
+			this.slot_of.clear();
+			this.steps.clear();
+		}
+
+		/**
+		 * One page of matches for query, best first.
+		 *
+		 * @param query stripped, lowercase filter (not empty)
+		 * @param offset rows to skip
+		 * @param limit rows to return
+		 * @param total number of matching entries
+		 * @return values of the matching entries in the page
+		 */
+		public Gee.ArrayList<GLib.Object> search(string query, int offset, int limit, out int total)
+		{
+			var ret = new Gee.ArrayList<GLib.Object>();
+			total = 0;
+			if (query.contains("*") || query.contains("?")) {
+				return this.search_wildcard(query, offset, limit, out total);
+			}
+			var step = this.refine(query);
+			var q = query.data;
+			var keep = offset + limit;
+			var heap_slot = new int[int.max(1, keep)];
+			var heap_score = new int[int.max(1, keep)];
+			var heap_len = 0;
+			foreach (var slot in step.slots) {
+				if (this.values.get(slot) == null) {
+					continue;
+				}
+				total++;
+				if (keep < 1) {
+					continue;
+				}
+				var score = this.score(slot, q);
+				if (heap_len < keep) {
+					heap_slot[heap_len] = slot;
+					heap_score[heap_len] = score;
+					heap_len++;
+					this.sift_up(heap_slot, heap_score, heap_len - 1);
+					continue;
+				}
+				if (!this.better(slot, score, heap_slot[0], heap_score[0])) {
+					continue;
+				}
+				heap_slot[0] = slot;
+				heap_score[0] = score;
+				this.sift_down(heap_slot, heap_score, heap_len);
+			}
+			// Pop worst first into the tail: gives the page best first.
+			var ordered = new int[heap_len];
+			for (var i = heap_len - 1; i >= 0; i--) {
+				ordered[i] = heap_slot[0];
+				heap_len--;
+				heap_slot[0] = heap_slot[heap_len];
+				heap_score[0] = heap_score[heap_len];
+				this.sift_down(heap_slot, heap_score, heap_len);
+			}
+			for (var i = offset; i < ordered.length; i++) {
+				ret.add(this.values.get(ordered[i]));
+			}
+			return ret;
+		}
+
+		/**
+		 * Cached candidates for query, computed from the longest cached
+		 * query it extends.
+		 */
+		private Step refine(string query)
+		{
+			Step? from = null;
+			var keep = 0;
+			foreach (var step in this.steps) {
+				if (!query.has_prefix(step.query)) {
+					break;
+				}
+				from = step;
+				keep++;
+			}
+			while (this.steps.size > keep) {
+				this.steps.remove_at(this.steps.size - 1);
+			}
+			if (from != null && from.query == query) {
+				return from;
+			}
+			var step = new Step() { query = query };
+			var q = query.data;
+			var mask = mask_of(query);
+			if (from != null) {
+				foreach (var slot in from.slots) {
+					if (this.values.get(slot) != null && this.matches(slot, q, mask)) {
+						step.slots += slot;
+					}
+				}
+			} else {
+				for (var slot = 0; slot < this.values.size; slot++) {
+					if (this.values.get(slot) != null && this.matches(slot, q, mask)) {
+						step.slots += slot;
+					}
+				}
+			}
+			if (this.steps.size >= MAX_STEPS) {
+				this.steps.remove_at(0);
+			}
+			this.steps.add(step);
+			return step;
+		}
+
+		/**
+		 * Whether query is a subsequence of the slot's text.
+		 */
+		private bool matches(int slot, uint8[] q, uint64 mask)
+		{
+			if ((this.masks[slot] & mask) != mask) {
+				return false;
+			}
+			var s = this.starts[slot];
+			var end = s + this.lens[slot];
+			var qi = 0;
+			for (var i = s; i < end && qi < q.length; i++) {
+				if (this.arena[i] == q[qi]) {
+					qi++;
+				}
+			}
+			return qi == q.length;
+		}
+
+		/**
+		 * Rank of a match; higher is better.
+		 *
+		 * Basename prefix beats basename substring beats path substring
+		 * beats a scattered match. Within a tier, characters at word
+		 * boundaries and in runs score more, gaps and long paths less.
+		 */
+		private int score(int slot, uint8[] q)
+		{
+			var s = this.starts[slot];
+			var n = this.lens[slot];
+			var b = this.base_offs[slot];
+			var ret = 0;
+			var in_base = this.find(s + b, n - b, q);
+			if (in_base == 0) {
+				ret += 3000;
+			} else if (in_base > 0) {
+				ret += 2000;
+			} else if (this.find(s, n, q) >= 0) {
+				ret += 1000;
+			}
+
+			// Tightest window ending at the first complete match (fzf v1).
+			var qi = 0;
+			var last = -1;
+			for (var i = 0; i < n; i++) {
+				if (this.arena[s + i] == q[qi]) {
+					qi++;
+					if (qi == q.length) {
+						last = i;
+						break;
+					}
+				}
+			}
+			if (last < 0) {
+				return ret;
+			}
+			var first = last;
+			qi = q.length - 1;
+			for (var i = last; i >= 0; i--) {
+				if (this.arena[s + i] != q[qi]) {
+					continue;
+				}
+				if (qi == 0) {
+					first = i;
+					break;
+				}
+				qi--;
+			}
+			qi = 0;
+			var run = 0;
+			for (var i = first; i <= last; i++) {
+				var c = this.arena[s + i];
+				if (qi >= q.length || c != q[qi]) {
+					ret -= 1;
+					run = 0;
+					continue;
+				}
+				ret += 16;
+				if (i == 0 || is_separator(this.arena[s + i - 1])) {
+					ret += 8;
+				}
+				if (i == b) {
+					ret += 8;
+				}
+				if (i >= b) {
+					ret += 4;
+				}
+				ret += 4 * run;
+				run++;
+				qi++;
+			}
+			return ret - (n - b) / 4 - n / 16;
+		}
+
+		/**
+		 * Offset of q in the bytes at start .. start + len, or -1.
+		 */
+		private int find(int start, int len, uint8[] q)
+		{
+			for (var i = 0; i + q.length <= len; i++) {
+				var j = 0;
+				while (j < q.length && this.arena[start + i + j] == q[j]) {
+					j++;
+				}
+				if (j == q.length) {
+					return i;
+				}
+			}
+			return -1;
+		}
+
+		/** Whether (a, sa) ranks above (b, sb): score, then path order. */
+		private bool better(int a, int sa, int b, int sb)
+		{
+			if (sa != sb) {
+				return sa > sb;
+			}
+			return this.compare_text(a, b) < 0;
+		}
+
+		private int compare_text(int a, int b)
+		{
+			var sa = this.starts[a];
+			var sb = this.starts[b];
+			var n = int.min(this.lens[a], this.lens[b]);
+			for (var i = 0; i < n; i++) {
+				if (this.arena[sa + i] != this.arena[sb + i]) {
+					return this.arena[sa + i] < this.arena[sb + i] ? -1 : 1;
+				}
+			}
+			return this.lens[a] - this.lens[b];
+		}
+
+		/* Min-heap on rank: the worst kept match is at the root. */
+		private void sift_up(int[] slots, int[] scores, int i)
+		{
+			while (i > 0) {
+				var parent = (i - 1) / 2;
+				if (!this.better(slots[parent], scores[parent], slots[i], scores[i])) {
+					return;
+				}
+				this.swap(slots, scores, i, parent);
+				i = parent;
+			}
+		}
+
+		private void sift_down(int[] slots, int[] scores, int len)
+		{
+			var i = 0;
+			while (true) {
+				var worst = i;
+				var l = 2 * i + 1;
+				var r = l + 1;
+				if (l < len && this.better(slots[worst], scores[worst], slots[l], scores[l])) {
+					worst = l;
+				}
+				if (r < len && this.better(slots[worst], scores[worst], slots[r], scores[r])) {
+					worst = r;
+				}
+				if (worst == i) {
+					return;
+				}
+				this.swap(slots, scores, i, worst);
+				i = worst;
+			}
+		}
+
+		private void swap(int[] slots, int[] scores, int a, int b)
+		{
+			var t = slots[a];
+			slots[a] = slots[b];
+			slots[b] = t;
+			t = scores[a];
+			scores[a] = scores[b];
+			scores[b] = t;
+		}
+
+		private Gee.ArrayList<GLib.Object> search_wildcard(
+			string query, int offset, int limit, out int total)
+		{
+			var ret = new Gee.ArrayList<GLib.Object>();
+			total = 0;
+			GLib.Regex regex;
+			try {
+				regex = new GLib.Regex("^" + GLib.Regex.escape_string(query)
+					.replace("\\?", ".")
+					.replace("\\*", ".*") + "$");
+			} catch (GLib.RegexError e) {
+				return ret;
+			}
+			var literal = query.replace("*", "").replace("?", "");
+			var mask = mask_of(literal);
+			var matched = new Gee.ArrayList<int>();
+			for (var slot = 0; slot < this.values.size; slot++) {
+				if (this.values.get(slot) == null || (this.masks[slot] & mask) != mask) {
+					continue;
+				}
+				var text = this.text(slot);
+				if (!regex.match(text.substring(this.base_offs[slot])) && !regex.match(text)) {
+					continue;
+				}
+				matched.add(slot);
+			}
+			total = matched.size;
+			matched.sort((a, b) => this.compare_text(a, b));
+			for (var i = offset; i < int.min(matched.size, offset + limit); i++) {
+				ret.add(this.values.get(matched.get(i)));
+			}
+			return ret;
+		}
+
+		private string text(int slot)
+		{
+			// arena holds no NULs; substring stops at the slot length
+			return ((string) this.arena).substring(this.starts[slot], this.lens[slot]);
+		}
+
+		private void append_text(string lower)
+		{
+			var bytes = lower.data;
+			if (this.arena_len + bytes.length > this.arena.length) {
+				this.arena.resize(int.max(this.arena.length * 2, this.arena_len + bytes.length));
+			}
+			for (var i = 0; i < bytes.length; i++) {
+				this.arena[this.arena_len + i] = bytes[i];
+			}
+			var base_off = lower.last_index_of_char('/') + 1;
+			this.starts += this.arena_len;
+			this.lens += bytes.length;
+			this.base_offs += base_off;
+			this.masks += mask_of(lower);
+			this.arena_len += bytes.length;
+		}
+
+		/**
+		 * Rebuild the arena once most slots are holes.
+		 */
+		private void maybe_compact()
+		{
+			if (this.values.size < 1024 || this.values.size < this.slot_of.size * 2) {
+				return;
+			}
+			var old_values = this.values;
+			var old_slot_of = this.slot_of;
+			var texts = new Gee.HashMap<string, string>();
+			foreach (var entry in old_slot_of.entries) {
+				texts.set(entry.key, this.text(entry.value));
+			}
+			this.clear();
+			foreach (var entry in old_slot_of.entries) {
+				var slot = this.values.size;
+				this.slot_of.set(entry.key, slot);
+				this.values.add(old_values.get(entry.value));
+				this.append_text(texts.get(entry.key));
+			}
+		}
+
+		private static bool is_separator(uint8 c)
+		{
+			return c == '/' || c == '_' || c == '-' || c == '.' || c == ' ';
+		}
+
+		/** Bit per character class present in text, for a quick reject. */
+		private static uint64 mask_of(string text)
+		{
+			uint64 ret = 0;
+			foreach (var c in text.data) {
+				if (c >= 'a' && c <= 'z') {
+					ret |= (uint64) 1 << (c - 'a');
+				} else if (c >= '0' && c <= '9') {
+					ret |= (uint64) 1 << (26 + c - '0');
+				} else {
+					ret |= (uint64) 1 << (36 + c % 28);
+				}
+			}
+			return ret;
+		}
+	}
+}
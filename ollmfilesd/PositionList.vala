@@ -0,0 +1,264 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+namespace OLLMfilesd
+{
+	/** Identity of a {@link PositionList} item (e.g. its path). */
+	public delegate string PositionKeyFunc<G>(G item);
+
+	/**
+	 * Ordered list behind {@link ProjectFiles}: O(1) amortized position
+	 * lookup by key, and batched change reporting.
+	 *
+	 * Positions are kept in a key -> index map that is rebuilt lazily from
+	 * the first changed index. Between {@link begin_batch} and
+	 * {@link end_batch}, changes emit nothing and removals only mark their
+	 * slot; end_batch compacts the list in one pass and emits a single
+	 * {@link items_changed}, so a scan touching thousands of entries
+	 * costs linear time.
+	 */
+	public class PositionList<G> : Object
+	{
+		/** Same contract as GLib.ListModel.items_changed. */
+		public signal void items_changed(uint position, uint removed, uint added);
+
+		/**
+		 * Backing list, shared with the owner. Inside a batch it still
+		 * holds removed entries (see {@link is_dropped}).
+		 */
+		public Gee.ArrayList<G> items { get; private set; }
+
+		private PositionKeyFunc<G> key;
+
+		/**
+		 * Position of each item in {@link items}, by key.
+		 * Entries at or after {@link positions_from} may be stale.
+		 */
+		private Gee.HashMap<string, int> positions = new Gee.HashMap<string, int>();
+
+		/** First index whose {@link positions} entry needs rebuilding. */
+		private int positions_from = 0;
+
+		/** Nesting depth of {@link begin_batch} / {@link end_batch}. */
+		private int batch_depth = 0;
+
+		/** Item count when the outermost batch began. */
+		private int batch_old_n = 0;
+
+		/** Lowest index changed in the current batch ({@code int.MAX} = none). */
+		private int batch_first = int.MAX;
+
+		/** Indexes removed in the current batch; compacted in {@link end_batch}. */
+		private Gee.HashSet<int> dropped = new Gee.HashSet<int>();
+
+		/**
+		 * @param items backing list (may already hold entries)
+		 * @param key identity of an item; must not change while it is listed
+		 */
+		public PositionList(Gee.ArrayList<G> items, owned PositionKeyFunc<G> key)
+		{
+			this.items = items;
+			this.key = (owned) key;
+		}
+
+		/**
+		 * Item at position, or null when out of range or removed in the
+		 * current batch.
+		 */
+		public G? live_at(uint position)
+		{
+			if (position >= this.items.size || this.dropped.contains((int)position)) {
+				return null;
+			}
+			return this.items[(int)position];
+		}
+
+		/** True when position was removed in the current batch. */
+		public bool is_dropped(int position)
+		{
+			return this.dropped.contains(position);
+		}
+
+		public void append(G item)
+		{
+			var position = this.items.size;
+			this.items.add(item);
+			if (this.positions_from == position) {
+				this.positions.set(this.key(item), position);
+				this.positions_from = position + 1;
+			}
+			if (this.batch_depth > 0) {
+				this.batch_first = int.min(this.batch_first, position);
+				return;
+			}
+			this.items_changed(position, 0, 1);
+		}
+
+		/**
+		 * Insert at position, counted without entries removed in the
+		 * current batch (pending removals are compacted first).
+		 */
+		public void insert(uint position, G item)
+		{
+			this.compact();
+			if (position > this.items.size) {
+				position = this.items.size;
+			}
+			this.items.insert((int)position, item);
+			this.positions_from = int.min(this.positions_from, (int)position);
+			if (this.batch_depth > 0) {
+				this.batch_first = int.min(this.batch_first, (int)position);
+				return;
+			}
+			this.items_changed(position, 0, 1);
+		}
+
+		/**
+		 * Remove the entry at position. Inside a batch the slot is only
+		 * marked; the list is compacted (and positions shift) in
+		 * {@link end_batch}. No-op for positions {@link live_at} rejects.
+		 */
+		public void remove_at(uint position)
+		{
+			var item = this.live_at(position);
+			if (item == null) {
+				return;
+			}
+			var k = this.key(item);
+			if (this.positions.has_key(k) && this.positions.get(k) == (int)position) {
+				this.positions.unset(k);
+			}
+			if (this.batch_depth > 0) {
+				this.dropped.add((int)position);
+				this.batch_first = int.min(this.batch_first, (int)position);
+				return;
+			}
+			this.items.remove_at((int)position);
+			this.positions_from = int.min(this.positions_from, (int)position);
+			this.items_changed(position, 1, 0);
+		}
+
+		public void clear()
+		{
+			var old_n = this.items.size;
+			this.items.clear();
+			this.positions.clear();
+			this.positions_from = 0;
+			this.dropped.clear();
+			if (this.batch_depth > 0) {
+				this.batch_first = 0;
+				return;
+			}
+			if (old_n > 0) {
+				this.items_changed(0, old_n, 0);
+			}
+		}
+
+		/**
+		 * Start a batch of changes. Batches nest; only the outermost
+		 * {@link end_batch} emits.
+		 */
+		public void begin_batch()
+		{
+			if (this.batch_depth == 0) {
+				this.batch_old_n = this.items.size;
+				this.batch_first = int.MAX;
+			}
+			this.batch_depth++;
+		}
+
+		/**
+		 * Finish a batch: compact removed slots and emit one items_changed
+		 * covering everything from the first changed position. A batch of
+		 * appends only is reported as an append.
+		 */
+		public void end_batch()
+		{
+			if (this.batch_depth == 0) {
+				return;
+			}
+			this.batch_depth--;
+			if (this.batch_depth > 0) {
+				return;
+			}
+			this.compact();
+			var first = this.batch_first;
+			var old_n = this.batch_old_n;
+			var new_n = this.items.size;
+			this.batch_first = int.MAX;
+			if (first == int.MAX) {
+				return; // Nothing changed
+			}
+			if (first >= old_n) {
+				this.items_changed(old_n, 0, new_n - old_n);
+				return;
+			}
+			// GLib.ListModel.items_changed takes one contiguous range, so
+			// report everything from the first change as replaced
+			this.items_changed(first, old_n - first, new_n - first);
+		}
+
+		/**
+		 * Position of the entry with key, or -1. Rebuilds stale
+		 * {@link positions} entries first.
+		 */
+		public int position_of(string key)
+		{
+			for (var i = this.positions_from; i < this.items.size; i++) {
+				if (!this.dropped.contains(i)) {
+					this.positions.set(this.key(this.items[i]), i);
+				}
+			}
+			this.positions_from = this.items.size;
+			if (!this.positions.has_key(key)) {
+				return -1;
+			}
+			var ret = this.positions.get(key);
+			if (ret >= this.items.size || this.dropped.contains(ret)
+				|| this.key(this.items[ret]) != key) {
+				return -1;
+			}
+			return ret;
+		}
+
+		/** Drop slots marked by remove_at inside a batch, in one pass. */
+		private void compact()
+		{
+			if (this.dropped.size == 0) {
+				return;
+			}
+			var write = 0;
+			var first = this.items.size;
+			for (var read = 0; read < this.items.size; read++) {
+				if (this.dropped.contains(read)) {
+					first = int.min(first, read);
+					continue;
+				}
+				if (write != read) {
+					this.items[write] = this.items[read];
+				}
+				write++;
+			}
+			while (this.items.size > write) {
+				this.items.remove_at(this.items.size - 1);
+			}
+			this.dropped.clear();
+			this.positions_from = int.min(this.positions_from, first);
+		}
+	}
+}
@@ -86,16 +86,19 @@ namespace OLLMfilesd
 		public ReviewFiles review_files { get; private set; }
 
 		/**
-		 * Last {@link cached_search} query ({@code " "} = cache empty).
+		 * Fuzzy path index for {@link search}; kept in step with items.
 		 */
-		private string cached_query { get; set; default = " "; }
+		private PathIndex path_index { get; set; default = new PathIndex(); }
 
 		/**
-		 * Filtered, sorted file rows for {@link cached_query}.
+		 * Browse-all order for an empty {@link search} (null = rebuild).
 		 */
-		private Gee.ArrayList<File> cached_results { get; set;
-			default = new Gee.ArrayList<File>();
-		}
+		private Gee.ArrayList<File>? browse_results = null;
+
+		/**
+		 * Positions and batching over {@link items}; emits our items_changed.
+		 */
+		private PositionList<ProjectFile> list;
 		
 		/**
 		 * Emitted when a new file is explicitly added to the project (not during scans).
@@ -113,6 +116,12 @@ namespace OLLMfilesd
 		{
 			Object();
 			this.review_files = new ReviewFiles(this);
+			this.list = new PositionList<ProjectFile>(this.items, (item) => {
+				return item.file.path;
+			});
+			this.list.items_changed.connect((position, removed, added) => {
+				this.items_changed(position, removed, added);
+			});
 		}
 		
 		/**
@@ -182,14 +191,9 @@ namespace OLLMfilesd
 		 */
 		public void append(ProjectFile item)
 		{
-			var position = this.items.size;
-			this.items.add(item);
 			this.child_map.set(item.file.path, item);
-			this.cached_query = " ";
-			this.cached_results.clear();
-			
-			// Emit items_changed signal
-			this.items_changed(position, 0, 1);
+			this.index_add(item);
+			this.list.append(item);
 		}
 		
 		/**
@@ -201,7 +205,7 @@ namespace OLLMfilesd
 		 */
 		public bool find(ProjectFile item, out uint position)
 		{
-			var index = this.items.index_of(item);
+			var index = this.position_of(item);
 			if (index >= 0) {
 				position = (uint)index;
 				return true;
@@ -218,17 +222,10 @@ namespace OLLMfilesd
 		 */
 		public void insert(uint position, ProjectFile item)
 		{
-			if (position > this.items.size) {
-				position = this.items.size;
-			}
-			
-			this.items.insert((int)position, item);
 			this.child_map.set(item.file.path, item);
-			this.cached_query = " ";
-			this.cached_results.clear();
-			
-			// Emit items_changed signal
-			this.items_changed(position, 0, 1);
+			this.index_add(item);
+			// Positions are relative to the list without pending removals
+			this.list.insert(position, item);
 		}
 		
 		/**
@@ -239,7 +236,7 @@ namespace OLLMfilesd
 		 */
 		public bool contains(ProjectFile item)
 		{
-			return this.items.contains(item);
+			return this.position_of(item) >= 0;
 		}
 		
 		/**
@@ -249,7 +246,7 @@ namespace OLLMfilesd
 		 */
 		public void remove(ProjectFile item)
 		{
-			var position = this.items.index_of(item);
+			var position = this.position_of(item);
 			if (position < 0) {
 				return; // Not found
 			}
@@ -260,27 +257,29 @@ namespace OLLMfilesd
 		/**
 		 * Remove an item at a specific position (ListStore-compatible).
 		 * 
+		 * Inside a batch the slot is only marked; the list is compacted
+		 * (and positions shift) in {@link end_batch}.
+		 * 
 		 * @param position The position of the item to remove
 		 */
 		public void remove_at(uint position)
 		{
-			if (position >= this.items.size) {
+			var item = this.list.live_at(position);
+			if (item == null) {
 				return; // Invalid position
 			}
 			
-			var item = this.items[(int)position];
-			this.items.remove_at((int)position);
-			
-			// Remove from child_map based on file path
-			this.child_map.unset(item.file.path);
+			// Remove from child_map based on file path (unless already replaced)
+			if (this.child_map.get(item.file.path) == item) {
+				this.child_map.unset(item.file.path);
+				this.path_index.remove(item.file.path);
+			}
 			
 			// Remove from all_files for consistency (may not be in there, but remove if present)
 			this.all_files.unset(item.file.path);
-			this.cached_query = " ";
-			this.cached_results.clear();
+			this.browse_results = null;
 			
-			// Emit items_changed signal
-			this.items_changed(position, 1, 0);
+			this.list.remove_at(position);
 		}
 		
 		/**
@@ -288,17 +287,46 @@ namespace OLLMfilesd
 		 */
 		public void remove_all()
 		{
-			var old_n_items = this.items.size;
-			this.items.clear();
 			this.child_map.clear();
 			this.folder_map.clear();
-			this.cached_query = " ";
-			this.cached_results.clear();
-			
-			// Emit items_changed signal for ListModel
-			if (old_n_items > 0) {
-				this.items_changed(0, old_n_items, 0);
+			this.path_index.clear();
+			this.browse_results = null;
+			this.list.clear();
+		}
+		
+		/**
+		 * Start a batch of changes.
+		 * 
+		 * Until the matching {@link end_batch}, append / insert / remove
+		 * do not emit items_changed and removals are deferred, so a scan
+		 * touching thousands of files costs linear time and listeners see
+		 * one update. Batches nest; only the outermost one emits.
+		 */
+		public void begin_batch()
+		{
+			this.list.begin_batch();
+		}
+		
+		/**
+		 * Finish a batch: compact removed slots and emit one items_changed
+		 * covering everything from the first changed position.
+		 */
+		public void end_batch()
+		{
+			this.list.end_batch();
+		}
+		
+		/**
+		 * Position of item (matched by database id, as {@link items} is),
+		 * or -1.
+		 */
+		private int position_of(ProjectFile item)
+		{
+			var ret = this.list.position_of(item.file.path);
+			if (ret < 0 || this.items[ret].file.id != item.file.id) {
+				return -1;
 			}
+			return ret;
 		}
 		
 		/**
@@ -310,12 +338,14 @@ namespace OLLMfilesd
 		 * once by tracking scanned folders using a HashSet of folder IDs.
 		 * Also builds a hashmap of folder paths => Folder objects for quick lookup.
 		 * 
+		 * Runs as one batch: listeners get a single items_changed.
+		 * 
 		 * @param folder The folder to start scanning from (should be a project folder)
 		 */
 		public void update_from(Folder folder)
 		{
-			this.cached_query = " ";
-			this.cached_results.clear();
+			this.browse_results = null;
+			this.begin_batch();
 
 			// Track scanned folders to prevent duplicate recursion
 			var scanned_folders = new Gee.HashSet<int>();
@@ -340,16 +370,13 @@ namespace OLLMfilesd
 				""); // Not inside a symlink at the root
 			
 			// Remove files that are no longer in the project
-			// Note: this.remove() triggers ListModel signals for UI updates
-			var to_remove = new Gee.ArrayList<ProjectFile>();
-			foreach (var project_file in this.items) {
-				if (!found_files.contains(project_file.file.path)) {
-					to_remove.add(project_file);
+			// (deferred until end_batch, which emits the ListModel signal)
+			for (var i = 0; i < this.items.size; i++) {
+				if (!found_files.contains(this.items[i].file.path)) {
+					this.remove_at(i);
 				}
 			}
-			foreach (var project_file in to_remove) {
-				this.remove(project_file);
-			}
+			this.end_batch();
 			
 			// Note: folder_map and all_files are cleared and rebuilt by update_from_recursive(),
 			// so no cleanup is needed - they only contain items that exist in the current hierarchy
@@ -672,73 +699,67 @@ namespace OLLMfilesd
 		 * 
 		 * This is a list-level cleanup operation that removes items from a single list.
 		 * Iterates through items and removes any ProjectFile where file.delete_id > 0.
-		 * Batches removals to minimize signal emissions. Since GLib.ListModel.items_changed
-		 * only supports one contiguous range per signal, this emits one broad signal
-		 * indicating all items from the first deletion position changed.
+		 * Runs as one batch, so listeners get a single items_changed.
 		 * 
 		 * This should be called after files are flagged as deleted (during cleanup phase).
 		 */
 		public async void cleanup_deleted()
 		{
-			var lowest_removed_index = -1;
-			var removed_count = 0;
-			
-			// Iterate backwards for safe removal (highest to lowest index)
-			for (var i = (int)this.items.size - 1; i >= 0; i--) {
-				var project_file = this.items.get(i);
-				if (project_file.file.delete_id == 0) {
-					continue;  // Skip non-deleted files
+			this.begin_batch();
+			for (var i = 0; i < this.items.size; i++) {
+				if (this.items[i].file.delete_id > 0) {
+					this.remove_at(i);
 				}
-				
-				// Remove from array and child_map immediately
-				this.items.remove_at(i);
-				this.child_map.unset(project_file.file.path);
-				removed_count++;
-				lowest_removed_index = i;  // Track lowest index (will be last one found)
-			}
-			
-			if (removed_count == 0) {
-				return; // Nothing to remove
 			}
-
-			this.cached_query = " ";
-			this.cached_results.clear();
-			
-			// Emit single items_changed signal for the range
-			// GLib.ListModel.items_changed only supports one contiguous range per signal
-			// For sparse (non-contiguous) deletions, we emit one broad signal:
-			// "from lowest_removed_index, removed N items" 
-			// This tells UI to refresh from that position onwards
-			// Less precise than multiple signals but correct and efficient
-			this.items_changed((uint)lowest_removed_index, (uint)removed_count, 0);
+			this.end_batch();
 			
 			// Note: VectorMetadata cleanup happens via ProjectManager.on_cleanup signal
 			// (emitted by DeleteManager.cleanup() after all cleanup is complete)
 		}
 
 		/**
-		 * Filtered, sorted file rows for {@code Folder.fetch_files}.
+		 * Index a newly listed item under its project-relative path.
+		 */
+		private void index_add(ProjectFile item)
+		{
+			var rel = item.display_relpath;
+			if (rel.has_prefix("/")) {
+				rel = rel.substring(1);
+			}
+			this.path_index.add(item.file.path, rel, item.file);
+			this.browse_results = null;
+		}
+
+		/**
+		 * One page of filtered, sorted file rows for {@code Folder.fetch_files}.
 		 *
 		 * Caller must pass {@code key} already stripped and lowercased.
-		 * Results are cached per {@code key} until the main list changes.
+		 * An empty key lists recently viewed files first, then by path;
+		 * otherwise rows come from {@link PathIndex} (fuzzy, best first).
 		 *
 		 * @param key Dropdown filter ({@code ""} = browse all)
+		 * @param offset Rows to skip
+		 * @param limit Rows to return
+		 * @param total Number of matching rows
 		 * @return Matching {@link File} rows in dropdown order
 		 */
-		public Gee.ArrayList<File> cached_search(string key)
+		public Gee.ArrayList<File> search(string key, int offset, int limit, out int total)
 		{
-			if (this.cached_query == key) {
-				return this.cached_results;
+			var ret = new Gee.ArrayList<File>();
+			if (key != "") {
+				foreach (var obj in this.path_index.search(key, offset, limit, out total)) {
+					ret.add((File) obj);
+				}
+				return ret;
 			}
-
-			if (key == "") {
-				this.cached_results.clear();
+			if (this.browse_results == null) {
+				this.browse_results = new Gee.ArrayList<File>();
 				foreach (var project_file in this.items) {
-					this.cached_results.add(project_file.file);
+					this.browse_results.add(project_file.file);
 				}
 				var one_day_ago = new GLib.DateTime.now_utc().to_unix()
 					- (24 * 60 * 60);
-				this.cached_results.sort((a, b) => {
+				this.browse_results.sort((a, b) => {
 					var a_recent = a.last_viewed >= one_day_ago
 						&& a.last_viewed > 0;
 					var b_recent = b.last_viewed >= one_day_ago
@@ -752,86 +773,13 @@ namespace OLLMfilesd
 					}
 					return GLib.strcmp(a.path, b.path);
 				});
-				this.cached_query = "";
-				return this.cached_results;
 			}
-
-			this.cached_results.clear();
-			GLib.Regex? wildcard_regex = null;
-			if (key.contains("*") || key.contains("?")) {
-				try {
-					var escaped = key
-						.replace("\\", "\\\\")
-						.replace("^", "\\^")
-						.replace("$", "\\$")
-						.replace(".", "\\.")
-						.replace("[", "\\[")
-						.replace("]", "\\]")
-						.replace("|", "\\|")
-						.replace("(", "\\(")
-						.replace(")", "\\)")
-						.replace("{", "\\{")
-						.replace("}", "\\}")
-						.replace("+", "\\+");
-					wildcard_regex = new GLib.Regex(
-						"^" + escaped
-							.replace("?", ".")
-							.replace("*", ".*") + "$",
-						GLib.RegexCompileFlags.CASELESS
-					);
-				} catch (GLib.RegexError e) {
-					this.cached_query = key;
-					this.cached_results.clear();
-					return this.cached_results;
-				}
-			}
-			foreach (var project_file in this.items) {
-				var basename = GLib.Path.get_basename(
-					project_file.file.path
-				);
-				if (wildcard_regex != null) {
-					if (!wildcard_regex.match(basename)
-						&& !wildcard_regex.match(
-							project_file.file.path
-						)) {
-						continue;
-					}
-				}
-				if (wildcard_regex == null
-					&& !basename.down().contains(key)
-					&& !project_file.file.path.down().contains(key)) {
-					continue;
-				}
-				this.cached_results.add(project_file.file);
+			total = this.browse_results.size;
+			if (offset < total) {
+				ret.add_all(this.browse_results.slice(
+					offset, int.min(total, offset + limit)));
 			}
-			if (wildcard_regex != null) {
-				this.cached_results.sort((a, b) => {
-					return GLib.strcmp(a.path, b.path);
-				});
-				this.cached_query = key;
-				return this.cached_results;
-			}
-			this.cached_results.sort((a, b) => {
-				var a_base = GLib.Path.get_basename(a.path).down();
-				var b_base = GLib.Path.get_basename(b.path).down();
-				var a_prefix = a_base.has_prefix(key);
-				var b_prefix = b_base.has_prefix(key);
-				if (a_prefix != b_prefix) {
-					return a_prefix ? -1 : 1;
-				}
-				if (a_prefix && b_prefix) {
-					return GLib.strcmp(a_base, b_base);
-				}
-				var a_has = a_base.contains(key);
-				var b_has = b_base.contains(key);
-				if (a_has != b_has) {
-					return a_has ? -1 : 1;
-				}
-				return GLib.strcmp(a_base, b_base);
-			});
-
-			this.cached_query = key;
-			return this.cached_results;
+			return ret;
 		}
 	}
 }
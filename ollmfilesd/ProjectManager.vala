@@ -62,6 +62,16 @@ namespace OLLMfilesd
 			default = new Gee.HashMap<string,Tree>(); 
 		}
 		
+		/**
+		 * Cache of file outlines (''Codebase.outline'').
+		 * Maps file path to Outline instance; entries are dropped when the
+		 * file is deleted or found missing (see {@link outline_factory}).
+		 */
+		public Gee.HashMap<string,Outline> outline_cache {
+			get; private set;
+			default = new Gee.HashMap<string,Outline>(); 
+		}
+		
 		/**
 		 * List of all projects (folders where is_project = true).
 		 */
@@ -146,6 +156,12 @@ namespace OLLMfilesd
 		 * Semantic (FAISS) index queue — not filesystem {@link Folder.read_dir}.
 		 */
 		public OLLMfilesd.Vector.BackgroundScan vector_scan { get; set; }
+
+		/**
+		 * Symbol table and call graph ({@code Codebase.symbols} /
+		 * {@code Codebase.references}); null without a database.
+		 */
+		public OLLMfilesd.Vector.SymbolIndex? symbol_index { get; private set; default = null; }
 		
 		/**
 		 * Constructor.
@@ -160,6 +176,8 @@ namespace OLLMfilesd
 				FileBase.init_db(this.db);
 				FileHistory.init_db(this.db);
 				OLLMvector2.SQT.VectorMetadata.initDB(this.db);
+				OLLMfilesd.Vector.SymbolIndex.init_db(this.db);
+				this.symbol_index = new OLLMfilesd.Vector.SymbolIndex(this.db);
 			}
 			// Initialize git provider if set
 			this.git_provider.initialize();
@@ -213,6 +231,10 @@ namespace OLLMfilesd
 				);
 			});
 			this.file_contents_changed.connect((file) => {
+				var outline = this.outline_cache.get(file.path);
+				if (outline != null) {
+					outline.needs_reparse = true;
+				}
 				if (this.vector_scan != null) {
 					this.vector_scan.queue_file(
 						file, this.active_project);
@@ -586,5 +608,39 @@ namespace OLLMfilesd
 			return tree;
 		}
 		
+		/**
+		 * Get or create the cached Outline for the given file.
+		 * 
+		 * Entries are keyed by path and checked against the mtime on disk,
+		 * so a File object built per call (files outside the project) still
+		 * hits the cache while the file is unchanged. A missing file drops
+		 * its entry; {@link DeleteManager} drops entries of deleted files.
+		 * 
+		 * @param file The file to outline
+		 * @return Outline instance for the file
+		 */
+		public Outline outline_factory(File file)
+		{
+			var outline = this.outline_cache.get(file.path);
+			if (outline != null && outline.file == file) {
+				return outline;
+			}
+			var mtime = file.mtime_on_disk();
+			if (mtime <= 0) {
+				// Gone from disk - do not cache, get_outline reports the error
+				this.outline_cache.unset(file.path);
+				return new Outline(file);
+			}
+			// Another File for the same path: reuse while nothing it was built from moved
+			if (outline != null && outline.last_parsed == mtime
+				&& outline.last_vector_scan == file.last_vector_scan
+				&& outline.file.language == file.language) {
+				return outline;
+			}
+			outline = new Outline(file);
+			this.outline_cache.set(file.path, outline);
+			return outline;
+		}
+		
 	}
 }
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+namespace OLLMfilesd.SQT
+{
+	/**
+	 * One row of a {@link Vector.SymbolIndex} lookup: a definition
+	 * (''code_symbol'') or a call site (''code_ref'').
+	 *
+	 * Read-only result type; the tables are written by
+	 * {@link Vector.SymbolIndex.replace_file}.
+	 */
+	public class CodeSymbol : Object
+	{
+		public int64 id { get; set; default = 0; }
+		public int64 file_id { get; set; default = 0; }
+		/** Path of the file (joined from ''filebase''). */
+		public string path { get; set; default = ""; }
+		/** Symbol name, or called name for a reference. */
+		public string name { get; set; default = ""; }
+		/** Element type (''class'', ''method'', …) or ''call'' for a reference. */
+		public string kind { get; set; default = ""; }
+		/**
+		 * Enclosing definition: the containing class for a definition, the
+		 * calling method / function for a reference; "" at file level.
+		 */
+		public string container { get; set; default = ""; }
+		public int start_line { get; set; default = 0; }
+		public int end_line { get; set; default = 0; }
+		public string signature { get; set; default = ""; }
+
+		/**
+		 * One line for tool / CLI output, e.g.
+		 * ''src/Tree.vala:120 method Tree.parse — public async void parse()''.
+		 */
+		public string to_line()
+		{
+			var ret = this.path + ":" + this.start_line.to_string() + " " + this.kind + " ";
+			if (this.kind == "call") {
+				return ret + this.name + (this.container != "" ? " in " + this.container : "");
+			}
+			ret += (this.container != "" ? this.container + "." : "") + this.name;
+			if (this.signature != "") {
+				ret += " — " + this.signature;
+			}
+			return ret;
+		}
+
+		/**
+		 * JSON object for {@link VectorParams.format} {@code json}.
+		 */
+		public Json.Node to_json()
+		{
+			var builder = new Json.Builder();
+			builder.begin_object();
+			builder.set_member_name("file");
+			builder.add_string_value(this.path);
+			builder.set_member_name("name");
+			builder.add_string_value(this.name);
+			builder.set_member_name("kind");
+			builder.add_string_value(this.kind);
+			builder.set_member_name("container");
+			builder.add_string_value(this.container);
+			builder.set_member_name("start_line");
+			builder.add_int_value(this.start_line);
+			builder.set_member_name("end_line");
+			builder.add_int_value(this.end_line);
+			builder.set_member_name("signature");
+			builder.add_string_value(this.signature);
+			builder.end_object();
+			return builder.get_root();
+		}
+	}
+}
@@ -269,6 +269,13 @@ namespace OLLMfilesd.Vector
 				var mtime = file.mtime_on_disk();
 				if (file.last_vector_scan >= mtime && mtime > 0) {
 					GLib.debug("Skipping file '%s' (not modified since last scan)", file.path);
+					// Symbols predate the index (or were reset): parse only.
+					if (this.manager.symbol_index != null
+						&& !this.manager.symbol_index.is_current(file)) {
+						var symbol_tree = new Tree(file);
+						yield symbol_tree.parse();
+						this.manager.symbol_index.replace_file(file, symbol_tree);
+					}
 					return false;
 				}
 			}
@@ -285,6 +292,9 @@ namespace OLLMfilesd.Vector
 			yield tree.parse();
 
 			GLib.debug ("parsed path=%s elements=%d", file.path, tree.elements.size);
+			if (this.manager.symbol_index != null) {
+				this.manager.symbol_index.replace_file(file, tree);
+			}
 			
 			if (tree.elements.size == 0) {
 				GLib.debug("No elements found in file '%s'", file.path);
@@ -449,6 +459,9 @@ namespace OLLMfilesd.Vector
 				"DELETE FROM vector_metadata " +
 				"WHERE file_id NOT IN (SELECT id FROM filebase WHERE base_type = 'f')"
 			);
+			if (this.manager.symbol_index != null) {
+				this.manager.symbol_index.prune();
+			}
 			
 			return files_indexed;
 		}
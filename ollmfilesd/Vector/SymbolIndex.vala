@@ -0,0 +1,544 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+namespace OLLMfilesd.Vector
+{
+	/**
+	 * Persistent symbol table and call graph for code files.
+	 *
+	 * Built from the same tree-sitter pass as the vector index
+	 * ({@link Tree.elements}, {@link Tree.parents}, {@link Tree.references})
+	 * and stored in the project SQLite database, so "go to definition" and
+	 * "who calls X" ({@code Codebase.symbols} / {@code Codebase.references})
+	 * are index lookups with no embedding or LLM call.
+	 *
+	 * Layout (names interned once, rows are integers):
+	 *
+	 *  * ''code_name'' — id, name (unique)
+	 *  * ''code_symbol'' — definitions: file, name, containing symbol, kind, lines, signature
+	 *  * ''code_ref'' — call sites, clustered by called name (WITHOUT ROWID)
+	 *  * ''code_file'' — last_modified of each file when it was indexed
+	 *
+	 * Files are replaced one at a time ({@link replace_file}) when the
+	 * indexer parses them; {@link refresh} catches up files whose
+	 * ''last_modified'' moved on since, without waiting for the vector scan.
+	 * Writes mark the in-memory database dirty so they reach disk with the
+	 * next backup.
+	 */
+	public class SymbolIndex : Object
+	{
+		public SQ.Database db { get; construct; }
+
+		/* file_id → last_modified at index time; loaded on first use */
+		private Gee.HashMap<string, int64?>? scanned = null;
+		/* running refresh, shared by concurrent callers */
+		private Gee.Promise<int>? refreshing = null;
+
+		public SymbolIndex(SQ.Database db)
+		{
+			Object(db: db);
+		}
+
+		/**
+		 * Create the symbol tables.
+		 *
+		 * @param db Database instance
+		 */
+		public static void init_db(SQ.Database db)
+		{
+			string errmsg;
+			string[] queries = {
+				"CREATE TABLE IF NOT EXISTS code_name (" +
+					"id INTEGER PRIMARY KEY, " +
+					"name TEXT NOT NULL UNIQUE" +
+					");",
+				"CREATE TABLE IF NOT EXISTS code_symbol (" +
+					"id INTEGER PRIMARY KEY, " +
+					"file_id INTEGER NOT NULL, " +
+					"name_id INTEGER NOT NULL, " +
+					"parent_id INTEGER NOT NULL DEFAULT 0, " +
+					"kind TEXT NOT NULL DEFAULT '', " +
+					"start_line INTEGER NOT NULL DEFAULT 0, " +
+					"end_line INTEGER NOT NULL DEFAULT 0, " +
+					"signature TEXT NOT NULL DEFAULT ''" +
+					");",
+				"CREATE INDEX IF NOT EXISTS idx_code_symbol_name ON code_symbol(name_id);",
+				"CREATE INDEX IF NOT EXISTS idx_code_symbol_file ON code_symbol(file_id);",
+				"CREATE TABLE IF NOT EXISTS code_ref (" +
+					"name_id INTEGER NOT NULL, " +
+					"file_id INTEGER NOT NULL, " +
+					"line INTEGER NOT NULL, " +
+					"symbol_id INTEGER NOT NULL DEFAULT 0, " +
+					"PRIMARY KEY (name_id, file_id, line, symbol_id)" +
+					") WITHOUT ROWID;",
+				"CREATE INDEX IF NOT EXISTS idx_code_ref_file ON code_ref(file_id);",
+				"CREATE TABLE IF NOT EXISTS code_file (" +
+					"file_id INTEGER PRIMARY KEY, " +
+					"last_modified INT64 NOT NULL DEFAULT 0" +
+					");"
+			};
+			foreach (var query in queries) {
+				if (Sqlite.OK != db.db.exec(query, null, out errmsg)) {
+					GLib.warning("Failed to create symbol index table: %s", db.db.errmsg());
+				}
+			}
+		}
+
+		/**
+		 * Whether file's symbols were indexed at its current last_modified.
+		 */
+		public bool is_current(OLLMfilesd.File file)
+		{
+			this.load_scanned();
+			var at = this.scanned.get(file.id.to_string());
+			return at != null && at >= file.last_modified;
+		}
+
+		/**
+		 * Replace all symbols and references of one file with those of a
+		 * parsed tree, in one transaction.
+		 *
+		 * @param file Indexed file (must have an id)
+		 * @param tree Tree after {@link Tree.parse}
+		 */
+		public void replace_file(OLLMfilesd.File file, Tree tree)
+		{
+			if (file.id <= 0) {
+				return;
+			}
+			this.load_scanned();
+			var file_id = file.id.to_string();
+			var names = new Gee.HashMap<string, int64?>();
+			var ok = false;
+			this.db.db_mutex.lock();
+			try {
+				if (!this.run("BEGIN")) {
+					return;
+				}
+				ok = this.write_file(file, tree, names);
+				if (!ok || !this.run("COMMIT")) {
+					ok = false;
+					this.run("ROLLBACK");
+				}
+			} finally {
+				this.db.db_mutex.unlock();
+			}
+			if (!ok) {
+				GLib.warning("SymbolIndex: could not index %s", file.path);
+				return;
+			}
+			this.db.is_dirty = true;
+			this.scanned.set(file_id, file.last_modified);
+			GLib.debug("SymbolIndex: %s — %d symbols, %d references",
+				file.path, tree.elements.size, tree.references.size);
+		}
+
+		/**
+		 * Rows of {@link replace_file} inside its transaction; caller holds
+		 * the db mutex.
+		 *
+		 * @return false on the first failed statement (caller rolls back)
+		 */
+		private bool write_file(
+			OLLMfilesd.File file,
+			Tree tree,
+			Gee.HashMap<string, int64?> names)
+		{
+			var file_id = file.id.to_string();
+			if (!this.run("DELETE FROM code_symbol WHERE file_id = " + file_id)
+				|| !this.run("DELETE FROM code_ref WHERE file_id = " + file_id)) {
+				return false;
+			}
+			var name_insert = this.prepare("INSERT OR IGNORE INTO code_name (name) VALUES (?1)");
+			var name_select = this.prepare("SELECT id FROM code_name WHERE name = ?1");
+			var symbol_insert = this.prepare(
+				"INSERT INTO code_symbol " +
+				"(file_id, name_id, parent_id, kind, start_line, end_line, signature) " +
+				"VALUES (?1, ?2, ?3, ?4, ?5, ?6, ?7)");
+			var ref_insert = this.prepare(
+				"INSERT OR IGNORE INTO code_ref (name_id, file_id, line, symbol_id) " +
+				"VALUES (?1, ?2, ?3, ?4)");
+			if (name_insert == null || name_select == null
+				|| symbol_insert == null || ref_insert == null) {
+				return false;
+			}
+
+			var ids = new int64[tree.elements.size];
+			for (var i = 0; i < tree.elements.size; i++) {
+				var element = tree.elements.get(i);
+				// Analysis appends a file-level element after parse
+				var parent = i < tree.parents.size ? tree.parents.get(i) : -1;
+				var name_id = this.name_id(element.element_name, names, name_insert, name_select);
+				if (name_id <= 0) {
+					return false;
+				}
+				symbol_insert.reset();
+				symbol_insert.bind_int64(1, file.id);
+				symbol_insert.bind_int64(2, name_id);
+				symbol_insert.bind_int64(3, parent >= 0 ? ids[parent] : 0);
+				symbol_insert.bind_text(4, element.element_type);
+				symbol_insert.bind_int(5, element.start_line);
+				symbol_insert.bind_int(6, element.end_line);
+				symbol_insert.bind_text(7, element.signature);
+				if (symbol_insert.step() != Sqlite.DONE) {
+					GLib.warning("SymbolIndex: %s", this.db.db.errmsg());
+					return false;
+				}
+				ids[i] = this.db.db.last_insert_rowid();
+			}
+			foreach (var reference in tree.references) {
+				var name_id = this.name_id(reference.name, names, name_insert, name_select);
+				if (name_id <= 0) {
+					return false;
+				}
+				ref_insert.reset();
+				ref_insert.bind_int64(1, name_id);
+				ref_insert.bind_int64(2, file.id);
+				ref_insert.bind_int(3, reference.line);
+				ref_insert.bind_int64(4, reference.container >= 0 ? ids[reference.container] : 0);
+				if (ref_insert.step() != Sqlite.DONE) {
+					GLib.warning("SymbolIndex: %s", this.db.db.errmsg());
+					return false;
+				}
+			}
+			return this.run("INSERT OR REPLACE INTO code_file (file_id, last_modified) VALUES ("
+				+ file_id + ", " + file.last_modified.to_string() + ")");
+		}
+
+		/**
+		 * Code files of project whose symbols are missing or older than
+		 * their last_modified.
+		 */
+		public Gee.ArrayList<OLLMfilesd.File> stale_files(OLLMfilesd.Folder project)
+		{
+			var ret = new Gee.ArrayList<OLLMfilesd.File>();
+			foreach (var project_file in project.project_files) {
+				var file = project_file.file;
+				if (file.id <= 0 || file.is_ignored || file.delete_id > 0
+					|| !file.is_text || file.is_documentation() || this.is_current(file)) {
+					continue;
+				}
+				ret.add(file);
+			}
+			return ret;
+		}
+
+		/**
+		 * Parse and index the project's {@link stale_files}.
+		 *
+		 * One refresh runs at a time; a call while it is running waits for
+		 * it instead of parsing the same files again.
+		 *
+		 * @param project Project root folder
+		 * @return number of files (re)indexed
+		 */
+		public async int refresh(OLLMfilesd.Folder project)
+		{
+			if (this.refreshing != null) {
+				try {
+					return yield this.refreshing.future.wait_async();
+				} catch (Gee.FutureError e) {
+					return 0;
+				}
+			}
+			var promise = new Gee.Promise<int>();
+			this.refreshing = promise;
+			var ret = 0;
+			foreach (var file in this.stale_files(project)) {
+				var tree = new Tree(file);
+				try {
+					yield tree.parse();
+				} catch (GLib.Error e) {
+					GLib.debug("SymbolIndex: skip %s: %s", file.path, e.message);
+					continue;
+				}
+				this.replace_file(file, tree);
+				ret++;
+			}
+			if (ret > 0) {
+				this.db.backupDB();
+			}
+			this.refreshing = null;
+			promise.set_value(ret);
+			return ret;
+		}
+
+		/** True while a {@link refresh} is running. */
+		public bool is_refreshing {
+			get {
+				return this.refreshing != null;
+			}
+		}
+
+		/**
+		 * Definitions named name, e.g. ''parse'' or ''Tree.parse'' (the
+		 * part before the last dot must be the containing symbol).
+		 *
+		 * @param name Symbol name, optionally qualified by its container
+		 * @param file_ids Restrict to these filebase ids (project scope)
+		 * @param kind Element type filter ("" = any)
+		 * @param limit Maximum rows
+		 */
+		public Gee.ArrayList<SQT.CodeSymbol> definitions(
+			string name,
+			Gee.ArrayList<string> file_ids,
+			string kind = "",
+			int limit = 50)
+		{
+			var container = "";
+			var short_name = this.split_name(name, out container);
+			var sql = """
+SELECT
+	s.id, s.file_id, f.path, n.name, s.kind,
+	COALESCE(pn.name, ''), s.start_line, s.end_line, s.signature
+FROM
+	code_name n
+	JOIN code_symbol s ON s.name_id = n.id
+	JOIN filebase f ON f.id = s.file_id
+	LEFT JOIN code_symbol p ON p.id = s.parent_id
+	LEFT JOIN code_name pn ON pn.id = p.name_id
+WHERE
+		n.name = $name
+	AND
+		f.delete_id = 0""" +
+				(container != "" ? "\n\tAND\n\t\tpn.name = $container" : "") +
+				(kind != "" ? "\n\tAND\n\t\ts.kind = $kind" : "") +
+				this.file_filter("s.file_id", file_ids) + """
+ORDER BY
+	f.path, s.start_line
+LIMIT """ + limit.to_string();
+			return this.fetch(sql, short_name, container, kind);
+		}
+
+		/**
+		 * Call sites of name, with the calling function / method.
+		 *
+		 * References store the called identifier only, so a qualified
+		 * name is matched on its last part.
+		 *
+		 * @param name Called name (''parse'' or ''Tree.parse'')
+		 * @param file_ids Restrict to these filebase ids (project scope)
+		 * @param limit Maximum rows
+		 */
+		public Gee.ArrayList<SQT.CodeSymbol> references(
+			string name,
+			Gee.ArrayList<string> file_ids,
+			int limit = 100)
+		{
+			var container = "";
+			var short_name = this.split_name(name, out container);
+			var sql = """
+SELECT
+	0, r.file_id, f.path, n.name, 'call',
+	CASE
+		WHEN cpn.name IS NOT NULL THEN cpn.name || '.' || cn.name
+		ELSE COALESCE(cn.name, '')
+	END,
+	r.line, r.line, ''
+FROM
+	code_name n
+	JOIN code_ref r ON r.name_id = n.id
+	JOIN filebase f ON f.id = r.file_id
+	LEFT JOIN code_symbol c ON c.id = r.symbol_id
+	LEFT JOIN code_name cn ON cn.id = c.name_id
+	LEFT JOIN code_symbol cp ON cp.id = c.parent_id
+	LEFT JOIN code_name cpn ON cpn.id = cp.name_id
+WHERE
+		n.name = $name
+	AND
+		f.delete_id = 0""" +
+				this.file_filter("r.file_id", file_ids) + """
+ORDER BY
+	f.path, r.line
+LIMIT """ + limit.to_string();
+			return this.fetch(sql, short_name, "", "");
+		}
+
+		/**
+		 * All definitions in one file, in source order.
+		 */
+		public Gee.ArrayList<SQT.CodeSymbol> outline(int64 file_id)
+		{
+			var sql = """
+SELECT
+	s.id, s.file_id, f.path, n.name, s.kind,
+	COALESCE(pn.name, ''), s.start_line, s.end_line, s.signature
+FROM
+	code_symbol s
+	JOIN code_name n ON n.id = s.name_id
+	JOIN filebase f ON f.id = s.file_id
+	LEFT JOIN code_symbol p ON p.id = s.parent_id
+	LEFT JOIN code_name pn ON pn.id = p.name_id
+WHERE
+	s.file_id = """ + file_id.to_string() + """
+ORDER BY
+	s.start_line""";
+			return this.fetch(sql, "", "", "");
+		}
+
+		/**
+		 * Drop rows of files that were deleted or are no longer files.
+		 */
+		public void prune()
+		{
+			var gone = "(SELECT id FROM filebase WHERE base_type = 'f' AND delete_id = 0)";
+			this.db.exec("DELETE FROM code_symbol WHERE file_id NOT IN " + gone);
+			this.db.exec("DELETE FROM code_ref WHERE file_id NOT IN " + gone);
+			this.db.exec("DELETE FROM code_file WHERE file_id NOT IN " + gone);
+			this.db.is_dirty = true;
+			this.scanned = null;
+		}
+
+		/**
+		 * Remove every symbol, reference and name (''Codebase.reset'').
+		 */
+		public void reset()
+		{
+			this.db.exec("DELETE FROM code_symbol");
+			this.db.exec("DELETE FROM code_ref");
+			this.db.exec("DELETE FROM code_file");
+			this.db.exec("DELETE FROM code_name");
+			this.db.is_dirty = true;
+			this.scanned = null;
+		}
+
+		private void load_scanned()
+		{
+			if (this.scanned != null) {
+				return;
+			}
+			this.scanned = new Gee.HashMap<string, int64?>();
+			this.db.db_mutex.lock();
+			var stmt = this.prepare("SELECT file_id, last_modified FROM code_file");
+			while (stmt != null && stmt.step() == Sqlite.ROW) {
+				this.scanned.set(stmt.column_int64(0).to_string(), stmt.column_int64(1));
+			}
+			this.db.db_mutex.unlock();
+		}
+
+		private string split_name(string name, out string container)
+		{
+			container = "";
+			var parts = name.strip().split(".");
+			if (parts.length < 2) {
+				return name.strip();
+			}
+			container = parts[parts.length - 2];
+			return parts[parts.length - 1];
+		}
+
+		private string file_filter(string column, Gee.ArrayList<string> file_ids)
+		{
+			return "\n\tAND\n\t\t" + column + " IN ("
+				+ string.joinv(",", file_ids.to_array()) + ")";
+		}
+
+		private Gee.ArrayList<SQT.CodeSymbol> fetch(
+			string sql,
+			string name,
+			string container,
+			string kind)
+		{
+			var ret = new Gee.ArrayList<SQT.CodeSymbol>();
+			this.db.db_mutex.lock();
+			var stmt = this.prepare(sql);
+			if (stmt == null) {
+				this.db.db_mutex.unlock();
+				return ret;
+			}
+			var idx = stmt.bind_parameter_index("$name");
+			if (idx > 0) {
+				stmt.bind_text(idx, name);
+			}
+			idx = stmt.bind_parameter_index("$container");
+			if (idx > 0) {
+				stmt.bind_text(idx, container);
+			}
+			idx = stmt.bind_parameter_index("$kind");
+			if (idx > 0) {
+				stmt.bind_text(idx, kind);
+			}
+			while (stmt.step() == Sqlite.ROW) {
+				ret.add(new SQT.CodeSymbol() {
+					id = stmt.column_int64(0),
+					file_id = stmt.column_int64(1),
+					path = stmt.column_text(2) ?? "",
+					name = stmt.column_text(3) ?? "",
+					kind = stmt.column_text(4) ?? "",
+					container = stmt.column_text(5) ?? "",
+					start_line = stmt.column_int(6),
+					end_line = stmt.column_int(7),
+					signature = stmt.column_text(8) ?? ""
+				});
+			}
+			this.db.db_mutex.unlock();
+			return ret;
+		}
+
+		/** Interned id of name, 0 on failure; caller holds the db mutex. */
+		private int64 name_id(
+			string name,
+			Gee.HashMap<string, int64?> names,
+			Sqlite.Statement insert,
+			Sqlite.Statement select)
+		{
+			var cached = names.get(name);
+			if (cached != null) {
+				return cached;
+			}
+			insert.reset();
+			insert.bind_text(1, name);
+			if (insert.step() != Sqlite.DONE) {
+				return 0;
+			}
+			select.reset();
+			select.bind_text(1, name);
+			int64 ret = 0;
+			if (select.step() == Sqlite.ROW) {
+				ret = select.column_int64(0);
+			}
+			names.set(name, ret);
+			return ret;
+		}
+
+		/**
+		 * Prepare a statement, or null (with a warning) when it does not
+		 * match the schema; caller holds the db mutex.
+		 */
+		private Sqlite.Statement? prepare(string sql)
+		{
+			Sqlite.Statement stmt;
+			if (Sqlite.OK != this.db.db.prepare_v2(sql, -1, out stmt)) {
+				GLib.warning("SymbolIndex: %s from query %s", this.db.db.errmsg(), sql);
+				return null;
+			}
+			return stmt;
+		}
+
+		/** Execute sql; caller holds the db mutex. */
+		private bool run(string sql)
+		{
+			string errmsg;
+			if (Sqlite.OK != this.db.db.exec(sql, null, out errmsg)) {
+				GLib.warning("SymbolIndex: %s (%s)", errmsg, sql);
+				return false;
+			}
+			return true;
+		}
+	}
+}
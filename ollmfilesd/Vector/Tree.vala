@@ -26,12 +26,63 @@ namespace OLLMfilesd.Vector
 	 */
 	public class Tree : OLLMfilesd.TreeBase
 	{
+		/**
+		 * A call or instantiation found in the AST, for {@link SymbolIndex}.
+		 */
+		public class Reference : Object
+		{
+			/** Called name (last identifier of the callee, e.g. ''parse''). */
+			public string name = "";
+			/** 1-based line of the call. */
+			public int line = 0;
+			/** Index in {@link elements} of the enclosing element, or -1. */
+			public int container = -1;
+		}
+
 		/**
 		 * Array of OLLMvector2.SQT.VectorMetadata objects extracted from the AST.
 		 */
 		public Gee.ArrayList<OLLMvector2.SQT.VectorMetadata> elements { 
 				get; private set; default = new Gee.ArrayList<OLLMvector2.SQT.VectorMetadata>(); }
 		
+		/**
+		 * For each entry in {@link elements}, the index of the element it is
+		 * nested in, or -1 at file level.
+		 */
+		public Gee.ArrayList<int> parents { 
+				get; private set; default = new Gee.ArrayList<int>(); }
+		
+		/**
+		 * Calls and instantiations in the file, in source order.
+		 */
+		public Gee.ArrayList<Reference> references { 
+				get; private set; default = new Gee.ArrayList<Reference>(); }
+		
+		/**
+		 * Node types that call or instantiate something, across the
+		 * supported grammars.
+		 */
+		private static Gee.HashSet<string> call_node_types;
+		
+		static construct
+		{
+			call_node_types = new Gee.HashSet<string>();
+			foreach (var type in new string[] {
+				"call_expression",
+				"call",
+				"invocation_expression",
+				"method_invocation",
+				"method_call_expression",
+				"function_call_expression",
+				"member_call_expression",
+				"scoped_call_expression",
+				"object_creation_expression",
+				"new_expression"
+			}) {
+				call_node_types.add(type);
+			}
+		}
+		
 		/**
 		 * Cached metadata from database, keyed by ast_path (or element_type:element_name fallback).
 		 * Loaded before parsing to enable incremental analysis.
@@ -83,7 +134,7 @@ namespace OLLMfilesd.Vector
 			
 			// Traverse AST and extract elements
 			var root_node = tree.get_root_node();
-			this.traverse_ast(root_node, code_content, null, null, null);
+			this.traverse_ast(root_node, code_content, null, null, null, -1);
 		}
 		
 		/**
@@ -91,12 +142,14 @@ namespace OLLMfilesd.Vector
 		 * 
 		 * @param node Current AST node
 		 * @param code_content Source code content for text extraction
+		 * @param container Index in elements of the enclosing element, or -1
 		 */
 		private void traverse_ast(TreeSitter.Node node, 
 			string code_content,
 			string? parent_enum_name = null, 
 			string? current_namespace = null, 
-			string? parent_class_name = null)
+			string? parent_class_name = null,
+			int container = -1)
 		{
 			if (TreeSitter.node_is_null(node)) {
 				return;
@@ -119,14 +172,73 @@ namespace OLLMfilesd.Vector
 			var metadata = this.extract_element_metadata(node, code_content, current_parent_enum, updated_namespace, updated_parent_class);
 			if (metadata != null) {
 				this.elements.add(metadata);
+				this.parents.add(container);
+				container = this.elements.size - 1;
+			}
+			
+			if (call_node_types.contains(node_type_lower)) {
+				this.extract_reference(node, code_content, container);
 			}
 			
 			// Recursively traverse children, passing down the parent enum name, namespace, and parent class
 			uint child_count = TreeSitter.node_get_child_count(node);
 			for (uint i = 0; i < child_count; i++) {
 				var child = TreeSitter.node_get_child(node, i);
-				this.traverse_ast(child, code_content, current_parent_enum, updated_namespace, updated_parent_class);
+				this.traverse_ast(child, code_content, current_parent_enum, updated_namespace, updated_parent_class, container);
+			}
+		}
+		
+		/**
+		 * Record the callee of a call / instantiation node in {@link references}.
+		 * 
+		 * The callee is the grammar's function / name / constructor / type
+		 * field (first named child otherwise); only its last identifier is
+		 * kept, so ''this.tree.parse()'' and ''Tree.parse()'' both refer to
+		 * ''parse''.
+		 * 
+		 * @param node Call or object creation node
+		 * @param code_content Source code content for text extraction
+		 * @param container Index in elements of the enclosing element, or -1
+		 */
+		private void extract_reference(TreeSitter.Node node, string code_content, int container)
+		{
+			TreeSitter.Node callee = TreeSitter.node_get_child_by_field_name(node, "function", 8);
+			foreach (var field_name in new string[] { "name", "method", "constructor", "type" }) {
+				if (!TreeSitter.node_is_null(callee)) {
+					break;
+				}
+				callee = TreeSitter.node_get_child_by_field_name(node, field_name, (uint32)field_name.length);
+			}
+			if (TreeSitter.node_is_null(callee)) {
+				if (TreeSitter.node_get_named_child_count(node) == 0) {
+					return;
+				}
+				callee = TreeSitter.node_get_named_child(node, 0);
+			}
+			var start_byte = TreeSitter.node_get_start_byte(callee);
+			var end_byte = TreeSitter.node_get_end_byte(callee);
+			if (end_byte <= start_byte || end_byte - start_byte > 200) {
+				return;
+			}
+			var text = code_content.substring((int)start_byte, (int)(end_byte - start_byte));
+			// Drop generic arguments / trailing call syntax, keep the last identifier
+			var cut = text.index_of_char('<');
+			if (cut > 0) {
+				text = text.substring(0, cut);
+			}
+			MatchInfo match_info;
+			if (!/([A-Za-z_][A-Za-z0-9_]*)\s*$/.match(text, 0, out match_info)) {
+				return;
+			}
+			var name = match_info.fetch(1);
+			if (name == null || name.length < 2) {
+				return;
 			}
+			this.references.add(new Reference() {
+				name = name,
+				line = (int)TreeSitter.node_get_start_point(node).row + 1,
+				container = container
+			});
 		}
 		
 		/**
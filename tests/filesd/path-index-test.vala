@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/*
+ * OLLMfilesd.PathIndex on a small in-memory file list:
+ *   ranking      basename prefix > basename substring > path subsequence
+ *   refinement   typing one more character reuses the previous candidates
+ *   paging       offset/limit with the total match count
+ *   wildcard     '*' / '?' match the whole relative path, sorted by path
+ *   removal      removed keys stop matching; re-added keys match again
+ */
+
+namespace FilesdTests
+{
+	class Row : Object
+	{
+		public string path;
+
+		public Row(string path)
+		{
+			this.path = path;
+		}
+	}
+
+	string paths(Gee.ArrayList<GLib.Object> rows)
+	{
+		var ret = new string[0];
+		foreach (var obj in rows) {
+			ret += ((Row) obj).path;
+		}
+		return string.joinv(",", ret);
+	}
+
+	string? run()
+	{
+		var index = new OLLMfilesd.PathIndex();
+		foreach (var p in new string[] {
+			"src/main.vala",
+			"src/Folder.vala",
+			"src/ProjectFiles.vala",
+			"docs/folder-notes.md",
+			"tests/meson.build",
+			"meson.build",
+		}) {
+			index.add("/proj/" + p, p, new Row(p));
+		}
+
+		int total;
+		var got = paths(index.search("fold", 0, 10, out total));
+		if (total != 2 || got != "src/Folder.vala,docs/folder-notes.md") {
+			return "rank 'fold': " + got;
+		}
+		got = paths(index.search("meson", 0, 10, out total));
+		if (total != 2 || !got.has_prefix("meson.build")) {
+			return "rank 'meson': " + got;
+		}
+		got = paths(index.search("spf", 0, 10, out total));
+		if (total != 1 || got != "src/ProjectFiles.vala") {
+			return "subsequence 'spf': " + got;
+		}
+
+		// one character at a time, as the dropdown sends it
+		foreach (var q in new string[] { "v", "va", "val", "vala" }) {
+			index.search(q, 0, 10, out total);
+		}
+		if (total != 3) {
+			return "refined 'vala' total " + total.to_string();
+		}
+
+		got = paths(index.search("vala", 1, 1, out total));
+		if (total != 3 || got == "") {
+			return "paging 'vala': " + got;
+		}
+
+		got = paths(index.search("src/*.vala", 0, 10, out total));
+		if (total != 3 || got != "src/Folder.vala,src/main.vala,src/ProjectFiles.vala") {
+			return "wildcard: " + got;
+		}
+
+		index.remove("/proj/src/Folder.vala");
+		got = paths(index.search("fold", 0, 10, out total));
+		if (total != 1 || got != "docs/folder-notes.md") {
+			return "after remove: " + got;
+		}
+		index.add("/proj/src/Folder.vala", "src/Folder.vala", new Row("src/Folder.vala"));
+		index.search("fold", 0, 10, out total);
+		if (total != 2 || index.size != 6) {
+			return "after re-add: " + total.to_string();
+		}
+		return null;
+	}
+
+	public static int main(string[] args)
+	{
+		var failure = run();
+		if (failure != null) {
+			GLib.printerr("path-index-test: %s\n", failure);
+			return 1;
+		}
+		return 0;
+	}
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/*
+ * OLLMfilesd.PositionList, the position map and batching behind
+ * ProjectFiles:
+ *   lookup        position_of follows inserts and removals outside a batch
+ *   sparse        several removals far apart in one batch compact in one
+ *                 pass and emit one items_changed from the first of them
+ *   insert        an insert inside a batch (after removals) lands at the
+ *                 position counted without the removed entries
+ *   appends       a batch of appends only is reported as one append
+ *   nesting       only the outermost end_batch emits
+ */
+
+namespace FilesdTests
+{
+	class Item : Object
+	{
+		public string name;
+
+		public Item(string name)
+		{
+			this.name = name;
+		}
+	}
+
+	class Changes : Object
+	{
+		public string log = "";
+
+		public void watch(OLLMfilesd.PositionList<Item> list)
+		{
+			list.items_changed.connect((position, removed, added) => {
+				this.log += "%u-%u+%u ".printf(position, removed, added);
+			});
+		}
+
+		public string take()
+		{
+			var ret = this.log.strip();
+			this.log = "";
+			return ret;
+		}
+	}
+
+	OLLMfilesd.PositionList<Item> make(string keys, Changes changes)
+	{
+		var list = new OLLMfilesd.PositionList<Item>(new Gee.ArrayList<Item>(), (item) => {
+			return item.name;
+		});
+		foreach (var name in keys.split(" ")) {
+			list.append(new Item(name));
+		}
+		changes.watch(list);
+		return list;
+	}
+
+	string names(OLLMfilesd.PositionList<Item> list)
+	{
+		var ret = new string[0];
+		foreach (var item in list.items) {
+			ret += item.name;
+		}
+		return string.joinv(" ", ret);
+	}
+
+	/** Every item is found at its index, and a missing key is not. */
+	string? check_positions(OLLMfilesd.PositionList<Item> list, string label)
+	{
+		for (var i = 0; i < list.items.size; i++) {
+			var got = list.position_of(list.items[i].name);
+			if (got != i) {
+				return "%s: position_of(%s) = %d, want %d".printf(
+					label, list.items[i].name, got, i);
+			}
+		}
+		if (list.position_of("missing") != -1) {
+			return label + ": found a missing key";
+		}
+		return null;
+	}
+
+	string? expect(string label, string got, string want)
+	{
+		if (got != want) {
+			return "%s: got '%s', want '%s'".printf(label, got, want);
+		}
+		return null;
+	}
+
+	string? run()
+	{
+		var changes = new Changes();
+		string? failure;
+
+		// outside a batch every change is reported at once
+		var list = make("a b c d", changes);
+		list.insert(1, new Item("x"));
+		list.remove_at(3);
+		failure = expect("single insert / remove", changes.take(), "1-0+1 3-1+0")
+			?? expect("single order", names(list), "a x b d")
+			?? check_positions(list, "single");
+		if (failure != null) {
+			return failure;
+		}
+
+		// sparse removes: one compaction, one range from the first removal
+		list = make("a b c d e f g h", changes);
+		list.position_of("h");
+		list.begin_batch();
+		list.remove_at(1);
+		list.remove_at(4);
+		list.remove_at(6);
+		list.remove_at(4); // already removed in this batch: no-op
+		if (list.live_at(4) != null || !list.is_dropped(6) || list.position_of("e") != -1
+				|| list.position_of("f") != 5) {
+			return "sparse: removed slots still visible inside the batch";
+		}
+		failure = expect("sparse inside batch", changes.take(), "");
+		if (failure != null) {
+			return failure;
+		}
+		list.end_batch();
+		failure = expect("sparse end_batch", changes.take(), "1-7+4")
+			?? expect("sparse order", names(list), "a c d f h")
+			?? check_positions(list, "sparse");
+		if (failure != null) {
+			return failure;
+		}
+
+		// insert during a batch, after a removal and an append
+		list = make("a b c d e", changes);
+		list.begin_batch();
+		list.remove_at(3);
+		list.append(new Item("f"));
+		list.insert(1, new Item("x"));
+		failure = expect("insert order inside batch", names(list), "a x b c e f")
+			?? check_positions(list, "insert inside batch");
+		if (failure != null) {
+			return failure;
+		}
+		list.end_batch();
+		failure = expect("insert end_batch", changes.take(), "1-4+5")
+			?? check_positions(list, "insert");
+		if (failure != null) {
+			return failure;
+		}
+
+		// appends only are reported as an append; nested batches emit once
+		list = make("a b", changes);
+		list.begin_batch();
+		list.append(new Item("c"));
+		list.begin_batch();
+		list.append(new Item("d"));
+		list.end_batch();
+		failure = expect("nested inner end_batch", changes.take(), "");
+		if (failure != null) {
+			return failure;
+		}
+		list.end_batch();
+		failure = expect("appends end_batch", changes.take(), "2-0+2")
+			?? check_positions(list, "appends");
+		if (failure != null) {
+			return failure;
+		}
+
+		// an empty batch emits nothing; clear inside a batch reports from 0
+		list.begin_batch();
+		list.end_batch();
+		list.begin_batch();
+		list.clear();
+		list.append(new Item("z"));
+		list.end_batch();
+		return expect("clear end_batch", changes.take(), "0-4+1")
+			?? check_positions(list, "clear");
+	}
+
+	public static int main(string[] args)
+	{
+		var failure = run();
+		if (failure != null) {
+			GLib.printerr("position-list-test: %s\n", failure);
+			return 1;
+		}
+		return 0;
+	}
+}
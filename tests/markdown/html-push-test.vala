@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/*
+ * Markdown.HtmlParser fed in chunks must give the same markdown as a
+ * single convert(), for any chunk size (including splits inside tags,
+ * entities and multi-byte characters). After every push the
+ * incrementally kept Writer.line_count() must match a full recount,
+ * including after tables, which rewrite the output with shorten().
+ */
+
+namespace MarkdownTests
+{
+	const string[] DOCS = {
+		"<html><head><title>Title</title></head><body>"
+			+ "<h1>Heading</h1><p>Some <b>bold</b> and <i>italic</i> text &amp; an "
+			+ "entity, caf\xc3\xa9 and \xe2\x80\x94 dashes.</p>"
+			+ "<ul><li>one</li><li>two <a href=\"https://example.com/\">link</a></li></ul>"
+			+ "<ol><li>first</li><li>second</li></ol>"
+			+ "<pre><code>line 1\nline 2\n\n\nline 5</code></pre>"
+			+ "<blockquote>quoted</blockquote></body></html>",
+		"<table><tr><th>A</th><th>B</th></tr>"
+			+ "<tr><td>1</td><td>two words</td></tr>"
+			+ "<tr><td>3</td><td>4</td></tr></table>"
+			+ "<p>after the table</p><div style=\"display:none\">hidden</div>"
+			+ "<p>" + "a long paragraph that has to be wrapped at the soft break "
+			+ "because it keeps going well past eighty characters of text</p>",
+		"<p>unclosed <b>tags<p>and<br>breaks",
+	};
+
+	int count_lines(string s)
+	{
+		var ret = 0;
+		for (var i = 0; i < s.length; i++) {
+			if (s[i] == '\n') {
+				ret++;
+			}
+		}
+		return ret;
+	}
+
+	string? check(string html, int chunk_size)
+	{
+		var want = new Markdown.HtmlParser(html).convert();
+		var parser = new Markdown.HtmlParser("");
+		unowned uint8[] data = html.data;
+		for (var pos = 0; pos < data.length; pos += chunk_size) {
+			parser.push(data[pos:int.min(pos + chunk_size, data.length)]);
+			var counted = count_lines(parser.writer.to_string());
+			if (parser.writer.line_count() != counted) {
+				return "chunk %d at %d: line_count %d, recount %d".printf(
+					chunk_size, pos, parser.writer.line_count(), counted);
+			}
+		}
+		var got = parser.finish();
+		if (got != want) {
+			return "chunk %d: push gave\n%s\nconvert gave\n%s".printf(chunk_size, got, want);
+		}
+		if (parser.writer.line_count() != count_lines(got)) {
+			return "chunk %d: line_count after finish".printf(chunk_size);
+		}
+		return null;
+	}
+
+	public static int main(string[] args)
+	{
+		var failed = 0;
+		foreach (var html in DOCS) {
+			foreach (var chunk_size in new int[] { 1, 2, 7, 64, 4096 }) {
+				var failure = check(html, chunk_size);
+				if (failure != null) {
+					GLib.printerr("html-push-test: %s\n", failure);
+					failed++;
+				}
+			}
+		}
+		return failed == 0 ? 0 : 1;
+	}
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/*
+ * MarkdownGtk.RenderBox row parking, in a real (offscreen-sized) window:
+ *   text rows    parking frees the TextView, keeps the buffer and leaves a
+ *                placeholder of the same height; unpark builds a new view
+ *                on the same buffer in the same slot
+ *   other rows   are hidden behind the placeholder and shown again
+ *   unpark_all   every row comes back, in order (used after a resize)
+ * Skipped (exit 77) when no display is available.
+ */
+
+namespace MarkdownGtkTests
+{
+	Gtk.Window window;
+	MarkdownGtk.RenderBox box;
+
+	/** Run the main loop until every row has a height, or give up. */
+	bool settle()
+	{
+		var deadline = GLib.get_monotonic_time() + 5 * GLib.TimeSpan.SECOND;
+		while (GLib.get_monotonic_time() < deadline) {
+			GLib.MainContext.default().iteration(false);
+			var ready = true;
+			for (var i = 0; i < box.by_id.size; i++) {
+				if (box.row(i).get_height() <= 0) {
+					ready = false;
+				}
+			}
+			if (ready) {
+				return true;
+			}
+			GLib.Thread.usleep(10000);
+		}
+		return false;
+	}
+
+	string text_of(Gtk.TextBuffer buffer)
+	{
+		Gtk.TextIter start, end;
+		buffer.get_bounds(out start, out end);
+		return buffer.get_text(start, end, false);
+	}
+
+	/** Row widgets in box order, as ids; -1 for a widget that is not a current row. */
+	string order()
+	{
+		var ret = new GLib.StringBuilder();
+		for (var child = box.get_first_child(); child != null; child = child.get_next_sibling()) {
+			if (!child.visible) {
+				continue;
+			}
+			var id = -1;
+			for (var i = 0; i < box.by_id.size; i++) {
+				if (box.row(i) == child) {
+					id = i;
+				}
+			}
+			ret.append(id.to_string() + " ");
+		}
+		return ret.str.strip();
+	}
+
+	string? run()
+	{
+		for (var i = 0; i < 4; i++) {
+			var row = MarkdownGtk.RenderBox.new_text_view();
+			row.buffer.text = "row %d\nsecond line\nthird line".printf(i);
+			box.appender(row);
+		}
+		box.appender(new Gtk.Separator(Gtk.Orientation.HORIZONTAL) {
+			margin_top = 6,
+			margin_bottom = 6
+		});
+		if (!settle()) {
+			return "rows were never allocated";
+		}
+
+		// text row: the view is freed, the buffer survives
+		Gtk.TextView? view = (Gtk.TextView) box.by_id.get(1);
+		var buffer = view.buffer;
+		var height = view.get_height();
+		var freed = false;
+		view.weak_ref((obj) => {
+			freed = true;
+		});
+		view = null;
+		if (!box.park(1)) {
+			return "park(1) refused a finished text row";
+		}
+		if (!freed) {
+			return "parked TextView is still alive";
+		}
+		var holder = box.row(1);
+		if (holder is Gtk.TextView || holder.height_request != height || box.by_id.get(1) != holder) {
+			return "placeholder for row 1 does not stand in for it (height %d, want %d)".printf(
+				holder.height_request, height);
+		}
+		if (box.park(1)) {
+			return "park(1) twice";
+		}
+
+		// other rows are only hidden
+		var separator = box.by_id.get(4);
+		if (!box.park(4) || separator.visible || box.by_id.get(4) != separator) {
+			return "separator was not hidden in place";
+		}
+		if (box.n_parked != 2 || order() != "0 1 2 3 4") {
+			return "after park: n_parked %d, order %s".printf(box.n_parked, order());
+		}
+
+		box.unpark(1);
+		var rebuilt = box.by_id.get(1) as Gtk.TextView;
+		if (rebuilt == null || rebuilt.buffer != buffer
+				|| text_of(rebuilt.buffer) != "row 1\nsecond line\nthird line") {
+			return "unpark(1) did not rebuild the view on its buffer";
+		}
+		if (!rebuilt.has_css_class("oc-markdown-text") || rebuilt.editable) {
+			return "rebuilt view differs from new_text_view()";
+		}
+
+		box.park(0);
+		box.park(2);
+		box.unpark_all();
+		if (box.n_parked != 0 || !separator.visible || order() != "0 1 2 3 4") {
+			return "after unpark_all: n_parked %d, order %s".printf(box.n_parked, order());
+		}
+		for (var child = box.get_first_child(); child != null; child = child.get_next_sibling()) {
+			if (!(child is Gtk.TextView) && !(child is Gtk.Separator)) {
+				return "placeholder left in the box";
+			}
+		}
+		if (!settle()) {
+			return "rebuilt rows were never allocated";
+		}
+		return null;
+	}
+
+	public static int main(string[] args)
+	{
+		if (!Gtk.init_check()) {
+			GLib.printerr("render-box-test: no display, skipped\n");
+			return 77;
+		}
+		box = new MarkdownGtk.RenderBox();
+		window = new Gtk.Window() {
+			default_width = 400,
+			default_height = 600,
+			child = box
+		};
+		window.present();
+		var failure = run();
+		window.destroy();
+		if (failure != null) {
+			GLib.printerr("render-box-test: %s\n", failure);
+			return 1;
+		}
+		return 0;
+	}
+}
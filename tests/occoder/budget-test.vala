@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * OLLMcoder.Task.Budget, the slot cap shared by concurrent task phases:
+ *   cap          at most max_in_flight holders; the rest queue
+ *   order        queued callers are served first in, first out
+ *   speculation  try_acquire never jumps the queue or exceeds the cap
+ *   serial       replay runs one phase at a time
+ */
+
+namespace OccoderTests
+{
+	string order = "";
+
+	async void phase(OLLMcoder.Task.Budget budget, string name)
+	{
+		yield budget.acquire();
+		order += name;
+	}
+
+	string? run()
+	{
+		var loop = new GLib.MainLoop();
+		var budget = new OLLMcoder.Task.Budget() { max_in_flight = 2 };
+		for (var i = 0; i < 4; i++) {
+			phase.begin(budget, "abcd"[i:i + 1]);
+		}
+		if (order != "ab") {
+			return "cap: " + order;
+		}
+		if (budget.try_acquire()) {
+			return "try_acquire with callers queued";
+		}
+		budget.release();
+		GLib.Idle.add(() => {
+			loop.quit();
+			return false;
+		});
+		loop.run();
+		if (order != "abc") {
+			return "order after one release: " + order;
+		}
+		budget.release();
+		GLib.Idle.add(() => {
+			loop.quit();
+			return false;
+		});
+		loop.run();
+		if (order != "abcd") {
+			return "order after two releases: " + order;
+		}
+		// c and d hold the two slots
+		if (budget.try_acquire()) {
+			return "try_acquire over the cap";
+		}
+		budget.release();
+		if (!budget.try_acquire()) {
+			return "try_acquire with a free slot";
+		}
+		budget.release();
+		budget.release();
+
+		var serial = new OLLMcoder.Task.Budget() { max_in_flight = 4, serial = true };
+		if (!serial.try_acquire() || serial.try_acquire()) {
+			return "serial allows more than one";
+		}
+		serial.release();
+		if (!serial.try_acquire()) {
+			return "serial slot not released";
+		}
+		return null;
+	}
+
+	public static int main(string[] args)
+	{
+		var failure = run();
+		if (failure != null) {
+			GLib.printerr("budget-test: %s\n", failure);
+			return 1;
+		}
+		return 0;
+	}
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * OLLMcoder.Task.Refined, the approval gate's wait on a step's refinements:
+ *   approval   a flag set by a refinement that finishes last is seen by the gate
+ *   waiters    the gate and a task's own execution can wait on one refinement
+ *   failure    wait_all keeps waiting after a failure, then rethrows it
+ *   restart    reset keeps queued waiters until the next finish
+ */
+
+namespace OccoderTests
+{
+	/** Stand-in for a Details: its refinement and the flag it may set. */
+	class FakeTask : Object
+	{
+		public OLLMcoder.Task.Refined refined = new OLLMcoder.Task.Refined();
+		public bool requires_user_approval = false;
+	}
+
+	string events = "";
+
+	/** What List.run_step_until_approval does before running a step. */
+	async void gate(Gee.ArrayList<FakeTask> step)
+	{
+		var list = new Gee.ArrayList<OLLMcoder.Task.Refined>();
+		foreach (var t in step) {
+			list.add(t.refined);
+		}
+		try {
+			yield OLLMcoder.Task.Refined.wait_all(list);
+		} catch (GLib.Error e) {
+			events += "[error " + e.message + "]";
+			return;
+		}
+		foreach (var t in step) {
+			if (t.requires_user_approval) {
+				events += "[approval]";
+				return;
+			}
+		}
+		events += "[run]";
+	}
+
+	/** What List.run_child does before executing a task. */
+	async void exec(FakeTask t, string name)
+	{
+		try {
+			yield t.refined.wait();
+		} catch (GLib.Error e) {
+			events += "[" + name + " failed]";
+			return;
+		}
+		events += "[" + name + "]";
+	}
+
+	void drain()
+	{
+		var ctx = GLib.MainContext.default();
+		while (ctx.pending()) {
+			ctx.iteration(false);
+		}
+	}
+
+	string? run()
+	{
+		var step = new Gee.ArrayList<FakeTask>();
+		for (var i = 0; i < 3; i++) {
+			step.add(new FakeTask());
+		}
+		gate.begin(step);
+		exec.begin(step.get(2), "c");
+		step.get(0).refined.finish();
+		step.get(1).refined.finish();
+		drain();
+		if (events != "") {
+			return "gate or exec ran before refinement finished: " + events;
+		}
+		// Refinement output of the last task asks for approval
+		step.get(2).requires_user_approval = true;
+		step.get(2).refined.finish();
+		drain();
+		if (!events.contains("[approval]") || events.contains("[run]")) {
+			return "approval set by refinement not seen: " + events;
+		}
+		if (!events.contains("[c]")) {
+			return "second waiter not resumed: " + events;
+		}
+
+		events = "";
+		var failing = new Gee.ArrayList<FakeTask>();
+		failing.add(new FakeTask());
+		failing.add(new FakeTask());
+		gate.begin(failing);
+		failing.get(0).refined.finish(new GLib.IOError.FAILED("first"));
+		drain();
+		if (events != "") {
+			return "wait_all returned before every refinement stopped: " + events;
+		}
+		failing.get(1).refined.finish();
+		drain();
+		if (events != "[error first]") {
+			return "failure: " + events;
+		}
+
+		events = "";
+		var retry = new FakeTask();
+		exec.begin(retry, "r");
+		retry.refined.reset();
+		drain();
+		if (events != "") {
+			return "reset resumed a waiter: " + events;
+		}
+		retry.refined.finish();
+		drain();
+		if (events != "[r]") {
+			return "restart: " + events;
+		}
+		exec.begin(retry, "done");
+		drain();
+		if (events != "[r][done]") {
+			return "wait after finish: " + events;
+		}
+		return null;
+	}
+
+	public static int main(string[] args)
+	{
+		var failure = run();
+		if (failure != null) {
+			GLib.printerr("refined-test: %s\n", failure);
+			return 1;
+		}
+		return 0;
+	}
+}
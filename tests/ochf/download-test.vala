@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/*
+ * OLLMhf.Download against a local Soup.Server that serves byte ranges:
+ *   - two files fetched in 64 KiB segments, 3 at a time, SHA-256 checked
+ *     against the ETag
+ *   - one segment fails on the first run; the second run resumes from
+ *     download.json and fetches only what was not finished
+ *   - OLLMhf.Sha256 matches GLib.Checksum, including across a
+ *     to_state / from_state round trip part way through
+ */
+
+namespace OLLMhfTests
+{
+	const int64 SEGMENT = 64 * 1024;
+
+	GLib.HashTable<string, GLib.Bytes> files;
+	int64 bytes_served = 0;
+	bool fail_once = true;
+
+	GLib.Bytes make_file(int64 size, uint8 seed)
+	{
+		var data = new uint8[(int) size];
+		for (var i = 0; i < size; i++) {
+			data[i] = (uint8) ((i * 31 + seed) ^ (i >> 9));
+		}
+		return new GLib.Bytes.take((owned) data);
+	}
+
+	void handle(Soup.Server server, Soup.ServerMessage msg, string path,
+		GLib.HashTable<string, string>? query)
+	{
+		var body = files.lookup(path);
+		if (body == null) {
+			msg.set_status(404, null);
+			return;
+		}
+		var headers = msg.get_response_headers();
+		headers.replace("Accept-Ranges", "bytes");
+		headers.replace("ETag", "\"%s\"".printf(
+			GLib.Checksum.compute_for_bytes(GLib.ChecksumType.SHA256, body)));
+		if (msg.get_method() == "HEAD") {
+			headers.set_content_length(body.get_size());
+			msg.set_status(200, null);
+			return;
+		}
+		Soup.Range[] ranges;
+		if (!msg.get_request_headers().get_ranges((int64) body.get_size(), out ranges)
+				|| ranges.length != 1) {
+			msg.set_status(400, null);
+			return;
+		}
+		var start = ranges[0].start;
+		var end = ranges[0].end;
+		// the fourth segment of a.gguf fails the first time it is asked for
+		if (fail_once && path.has_suffix("/a.gguf") && start == 3 * SEGMENT) {
+			fail_once = false;
+			msg.set_status(500, null);
+			return;
+		}
+		headers.set_content_range(start, end, (int64) body.get_size());
+		var part = new GLib.Bytes.from_bytes(body, (size_t) start, (size_t) (end - start + 1));
+		bytes_served += (int64) part.get_size();
+		msg.set_status(206, null);
+		msg.set_response("application/octet-stream", Soup.MemoryUse.COPY, part.get_data());
+	}
+
+	string? check_sha256()
+	{
+		var bytes = make_file(3 * 64 + 17, 3);
+		unowned uint8[] data = bytes.get_data();
+		// uneven chunks so the saved state holds a partial block
+		var sizes = new int[] { 1, 63, 70, 0, 5, 64, 2 };
+		OLLMhf.Sha256? sha = new OLLMhf.Sha256();
+		var pos = 0;
+		foreach (var size in sizes) {
+			sha.update(data[pos:pos + size]);
+			pos += size;
+			sha = OLLMhf.Sha256.from_state(sha.to_state());
+			if (sha == null) {
+				return "Sha256.from_state rejected its own state";
+			}
+		}
+		sha.update(data[pos:data.length]);
+		var want = GLib.Checksum.compute_for_data(GLib.ChecksumType.SHA256, data);
+		if (sha.get_string() != want) {
+			return "Sha256 %s, GLib.Checksum %s".printf(sha.get_string(), want);
+		}
+		if (new OLLMhf.Sha256().get_string() != GLib.Checksum.compute_for_string(
+				GLib.ChecksumType.SHA256, "")) {
+			return "Sha256 of nothing";
+		}
+		if (OLLMhf.Sha256.from_state("not a state") != null) {
+			return "Sha256.from_state accepted garbage";
+		}
+		return null;
+	}
+
+	OLLMhf.Model make_model()
+	{
+		var model = new OLLMhf.Model() { id = "author/name" };
+		model.siblings.add(new OLLMhf.ModelFile() { rfilename = "a.gguf" });
+		model.siblings.add(new OLLMhf.ModelFile() { rfilename = "b.gguf" });
+		model.siblings.add(new OLLMhf.ModelFile() { rfilename = "README.md" });
+		return model;
+	}
+
+	async string? run(string hub_url, string dir)
+	{
+		var dl = new OLLMhf.Download(make_model()) {
+			models_dir = dir,
+			hub_url = hub_url,
+			connections = 3,
+			segment_size = SEGMENT,
+		};
+		try {
+			yield dl.start();
+			return "first run should fail on the injected HTTP 500";
+		} catch (GLib.Error e) {
+			GLib.debug("first run: %s", e.message);
+		}
+		var model_dir = GLib.Path.build_filename(dir, "author", "name");
+		if (!GLib.FileUtils.test(GLib.Path.build_filename(model_dir, "download.json"),
+				GLib.FileTest.EXISTS)) {
+			return "no download.json after a failed run";
+		}
+
+		var first_run = bytes_served;
+		bytes_served = 0;
+		dl = new OLLMhf.Download(make_model()) {
+			models_dir = dir,
+			hub_url = hub_url,
+			connections = 3,
+			segment_size = SEGMENT,
+		};
+		try {
+			yield dl.start();
+		} catch (GLib.Error e) {
+			return "resume: " + e.message;
+		}
+		foreach (var name in new string[] { "a.gguf", "b.gguf" }) {
+			uint8[] got;
+			try {
+				GLib.FileUtils.get_data(GLib.Path.build_filename(model_dir, name), out got);
+			} catch (GLib.Error e) {
+				return e.message;
+			}
+			var want = files.lookup("/author/name/resolve/main/" + name);
+			if (!new GLib.Bytes(got).equal(want)) {
+				return name + " content mismatch";
+			}
+		}
+		var total = (int64) (files.lookup("/author/name/resolve/main/a.gguf").get_size()
+			+ files.lookup("/author/name/resolve/main/b.gguf").get_size());
+		if (first_run == 0 || bytes_served >= total) {
+			return "resume refetched %lld of %lld bytes (first run %lld)".printf(
+				bytes_served, total, first_run);
+		}
+		if (GLib.FileUtils.test(GLib.Path.build_filename(model_dir, "download.json"),
+				GLib.FileTest.EXISTS)) {
+			return "download.json left after completion";
+		}
+		return null;
+	}
+
+	public static int main(string[] args)
+	{
+		OLLMhf.rpc_register();
+		files = new GLib.HashTable<string, GLib.Bytes>(str_hash, str_equal);
+		// not a multiple of the segment size, so the last segment is short
+		files.insert("/author/name/resolve/main/a.gguf", make_file(10 * SEGMENT + 1234, 7));
+		files.insert("/author/name/resolve/main/b.gguf", make_file(3 * SEGMENT + 99, 11));
+
+		var failure = check_sha256();
+		if (failure != null) {
+			GLib.printerr("download-test: %s\n", failure);
+			return 1;
+		}
+		try {
+			var dir = GLib.DirUtils.make_tmp("ochf-download-XXXXXX");
+			var server = new Soup.Server(null);
+			server.add_handler(null, handle);
+			server.listen_local(0, Soup.ServerListenOptions.IPV4_ONLY);
+			var uri = server.get_uris().data;
+			var hub_url = "http://127.0.0.1:%d".printf(uri.get_port());
+
+			var loop = new GLib.MainLoop();
+			run.begin(hub_url, dir, (obj, res) => {
+				failure = run.end(res);
+				loop.quit();
+			});
+			loop.run();
+		} catch (GLib.Error e) {
+			failure = e.message;
+		}
+		if (failure != null) {
+			GLib.printerr("download-test: %s\n", failure);
+			return 1;
+		}
+		return 0;
+	}
+}
@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/*
+ * OllamaWeb.HttpCache against a local Soup.Server stand-in:
+ *   /fresh   max-age=60, served from cache without a request
+ *   /etag    max-age=0 + ETag, revalidated with If-None-Match → 304
+ *   /private no-store, never cached
+ */
+
+namespace OllamaWebTests
+{
+	int hits_fresh = 0;
+	int hits_etag = 0;
+	int not_modified = 0;
+
+	void handle(Soup.Server server, Soup.ServerMessage msg, string path,
+		GLib.HashTable<string, string>? query)
+	{
+		var headers = msg.get_response_headers();
+		switch (path) {
+			case "/fresh":
+				hits_fresh++;
+				headers.replace("Cache-Control", "max-age=60");
+				break;
+			case "/etag":
+				hits_etag++;
+				headers.replace("Cache-Control", "max-age=0");
+				headers.replace("ETag", "\"v1\"");
+				if (msg.get_request_headers().get_one("If-None-Match") == "\"v1\"") {
+					not_modified++;
+					msg.set_status(304, null);
+					return;
+				}
+				break;
+			case "/private":
+				headers.replace("Cache-Control", "no-store");
+				break;
+			default:
+				msg.set_status(404, null);
+				return;
+		}
+		msg.set_status(200, null);
+		msg.set_response("text/plain", Soup.MemoryUse.COPY, ("body of " + path).data);
+	}
+
+	/** GET url through cache the way Search.Client does; returns the body. */
+	async GLib.Bytes? fetch(Soup.Session session, OllamaWeb.HttpCache cache, string url) throws GLib.Error
+	{
+		var cached = cache.lookup(url);
+		if (cached != null && cached.fresh()) {
+			return cache.body(cached);
+		}
+		var msg = new Soup.Message("GET", url);
+		if (cached != null) {
+			cache.add_validators(cached, msg);
+		}
+		var bytes = yield session.send_and_read_async(msg, GLib.Priority.DEFAULT, null);
+		if (msg.status_code == 304 && cached != null) {
+			cache.revalidated(cached, msg);
+			return cache.body(cached);
+		}
+		cache.store(url, msg, bytes);
+		return bytes;
+	}
+
+	/** Body the stand-in server sends for path (bodies are not NUL-terminated). */
+	bool is_body_of(GLib.Bytes? bytes, string path)
+	{
+		return bytes != null && bytes.compare(new GLib.Bytes(("body of " + path).data)) == 0;
+	}
+
+	/** The cache dir is flat: index.json plus one file per body or variant. */
+	void remove_dir(string dir)
+	{
+		try {
+			var d = GLib.Dir.open(dir);
+			string? name;
+			while ((name = d.read_name()) != null) {
+				GLib.FileUtils.unlink(GLib.Path.build_filename(dir, name));
+			}
+		} catch (GLib.Error e) {
+			GLib.warning("http-cache-test: %s", e.message);
+		}
+		GLib.DirUtils.remove(dir);
+	}
+
+	async string? run(string base_url, string dir) throws GLib.Error
+	{
+		var session = new Soup.Session();
+		var cache = new OllamaWeb.HttpCache(dir);
+
+		// fresh: second fetch never reaches the server
+		for (var i = 0; i < 2; i++) {
+			var body = yield fetch(session, cache, base_url + "fresh");
+			if (!is_body_of(body, "/fresh")) {
+				return "fresh body mismatch";
+			}
+		}
+		if (hits_fresh != 1) {
+			return "fresh: expected 1 request, got %d".printf(hits_fresh);
+		}
+
+		// stale with ETag: second fetch is a conditional GET answered 304
+		for (var i = 0; i < 2; i++) {
+			var body = yield fetch(session, cache, base_url + "etag");
+			if (!is_body_of(body, "/etag")) {
+				return "etag body mismatch";
+			}
+		}
+		if (hits_etag != 2 || not_modified != 1) {
+			return "etag: expected 2 requests / 1 not-modified, got %d / %d".printf(
+				hits_etag, not_modified);
+		}
+
+		// no-store: nothing kept
+		yield fetch(session, cache, base_url + "private");
+		if (cache.lookup(base_url + "private") != null) {
+			return "no-store response was cached";
+		}
+
+		// variants survive a reload of the index
+		var entry = cache.lookup(base_url + "etag");
+		cache.store_variant(entry, "markdown", "# converted");
+		var reloaded = new OllamaWeb.HttpCache(dir);
+		var again = reloaded.lookup(base_url + "etag");
+		if (again == null || reloaded.variant(again, "markdown") != "# converted") {
+			return "variant not found after reload";
+		}
+
+		// LRU: a tight cap drops the least recently used entry first
+		reloaded.max_bytes = 20;
+		again.last_used = 1;
+		reloaded.store_variant(again, "raw", "x");
+		if (reloaded.lookup(base_url + "etag") != null) {
+			return "LRU: stale entry not evicted";
+		}
+		if (reloaded.lookup(base_url + "fresh") == null) {
+			return "LRU: recent entry evicted";
+		}
+		return null;
+	}
+
+	public static int main(string[] args)
+	{
+		string? failure = null;
+		string? dir = null;
+		try {
+			dir = GLib.DirUtils.make_tmp("http-cache-XXXXXX");
+			var server = new Soup.Server(null);
+			server.add_handler(null, handle);
+			server.listen_local(0, Soup.ServerListenOptions.IPV4_ONLY);
+			var base_url = server.get_uris().data.to_string();
+
+			var loop = new GLib.MainLoop();
+			run.begin(base_url, dir, (obj, res) => {
+				try {
+					failure = run.end(res);
+				} catch (GLib.Error e) {
+					failure = e.message;
+				}
+				loop.quit();
+			});
+			loop.run();
+		} catch (GLib.Error e) {
+			failure = e.message;
+		}
+		if (dir != null) {
+			remove_dir(dir);
+		}
+		if (failure != null) {
+			GLib.printerr("http-cache-test: %s\n", failure);
+			return 1;
+		}
+		return 0;
+	}
+}
@@ -0,0 +1,288 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/*
+ * OLLMchat.Agent.ContextWindow with estimated (chars per token) counts:
+ *   num_ctx      Ollama without num_ctx uses the context the server reports,
+ *                else DEFAULT_NUM_CTX, which is then pinned in the request;
+ *                other servers use context_length
+ *   unknown      no budget: nothing dropped, tool results sent whole
+ *   pack         system + newest turn kept, oldest turns dropped first,
+ *                a tool call never split from its results
+ *   stable       after a drop the kept start stays put while it fits
+ *   truncate     oversized tool results cut to head and tail
+ *   summarize    observe() raises summarize_wanted near the budget
+ */
+
+namespace OllmchatTests
+{
+	string filler(int chars)
+	{
+		var ret = new GLib.StringBuilder();
+		while (ret.len < chars) {
+			ret.append("word ");
+		}
+		return ret.str;
+	}
+
+	OLLMchat.Settings.ModelUsage usage_with(int num_ctx, int context_length)
+	{
+		var usage = new OLLMchat.Settings.ModelUsage() { model = "test" };
+		usage.options.num_ctx = num_ctx;
+		usage.options.num_predict = 100;
+		if (context_length > 0) {
+			usage.model_obj = new OLLMchat.Response.Model() {
+				name = "test",
+				context_length = context_length
+			};
+		}
+		return usage;
+	}
+
+	string? test_num_ctx()
+	{
+		var ollama = new OLLMchat.Settings.Connection() {
+			url = "http://localhost:11434/api",
+			ollama_native = 1
+		};
+		var other = new OLLMchat.Settings.Connection() {
+			url = "http://localhost:8000/v1",
+			ollama_native = 0
+		};
+		var window = new OLLMchat.Agent.ContextWindow(usage_with(-1, 131072), ollama);
+		if (window.num_ctx != OLLMchat.Agent.ContextWindow.DEFAULT_NUM_CTX) {
+			return "ollama default num_ctx: %d".printf(window.num_ctx);
+		}
+		if (window.pinned_num_ctx != OLLMchat.Agent.ContextWindow.DEFAULT_NUM_CTX) {
+			return "ollama default not pinned: %d".printf(window.pinned_num_ctx);
+		}
+		window.server_num_ctx = 32768;
+		if (window.num_ctx != 32768 || window.pinned_num_ctx != 0) {
+			return "server num_ctx: %d pinned %d".printf(window.num_ctx, window.pinned_num_ctx);
+		}
+		window.server_num_ctx = 0;
+		window.usage.model_obj.options.num_ctx = 8192;
+		if (window.num_ctx != 8192) {
+			return "model num_ctx parameter: %d".printf(window.num_ctx);
+		}
+		if (window.pinned_num_ctx != 0) {
+			return "model num_ctx parameter pinned: %d".printf(window.pinned_num_ctx);
+		}
+		window.usage.options.num_ctx = 16384;
+		if (window.num_ctx != 16384) {
+			return "options num_ctx: %d".printf(window.num_ctx);
+		}
+		window = new OLLMchat.Agent.ContextWindow(usage_with(-1, 131072), other);
+		if (window.num_ctx != 131072) {
+			return "non-Ollama context_length: %d".printf(window.num_ctx);
+		}
+		if (window.pinned_num_ctx != 0) {
+			return "non-Ollama pinned: %d".printf(window.pinned_num_ctx);
+		}
+		window = new OLLMchat.Agent.ContextWindow(usage_with(-1, 0), null);
+		if (window.num_ctx != 0 || window.budget != 0) {
+			return "unknown context: %d".printf(window.num_ctx);
+		}
+		return null;
+	}
+
+	string? test_unknown_budget()
+	{
+		var window = new OLLMchat.Agent.ContextWindow(usage_with(-1, 0), null);
+		var messages = new Gee.ArrayList<OLLMchat.Message>();
+		messages.add(new OLLMchat.Message("system", "be brief"));
+		for (var i = 0; i < 20; i++) {
+			messages.add(new OLLMchat.Message("user", filler(2000)));
+			messages.add(new OLLMchat.Message("assistant", filler(2000)));
+		}
+		var big = filler(200000);
+		messages.add(new OLLMchat.Message.tool_reply("c1", "read_file", big));
+		var packed = window.pack(messages);
+		if (packed.size != messages.size) {
+			return "unknown budget dropped messages: %d of %d".printf(packed.size, messages.size);
+		}
+		if (packed.get(packed.size - 1).content != big) {
+			return "unknown budget truncated a tool result";
+		}
+		if (window.summary_due) {
+			return "unknown budget set summary_due";
+		}
+		return null;
+	}
+
+	string? test_pack()
+	{
+		// 2000 tokens of budget (2100 - num_predict), about 8000 characters
+		var window = new OLLMchat.Agent.ContextWindow(usage_with(2100, 0), null);
+		var messages = new Gee.ArrayList<OLLMchat.Message>();
+		var system = new OLLMchat.Message("system", "be brief");
+		messages.add(system);
+		for (var i = 0; i < 10; i++) {
+			messages.add(new OLLMchat.Message("user", "q%d ".printf(i) + filler(1000)));
+			messages.add(new OLLMchat.Message("assistant", "a%d ".printf(i) + filler(1000)));
+		}
+		var call = new OLLMchat.Message("assistant", "calling");
+		messages.add(new OLLMchat.Message("user", "last question"));
+		messages.add(call);
+		messages.add(new OLLMchat.Message.tool_reply("c1", "read_file", filler(1000)));
+		var before = messages.size;
+
+		var packed = window.pack(messages);
+		if (messages.size != before) {
+			return "pack modified the history";
+		}
+		if (packed.get(0) != system) {
+			return "system message dropped";
+		}
+		if (packed.get(packed.size - 2) != call
+				|| packed.get(packed.size - 1).role != "tool") {
+			return "newest turn not kept with its tool result";
+		}
+		if (packed.size >= messages.size) {
+			return "nothing dropped over budget";
+		}
+		if (packed.get(1).role != "user") {
+			return "kept history starts on %s".printf(packed.get(1).role);
+		}
+		if (window.total(packed) > window.budget) {
+			return "packed %d tokens over budget %d".printf(window.total(packed), window.budget);
+		}
+		// the kept turns are the newest ones, in order
+		var last = -1;
+		for (var i = 1; i < packed.size; i++) {
+			var at = messages.index_of(packed.get(i));
+			if (at <= last) {
+				return "packed messages out of order";
+			}
+			last = at;
+		}
+		if (!window.summary_due) {
+			return "dropping turns did not set summary_due";
+		}
+		return null;
+	}
+
+	string? test_stable_prefix()
+	{
+		var window = new OLLMchat.Agent.ContextWindow(usage_with(2100, 0), null);
+		var messages = new Gee.ArrayList<OLLMchat.Message>();
+		for (var i = 0; i < 10; i++) {
+			messages.add(new OLLMchat.Message("user", "q%d ".printf(i) + filler(1000)));
+			messages.add(new OLLMchat.Message("assistant", "a%d ".printf(i) + filler(1000)));
+		}
+		var start = window.pack(messages).get(0);
+		// a short turn fits in the headroom left by the drop
+		messages.add(new OLLMchat.Message("user", "short"));
+		messages.add(new OLLMchat.Message("assistant", "reply"));
+		if (window.pack(messages).get(0) != start) {
+			return "prompt start moved for a turn that fits";
+		}
+		for (var i = 0; i < 6; i++) {
+			messages.add(new OLLMchat.Message("user", "more%d ".printf(i) + filler(1000)));
+			messages.add(new OLLMchat.Message("assistant", "b%d ".printf(i) + filler(1000)));
+		}
+		var moved = window.pack(messages);
+		if (moved.get(0) == start) {
+			return "prompt start kept past the budget";
+		}
+		if (window.total(moved) > window.budget) {
+			return "packed %d tokens over budget %d".printf(window.total(moved), window.budget);
+		}
+		return null;
+	}
+
+	string? test_truncate()
+	{
+		var window = new OLLMchat.Agent.ContextWindow(usage_with(8100, 0), null) {
+			tool_result_max = 500
+		};
+		var messages = new Gee.ArrayList<OLLMchat.Message>();
+		messages.add(new OLLMchat.Message("user", "read it"));
+		messages.add(new OLLMchat.Message("assistant", "calling"));
+		var body = "HEAD\n" + filler(20000) + "\nTAIL";
+		var reply = new OLLMchat.Message.tool_reply("c1", "read_file", body);
+		messages.add(reply);
+		var packed = window.pack(messages);
+		var sent = packed.get(packed.size - 1);
+		if (sent == reply || reply.content != body) {
+			return "tool result not copied before truncating";
+		}
+		if (!sent.content.has_prefix("HEAD") || !sent.content.has_suffix("TAIL")
+				|| !sent.content.contains("tokens of tool output omitted")) {
+			return "truncated tool result: " + sent.content.substring(0, 40);
+		}
+		if (window.count(sent) > 600) {
+			return "truncated tool result still %d tokens".printf(window.count(sent));
+		}
+		if (sent.tool_call_id != "c1" || sent.name != "read_file") {
+			return "truncated tool result lost its call id";
+		}
+		return null;
+	}
+
+	string? test_summarize_wanted()
+	{
+		var connection = new OLLMchat.Settings.Connection() {
+			url = "http://localhost:8000/v1",
+			ollama_native = 0
+		};
+		var window = new OLLMchat.Agent.ContextWindow(usage_with(4100, 0), connection);
+		var wanted = 0;
+		window.summarize_wanted.connect((used, budget) => {
+			wanted = used;
+		});
+		var call = new OLLMchat.Call.ChatCompletions(connection, "test");
+		window.observe(new OLLMchat.Response.Chat(connection, call) { prompt_eval_count = 1000 });
+		if (wanted != 0 || window.summary_due) {
+			return "summarize wanted at 25%";
+		}
+		window.observe(new OLLMchat.Response.Chat(connection, call) { prompt_eval_count = 3500 });
+		if (wanted != 3500 || !window.summary_due) {
+			return "summarize not wanted at 87%";
+		}
+		window.summary_due = false;
+		wanted = 0;
+		window.observe(new OLLMchat.Response.Chat(connection, call) { prompt_eval_count = 500 });
+		if (wanted != 0) {
+			return "summarize wanted again after the summary";
+		}
+		return null;
+	}
+
+	public static int main(string[] args)
+	{
+		string? failure = null;
+		foreach (var result in new string?[] {
+			test_num_ctx(),
+			test_unknown_budget(),
+			test_pack(),
+			test_stable_prefix(),
+			test_truncate(),
+			test_summarize_wanted()
+		}) {
+			if (result != null && failure == null) {
+				failure = result;
+			}
+		}
+		if (failure != null) {
+			GLib.printerr("context-window-test: %s\n", failure);
+			return 1;
+		}
+		return 0;
+	}
+}
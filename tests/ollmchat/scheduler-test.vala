@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/*
+ * OLLMchat.Call.Scheduler, admission control on one endpoint:
+ *   cap          at most max_in_flight requests, background ones at most
+ *                max_background; the rest queue
+ *   preemption   a queued interactive request cancels the newest
+ *                preemptible background one, and takes its slot first
+ *   cancel       a caller cancelled while queued gets CANCELLED and no slot
+ *   accounting   releasing a ticket twice frees only one slot
+ */
+
+namespace OllmchatTests
+{
+	string order = "";
+	Gee.HashMap<string, OLLMchat.Call.Scheduler.Ticket> tickets;
+
+	/** Take a slot for name; order records grants ("x") and failures ("!x"). */
+	async void take(
+		OLLMchat.Call.Scheduler scheduler,
+		string name,
+		OLLMchat.Call.Priority priority,
+		bool preemptible = false,
+		GLib.Cancellable? cancellable = null)
+	{
+		try {
+			var ticket = yield scheduler.acquire(priority, cancellable, preemptible);
+			tickets.set(name, ticket);
+			order += name;
+		} catch (GLib.IOError e) {
+			order += "!" + name;
+		}
+	}
+
+	/** Run queued resumes (the scheduler wakes waiters from idle sources). */
+	void settle()
+	{
+		var ctx = GLib.MainContext.default();
+		while (ctx.pending()) {
+			ctx.iteration(false);
+		}
+	}
+
+	string? run()
+	{
+		tickets = new Gee.HashMap<string, OLLMchat.Call.Scheduler.Ticket>();
+		var scheduler = new OLLMchat.Call.Scheduler() {
+			max_in_flight = 2,
+			max_background = 1
+		};
+		var bg = OLLMchat.Call.Priority.BACKGROUND;
+		var fg = OLLMchat.Call.Priority.INTERACTIVE;
+
+		// background cap: b runs, c waits even though a slot is free
+		take.begin(scheduler, "b", bg, true);
+		take.begin(scheduler, "c", bg);
+		settle();
+		if (order != "b") {
+			return "background cap: " + order;
+		}
+		// interactive takes the free slot straight away
+		take.begin(scheduler, "i", fg);
+		settle();
+		if (order != "bi") {
+			return "interactive with a free slot: " + order;
+		}
+
+		// full: the next interactive request preempts b
+		take.begin(scheduler, "j", fg);
+		settle();
+		var b = tickets.get("b");
+		if (!b.preempted || !b.cancellable.is_cancelled()) {
+			return "background request not preempted";
+		}
+		if (tickets.get("i").cancellable.is_cancelled()) {
+			return "interactive request preempted";
+		}
+		// b's caller gives the slot back; queued interactive goes before c
+		scheduler.release(b);
+		settle();
+		if (order != "bij") {
+			return "after preemption: " + order;
+		}
+
+		// accounting: a second release of b frees nothing
+		scheduler.release(b);
+		settle();
+		if (order != "bij") {
+			return "double release freed a slot: " + order;
+		}
+		scheduler.release(tickets.get("i"));
+		settle();
+		if (order != "bijc") {
+			return "background after interactive: " + order;
+		}
+
+		// cancelled while queued: no slot, and the queue moves on
+		var cancel = new GLib.Cancellable();
+		take.begin(scheduler, "k", fg, false, cancel);
+		take.begin(scheduler, "l", fg);
+		settle();
+		if (order != "bijc") {
+			return "queued past the cap: " + order;
+		}
+		cancel.cancel();
+		settle();
+		if (order != "bijc!k") {
+			return "cancel while queued: " + order;
+		}
+		scheduler.release(tickets.get("j"));
+		settle();
+		if (order != "bijc!kl") {
+			return "after cancelled waiter: " + order;
+		}
+		scheduler.release(tickets.get("c"));
+		scheduler.release(tickets.get("l"));
+		take.begin(scheduler, "m", bg);
+		take.begin(scheduler, "n", fg);
+		settle();
+		if (order != "bijc!klmn") {
+			return "slots not returned: " + order;
+		}
+		return null;
+	}
+
+	public static int main(string[] args)
+	{
+		var failure = run();
+		if (failure != null) {
+			GLib.printerr("scheduler-test: %s\n", failure);
+			return 1;
+		}
+		return 0;
+	}
+}
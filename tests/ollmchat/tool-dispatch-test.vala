@@ -0,0 +1,351 @@
+/*
+ * Copyright (C) 2026 Alan Knowles <alan@roojs.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/*
+ * OLLMchat.Agent.Base.execute_tools with stub tools (no server is contacted):
+ *   order        parallel calls that finish in reverse order reply in call order
+ *   cap          no more than max_parallel_tools calls run at once
+ *   barrier      a tool that is not parallel_safe runs alone
+ *   permission   parallel calls that need permission are asked one at a time
+ *   prefetch     a streamed call starts early, stopping at a mutating call;
+ *                cancelling the reply discards it (the confirmed call runs
+ *                again) and releases the barrier for the next reply
+ */
+
+namespace OllmchatTests
+{
+	/** What the stub tools and provider saw. */
+	class Probe : Object
+	{
+		public int running = 0;
+		public int max_running = 0;
+		public bool barrier_broken = false;
+		public int prompting = 0;
+		public int max_prompting = 0;
+		public int prompts = 0;
+		public int started = 0;
+
+		public void reset()
+		{
+			this.started = 0;
+			this.running = 0;
+			this.max_running = 0;
+			this.barrier_broken = false;
+			this.prompting = 0;
+			this.max_prompting = 0;
+			this.prompts = 0;
+		}
+	}
+
+	Probe probe;
+
+	async void sleep_ms(uint ms)
+	{
+		GLib.Timeout.add(ms, sleep_ms.callback);
+		yield;
+	}
+
+	/** Waits delay ms; asks permission for path when it is set. */
+	class StubRequest : OLLMchat.Tool.RequestBase
+	{
+		public string path { get; set; default = ""; }
+		public int delay { get; set; default = 0; }
+
+		public override bool build_perm_question()
+		{
+			if (this.path == "") {
+				return false;
+			}
+			this.permission_target_path = this.path;
+			this.permission_question = "Read " + this.path + "?";
+			this.permission_operation = OLLMchat.ChatPermission.Operation.READ;
+			return true;
+		}
+
+		protected override async string execute_request() throws Error
+		{
+			probe.started++;
+			probe.running++;
+			probe.max_running = int.max(probe.max_running, probe.running);
+			if (!this.tool.parallel_safe && probe.running > 1) {
+				probe.barrier_broken = true;
+			}
+			yield sleep_ms(this.delay);
+			if (!this.tool.parallel_safe && probe.running > 1) {
+				probe.barrier_broken = true;
+			}
+			probe.running--;
+			return this.tool.name + " " + this.path;
+		}
+	}
+
+	class StubTool : OLLMchat.Tool.BaseTool
+	{
+		private string tool_name;
+		private bool is_parallel;
+		private bool is_prefetch;
+
+		public override string name { get { return this.tool_name; } }
+		public override string title { get { return "Stub"; } }
+		public override string description { get { return "Waits, optionally after asking permission."; } }
+		public override string example_call { get { return ""; } }
+		public override bool parallel_safe { get { return this.is_parallel; } }
+		public override bool prefetch_safe { get { return this.is_prefetch; } }
+		public override string parameter_description { get {
+			return """
+@param path {string} [optional] Path to ask permission for.
+@param delay {integer} [optional] Milliseconds to wait.""";
+		} }
+
+		public override Type config_class() { return typeof(OLLMchat.Settings.BaseToolConfig); }
+
+		public StubTool(string name, bool parallel, bool prefetch = false)
+		{
+			base();
+			this.tool_name = name;
+			this.is_parallel = parallel;
+			this.is_prefetch = prefetch;
+			// the base constructor built function before name was set
+			this.function = null;
+			this.init();
+		}
+
+		protected override OLLMchat.Tool.RequestBase? deserialize(Json.Node parameters_node)
+		{
+			return Json.gobject_deserialize(typeof(StubRequest), parameters_node) as OLLMchat.Tool.RequestBase;
+		}
+	}
+
+	/** Allows every request after a short wait, counting overlapping prompts. */
+	class StubProvider : OLLMchat.ChatPermission.Provider
+	{
+		public StubProvider()
+		{
+			base();
+		}
+
+		protected override async OLLMchat.ChatPermission.PermissionResponse request_user(
+			OLLMchat.Tool.RequestBase request)
+		{
+			probe.prompting++;
+			probe.prompts++;
+			probe.max_prompting = int.max(probe.max_prompting, probe.prompting);
+			yield sleep_ms(20);
+			probe.prompting--;
+			return OLLMchat.ChatPermission.PermissionResponse.ALLOW_ONCE;
+		}
+	}
+
+	class StubApp : Object, OLLMchat.ApplicationInterface
+	{
+		public OLLMchat.Settings.Config2 config { get; set; }
+		public string data_dir { get; set; }
+
+		public OLLMchat.Settings.Config2 load_config()
+		{
+			return this.config;
+		}
+	}
+
+	class TestAgent : OLLMchat.Agent.Base
+	{
+		public TestAgent(OLLMchat.Agent.Factory factory, OLLMchat.History.SessionBase session)
+		{
+			base(factory, session);
+			this.chat_call.tools.set("look", new StubTool("look", true));
+			this.chat_call.tools.set("change", new StubTool("change", false));
+			this.chat_call.tools.set("fetch", new StubTool("fetch", true, true));
+		}
+
+		/** Cancellable of the (pretend) streaming call. */
+		public void use_cancellable(GLib.Cancellable cancellable)
+		{
+			this.chat_call.cancellable = cancellable;
+		}
+	}
+
+	OLLMchat.Response.ToolCall call(string id, string name, int delay, string path = "")
+	{
+		var args = new Json.Object();
+		args.set_int_member("delay", delay);
+		if (path != "") {
+			args.set_string_member("path", path);
+		}
+		return new OLLMchat.Response.ToolCall.with_values(id,
+			new OLLMchat.Response.CallFunction.with_values(name, args));
+	}
+
+	string? check_order(Gee.ArrayList<OLLMchat.Message> replies, int expect)
+	{
+		if (replies.size != expect) {
+			return "%d replies for %d calls".printf(replies.size, expect);
+		}
+		for (var i = 0; i < replies.size; i++) {
+			if (replies.get(i).tool_call_id != "c%d".printf(i)) {
+				return "reply %d is for %s".printf(i, replies.get(i).tool_call_id);
+			}
+			if (replies.get(i).content.has_prefix("ERROR")) {
+				return "reply %d failed: %s".printf(i, replies.get(i).content);
+			}
+		}
+		return null;
+	}
+
+	async string? run(TestAgent agent)
+	{
+		// order + cap: later calls finish first
+		probe.reset();
+		agent.max_parallel_tools = 3;
+		var calls = new Gee.ArrayList<OLLMchat.Response.ToolCall>();
+		for (var i = 0; i < 6; i++) {
+			calls.add(call("c%d".printf(i), "look", 60 - i * 10));
+		}
+		var replies = yield agent.execute_tools(calls);
+		var failure = check_order(replies, 6);
+		if (failure != null) {
+			return "order: " + failure;
+		}
+		if (probe.max_running != 3) {
+			return "cap: %d calls ran at once with max_parallel_tools 3".printf(probe.max_running);
+		}
+
+		// barrier: the mutating call waits for the batch and runs alone
+		probe.reset();
+		calls.clear();
+		calls.add(call("c0", "look", 30));
+		calls.add(call("c1", "look", 10));
+		calls.add(call("c2", "change", 20));
+		calls.add(call("c3", "look", 10));
+		calls.add(call("c4", "look", 10));
+		replies = yield agent.execute_tools(calls);
+		failure = check_order(replies, 5);
+		if (failure != null) {
+			return "barrier: " + failure;
+		}
+		if (probe.barrier_broken) {
+			return "barrier: change ran alongside other calls";
+		}
+
+		// permission: one prompt at a time, every call still runs
+		probe.reset();
+		agent.max_parallel_tools = 4;
+		calls.clear();
+		for (var i = 0; i < 4; i++) {
+			calls.add(call("c%d".printf(i), "look", 0, "/dispatch-test/file%d".printf(i)));
+		}
+		replies = yield agent.execute_tools(calls);
+		failure = check_order(replies, 4);
+		if (failure != null) {
+			return "permission: " + failure;
+		}
+		if (probe.prompts != 4) {
+			return "permission: %d prompts for 4 calls".printf(probe.prompts);
+		}
+		if (probe.max_prompting != 1) {
+			return "permission: %d prompts open at once".printf(probe.max_prompting);
+		}
+		return yield run_prefetch(agent);
+	}
+
+	async string? run_prefetch(TestAgent agent)
+	{
+		probe.reset();
+		agent.use_cancellable(new GLib.Cancellable());
+		var response = new OLLMchat.Response.Chat(null, agent.chat());
+		response.message.tool_calls.add(call("c0", "fetch", 50));
+		response.message.tool_calls.add(call("c1", "change", 0));
+		response.message.tool_calls.add(call("c2", "fetch", 5));
+		agent.prefetch_tool_calls(response);
+		if (probe.started != 1) {
+			return "prefetch: %d calls started, expected only the one before change".printf(probe.started);
+		}
+
+		// the reply is cancelled while c0 is still running
+		agent.chat().cancellable.cancel();
+		yield sleep_ms(10);
+
+		// next reply: barrier of the cancelled one no longer applies
+		agent.use_cancellable(new GLib.Cancellable());
+		var next = new OLLMchat.Response.Chat(null, agent.chat());
+		next.message.tool_calls.add(call("c2", "fetch", 5));
+		agent.prefetch_tool_calls(next);
+		if (probe.started != 2) {
+			return "prefetch: barrier kept after cancel (%d started)".printf(probe.started);
+		}
+
+		// the discarded c0 prefetch is not used; the call runs again
+		var calls = new Gee.ArrayList<OLLMchat.Response.ToolCall>();
+		calls.add(call("c0", "fetch", 50));
+		var replies = yield agent.execute_tools(calls);
+		if (replies.size != 1 || replies.get(0).tool_call_id != "c0") {
+			return "prefetch: no reply for c0";
+		}
+		if (probe.started != 3) {
+			return "prefetch: cancelled result was used (%d started)".printf(probe.started);
+		}
+		// let the abandoned runs finish before the manager goes away
+		yield sleep_ms(100);
+		return null;
+	}
+
+	public static int main(string[] args)
+	{
+		probe = new Probe();
+		string data_dir;
+		try {
+			data_dir = GLib.DirUtils.make_tmp("tool-dispatch-test-XXXXXX");
+		} catch (GLib.FileError e) {
+			GLib.printerr("tool-dispatch-test: %s\n", e.message);
+			return 1;
+		}
+		// nothing listens here; the stub tools never reach the server
+		var url = "http://127.0.0.1:9/api";
+		var config = new OLLMchat.Settings.Config2();
+		config.connections.set(url, new OLLMchat.Settings.Connection() {
+			url = url,
+			ollama_native = 1
+		});
+		config.usage.set("default_model", new OLLMchat.Settings.ModelUsage() {
+			connection = url,
+			model = "stub"
+		});
+		var manager = new OLLMchat.History.Manager(new StubApp() {
+			config = config,
+			data_dir = data_dir
+		});
+		manager.permission_provider = new StubProvider();
+		var agent = new TestAgent(new OLLMchat.Agent.JustAskFactory(), manager.session);
+
+		string? failure = null;
+		var loop = new GLib.MainLoop();
+		run.begin(agent, (o, res) => {
+			failure = run.end(res);
+			loop.quit();
+		});
+		loop.run();
+		var history_dir = GLib.Path.build_filename(data_dir, "history");
+		GLib.FileUtils.unlink(GLib.Path.build_filename(history_dir, "history.db"));
+		GLib.DirUtils.remove(history_dir);
+		GLib.DirUtils.remove(data_dir);
+		if (failure != null) {
+			GLib.printerr("tool-dispatch-test: %s\n", failure);
+			return 1;
+		}
+		return 0;
+	}
+}
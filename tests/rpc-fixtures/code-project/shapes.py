@@ -0,0 +1,14 @@
+class Square:
+    def __init__(self, side):
+        self.side = side
+
+    def area(self):
+        return self.side * self.side
+
+
+def total_area(shapes):
+    return sum(shape.area() for shape in shapes)
+
+
+def main():
+    print(total_area([Square(2), Square(3)]))
@@ -0,0 +1,147 @@
+#!/bin/bash
+# Bubble tests part 6: persistent sandbox worker (output framing, recovery after failures)
+
+set -e
+
+STOP_ON_FAILURE=false
+if [ "${1:-}" = "--stop-on-failure" ] || [ "${1:-}" = "-x" ]; then
+    STOP_ON_FAILURE=true
+    shift
+fi
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+PROJECT_ROOT="$(cd "$SCRIPT_DIR/.." && pwd)"
+BUILD_DIR="${1:-$PROJECT_ROOT/build}"
+BUILD_DIR="$(cd "$SCRIPT_DIR" && cd "$BUILD_DIR" && pwd)"
+source "$SCRIPT_DIR/test-common.sh"
+
+OC_TEST_BUBBLE="$BUILD_DIR/oc-test-bubble"
+TEST_DIR="$BUILD_DIR/ollmchat-testing"
+TEST_PROJECT_DIR="$TEST_DIR/project"
+TEST_DB="$BUILD_DIR/test-bubble.db"
+DATA_DIR="$SCRIPT_DIR/data"
+export TEST_DB
+export TEST_PROJECT_DIR
+
+# Run each argument as one command in a single worker; output in $WORKER_OUTPUT
+worker_exec () {
+    WORKER_OUTPUT=$("$OC_TEST_BUBBLE" --project="$TEST_PROJECT_DIR" --test-db="$TEST_DB" --worker "$@" 2>&1) || true
+}
+
+# Print the result of command N from $WORKER_OUTPUT
+worker_result () {
+    echo "$WORKER_OUTPUT" | awk -v n="$1" '
+        $0 == "--- End Command " n " ---" { on = 0 }
+        on { print }
+        $0 == "--- Command " n " ---" { on = 1 }
+    '
+}
+
+expect_result () {
+    local testname="$1"
+    local n="$2"
+    local expected="$3"
+    local got
+    got=$(worker_result "$n")
+    if [ "$got" = "$expected" ]; then
+        test_pass "$testname: command $n output"
+    else
+        test_fail "$testname: command $n expected [$expected] got [$got]"
+    fi
+}
+
+expect_result_contains () {
+    local testname="$1"
+    local n="$2"
+    local needle="$3"
+    if worker_result "$n" | grep -qF -- "$needle"; then
+        test_pass "$testname: command $n contains [$needle]"
+    else
+        test_fail "$testname: command $n missing [$needle]: $(worker_result "$n")"
+    fi
+}
+
+test_worker_framing () {
+    echo "=== Test 8.1: output of consecutive commands stays separate ==="
+    reset_test_state
+    mkdir -p "$TEST_PROJECT_DIR"
+    local testname="test_worker_framing"
+    worker_exec "echo one" "printf 'no newline'" "printf 'a\n\nb\n'" "echo three"
+    expect_result "$testname" 1 "one"
+    expect_result "$testname" 2 "no newline"
+    expect_result "$testname" 3 "$(printf 'a\n\nb')"
+    expect_result "$testname" 4 "three"
+}
+
+test_worker_boundary_lookalike () {
+    echo "=== Test 8.2: output that looks like a boundary does not end the frame ==="
+    reset_test_state
+    mkdir -p "$TEST_PROJECT_DIR"
+    local testname="test_worker_boundary_lookalike"
+    worker_exec "printf -- '--ollmchat-x 0\nafter\n'" "echo next"
+    expect_result "$testname" 1 "$(printf -- '--ollmchat-x 0\nafter')"
+    expect_result "$testname" 2 "next"
+}
+
+test_worker_recovers_after_failure () {
+    echo "=== Test 8.3: failing commands do not break the worker ==="
+    reset_test_state
+    mkdir -p "$TEST_PROJECT_DIR"
+    local testname="test_worker_recovers_after_failure"
+    worker_exec "false" "echo oops >&2; exit 3" "cd /nonexistent-oc-test" "echo still running"
+    expect_result_contains "$testname" 1 "Exit code: 1"
+    expect_result_contains "$testname" 2 "oops"
+    expect_result_contains "$testname" 2 "Exit code: 3"
+    expect_result_contains "$testname" 3 "Exit code: "
+    expect_result "$testname" 4 "still running"
+}
+
+test_worker_recovers_after_server_exit () {
+    echo "=== Test 8.4: worker restarts after the sandbox exits ==="
+    reset_test_state
+    mkdir -p "$TEST_PROJECT_DIR"
+    local testname="test_worker_recovers_after_server_exit"
+    worker_exec 'kill -9 $PPID' "echo restarted"
+    expect_result "$testname" 2 "restarted"
+}
+
+test_worker_state_between_commands () {
+    echo "=== Test 8.5: files written by one command are seen by the next ==="
+    reset_test_state
+    mkdir -p "$TEST_PROJECT_DIR"
+    local testname="test_worker_state_between_commands"
+    rm -f "$TEST_PROJECT_DIR/worker-file"
+    worker_exec "echo data > worker-file" "cat worker-file"
+    expect_result "$testname" 2 "data"
+    verify_file_content "$testname" "$TEST_PROJECT_DIR/worker-file" "data" "File applied to project"
+}
+
+run_part_6 () {
+    run_test test_worker_framing
+    run_test test_worker_boundary_lookalike
+    run_test test_worker_recovers_after_failure
+    run_test test_worker_recovers_after_server_exit
+    run_test test_worker_state_between_commands
+}
+
+main () {
+    echo "Starting bubblewrap persistent worker tests (part 6)..."
+    echo "Test directory: $TEST_DIR"
+    echo "Project directory: $TEST_PROJECT_DIR"
+    echo ""
+    setup_test_env
+    run_part_6
+    print_test_summary
+    if [ "${TESTS_FAILED:-0}" -eq 0 ]; then
+        [ -z "${GENERATE_EXPECTED_MODE:-}" ] && rm -rf "$TEST_DIR"
+        echo ""
+        echo "All tests passed! Test directory cleaned up."
+        exit 0
+    else
+        echo ""
+        echo -e "${YELLOW}Some tests failed. Test files left in $TEST_DIR for debugging.${NC}"
+        exit 1
+    fi
+}
+
+[[ "${BASH_SOURCE[0]}" == "${0}" ]] && main
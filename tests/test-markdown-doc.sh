@@ -1,6 +1,8 @@
 #!/bin/bash
 # Document renderer round-trip test: for each tests/markdown/*.md,
 # run md → JSON (in build dir), then JSON → md, and compare input vs round-trip output.
+# Also replays each parsed document into HtmlRender and compares that with
+# HTML from a fresh parse of the same file.
 
 set -euo pipefail
 
@@ -87,6 +89,23 @@ for f in markdown/*.md; do
 		(cd "$OUT_DIR" && patch -p0 --forward -i "$SCRIPT_DIR/markdown/${base}-roundtrip-output.diff") || true
 	fi
 	test-match "markdown-doc $base" "$roundtrip_output" "$expected_side" "round-trip md matches original (diffs only for accepted differences)"
+
+	# Replay (Node.emit per top-level block) must draw what a parse draws.
+	# Blocks are rendered one at a time, so whitespace between them may
+	# differ; everything else must match.
+	html_file="$OUT_DIR/$base-parse.html"
+	replay_file="$OUT_DIR/$base-replay.html"
+	if ! "$OC_DOC_TEST" "$f" html > "$html_file" 2>/dev/null \
+		|| ! "$OC_DOC_TEST" "$f" replay > "$replay_file" 2>/dev/null; then
+		test_fail "markdown-doc $base: html / replay output failed"
+		continue
+	fi
+	if [ "$(tr -d ' \t\n' < "$html_file")" = "$(tr -d ' \t\n' < "$replay_file")" ]; then
+		test_pass "markdown-doc $base: replayed document matches a fresh parse"
+	else
+		diff -u -w "$html_file" "$replay_file" | head -40 || true
+		test_fail "markdown-doc $base: replayed document differs from a fresh parse"
+	fi
 done
 
 print_test_summary
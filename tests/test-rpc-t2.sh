@@ -63,12 +63,13 @@ run_t2_case() {
 # Fresh data_dir per case — avoids cross-script DB interference (e.g. after shutdown).
 run_t2_case_isolated() {
     local template="$1"
+    local fixture="${2:-minimal-project}"
     local case_dir
     case_dir=$(mktemp -d "$TEST_DIR/case-XXXX")
     ISOLATED_DIRS+=("$case_dir")
     local saved_test_dir="$TEST_DIR"
     TEST_DIR="$case_dir"
-    setup_rpc_fixture minimal-project
+    setup_rpc_fixture "$fixture"
     ISOLATED_HELLO="$RPC_PROJECT_PATH/hello.txt"
     ISOLATED_REGISTER="$RPC_PROJECT_PATH/pending-register.txt"
     ISOLATED_DB="$case_dir/files.sqlite"
@@ -185,5 +186,29 @@ run_t2_case_isolated "$SCRIPT_DIR/rpc/t2-delete.script.in"
 jq_resp_ok "T2B.6 File.read before delete (no error)" 5 "$RPC_LAST_OUT" '.error == null'
 jq_resp_ok "T2B.6 File.delete (no error)" 7 "$RPC_LAST_OUT" '.error == null and .msg == "ok"'
 
+# --- Path A: symbol index lookups (isolated data_dir, code fixture) ---
+if ldconfig -p 2>/dev/null | grep -q "tree-sitter-python\|parser_python\|tree_sitter_parser_python"; then
+    run_t2_case_isolated "$SCRIPT_DIR/rpc/t2-symbols.script.in" code-project
+    SHAPES_PATH="$RPC_PROJECT_PATH/shapes.py"
+    jq_resp_args_ok "T2A.8 Codebase.symbols (definition)" 4 "$RPC_LAST_OUT" \
+        --arg p "$SHAPES_PATH" \
+        '.error == null and (.msg | fromjson | any(.name == "area" and .file == $p and .start_line == 5))'
+    jq_resp_ok "T2A.8 Codebase.symbols (qualified name)" 5 "$RPC_LAST_OUT" \
+        '.error == null and (.msg | fromjson | length == 1 and .[0].container == "Square")'
+    jq_resp_ok "T2A.8 Codebase.references (call site + caller)" 6 "$RPC_LAST_OUT" \
+        '.error == null and (.msg | fromjson | any(.kind == "call" and .start_line == 14 and (.container | endswith("main"))))'
+    jq_resp_ok "T2A.8 Codebase.symbols file_path (outline rows in order)" 7 "$RPC_LAST_OUT" \
+        '.error == null and (.msg | fromjson | (map(.name) | index("Square") < index("total_area")) and length >= 4)'
+    jq_resp_ok "T2A.8 Codebase.outline (no error)" 8 "$RPC_LAST_OUT" \
+        '.error == null and (.msg | contains("total_area"))'
+    jq_resp_ok "T2A.8 Codebase.symbols (unknown name)" 9 "$RPC_LAST_OUT" \
+        '.error == null and .msg == "[]"'
+    sqlite_count_ok "T2A.8 symbol index persisted" "$ISOLATED_DB" \
+        "SELECT COUNT(*) FROM code_file f JOIN filebase b ON b.id = f.file_id WHERE b.path = '$SHAPES_PATH';" \
+        "1"
+else
+    echo -e "${YELLOW}SKIP${NC} T2A.8 symbol index (no tree-sitter python parser installed)"
+fi
+
 print_test_summary
 exit "$([ "${TESTS_FAILED:-0}" -eq 0 ] && echo 0 || echo 1)"